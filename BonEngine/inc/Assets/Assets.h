@@ -7,6 +7,8 @@
  *********************************************************************/
 #pragma once
 #include "IAssets.h"
+#include "AssetsRegistry.h"
+#include "AssetsResidency.h"
 #include <unordered_map>
 #include <string>
 
@@ -32,7 +34,13 @@ namespace bon
 			size_t _counts[(int)AssetTypes::_Count] = { 0 };
 
 			// assets cache
-			std::unordered_map<std::string, AssetPtr> _cache;
+			AssetsResidency _cache;
+
+			// assets released from cache, to free outside the cache lock
+			std::vector<AssetPtr> _releasedFromCache;
+
+			// assets handles
+			AssetsRegistry _registry;
 
 		protected:
 
@@ -66,7 +74,7 @@ namespace bon
 			 * \param useCache If true, will try to get asset from cache first. If not found in cache will add to cache after load.
 			 * \return Image asset.
 			 */
-			virtual ImageAsset LoadImage(const char* filename, ImageFilterMode filter = ImageFilterMode::Nearest, bool useCache = true) override;
+			virtual ImageAsset LoadImage(const char* filename, ImageFilterMode filter = ImageFilterMode::Nearest, bool useCache = true, ImageStreaming streaming = ImageStreaming::Disabled) override;
 
 			/**
 			 * Load and return a music asset.
@@ -82,9 +90,10 @@ namespace bon
 			 *
 			 * \param filename Sound file path.
 			 * \param useCache If true, will try to get asset from cache first. If not found in cache will add to cache after load.
+			 * \param storage Decode sound on load, or keep it compressed in memory and decode while playing.
 			 * \return Image asset.
 			 */
-			virtual SoundAsset LoadSound(const char* filename, bool useCache = true) override;
+			virtual SoundAsset LoadSound(const char* filename, bool useCache = true, SoundStorage storage = SoundStorage::Auto) override;
 
 			/**
 			 * Load and return a configuration asset.
@@ -138,6 +147,64 @@ namespace bon
 			 */
 			virtual bool SaveConfig(ConfigAsset config, const char* filename) override;
 
+			/**
+			 * Set memory budgets for cached assets of a given type.
+			 *
+			 * \param type Asset type.
+			 * \param ramBytes System memory budget, in bytes (0 = unlimited).
+			 * \param vramBytes Video memory budget, in bytes (0 = unlimited).
+			 */
+			virtual void SetCacheBudget(AssetTypes type, size_t ramBytes, size_t vramBytes) override;
+
+			/**
+			 * Get cache residency stats for a given asset type.
+			 *
+			 * \param type Asset type.
+			 * \return Cache stats.
+			 */
+			virtual AssetsCacheStats GetCacheStats(AssetTypes type) const override;
+
+			/**
+			 * Get an integer handle for an asset, and add a reference to it.
+			 *
+			 * \param asset Asset to get handle for.
+			 * \return Asset handle, or InvalidAssetHandle if asset is null.
+			 */
+			virtual AssetHandle AcquireHandle(const AssetPtr& asset) override;
+
+			/**
+			 * Release a reference acquired with 'AcquireHandle()'.
+			 *
+			 * \param handle Handle to release.
+			 * \param deferred If true, will release handle on next assets update.
+			 */
+			virtual void ReleaseHandle(AssetHandle handle, bool deferred = false) override;
+
+			/**
+			 * Get existing handle of an asset, without adding a reference to it.
+			 */
+			virtual AssetHandle FindHandle(const AssetPtr& asset) const override;
+
+			/**
+			 * Get if an asset handle is valid.
+			 */
+			virtual bool IsHandleValid(AssetHandle handle) const override;
+
+			/**
+			 * Get asset by handle, without type.
+			 */
+			virtual IAsset* ResolveHandle(AssetHandle handle) const override;
+
+			/**
+			 * Get typed assets by handle.
+			 */
+			virtual const ImageAsset& GetImage(AssetHandle handle) const override { return _registry.GetImage(handle); }
+			virtual const SoundAsset& GetSound(AssetHandle handle) const override { return _registry.GetSound(handle); }
+			virtual const MusicAsset& GetMusic(AssetHandle handle) const override { return _registry.GetMusic(handle); }
+			virtual const ConfigAsset& GetConfig(AssetHandle handle) const override { return _registry.GetConfig(handle); }
+			virtual const FontAsset& GetFont(AssetHandle handle) const override { return _registry.GetFont(handle); }
+			virtual const EffectAsset& GetEffect(AssetHandle handle) const override { return _registry.GetEffect(handle); }
+
 			/**
 			 * Clear all assets in cache.
 			 * Note: this won't necessarily dispose all assets - assets that are still held in external code will survive.
@@ -194,6 +261,11 @@ namespace bon
 			 */
 			AssetPtr GetFromCache(const char* id);
 
+			/**
+			 * Update cache diagnostics counters.
+			 */
+			void UpdateCacheDiagnostics();
+
 			/**
 			 * Called to initialize every new asset we create.
 			 * 
@@ -0,0 +1,244 @@
+/*****************************************************************//**
+ * \file   AssetsRegistry.h
+ * \brief  Slot map that gives assets integer handles.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "Defs.h"
+#include <vector>
+#include <unordered_map>
+
+namespace bon
+{
+	namespace assets
+	{
+		/**
+		 * Slots of a single asset type.
+		 * Each slot holds a reference to the asset, a generation that changes whenever the slot is freed, and how many times the handle was acquired.
+		 */
+		template <class T>
+		class AssetsSlotMap
+		{
+		private:
+
+			// a single slot
+			struct Slot
+			{
+				// the asset (empty if slot is free)
+				std::shared_ptr<T> Asset;
+
+				// slot generation (never 0, so handles are never 0)
+				uint32_t Generation = 1;
+
+				// how many references were acquired for this handle
+				uint32_t References = 0;
+			};
+
+			// all slots and free slots indices
+			std::vector<Slot> _slots;
+			std::vector<uint32_t> _free;
+
+			// returned for invalid handles
+			std::shared_ptr<T> _null;
+
+		public:
+
+			/**
+			 * Put asset in a free slot with a single reference.
+			 *
+			 * \param asset Asset to store.
+			 * \param maxSlots Max slots this map may grow to.
+			 * \param outGeneration Slot generation.
+			 * \return Slot index, or -1 if there are no more free slots.
+			 */
+			inline int Add(const std::shared_ptr<T>& asset, uint32_t maxSlots, uint32_t& outGeneration)
+			{
+				if (_free.empty())
+				{
+					if (_slots.size() >= maxSlots) { return -1; }
+					_free.push_back((uint32_t)_slots.size());
+					_slots.emplace_back();
+				}
+				uint32_t index = _free.back();
+				_free.pop_back();
+				Slot& slot = _slots[index];
+				slot.Asset = asset;
+				slot.References = 1;
+				outGeneration = slot.Generation;
+				return (int)index;
+			}
+
+			/**
+			 * Get slot if index and generation match, or nullptr.
+			 */
+			inline Slot* GetSlot(uint32_t index, uint32_t generation)
+			{
+				if (index >= _slots.size()) { return nullptr; }
+				Slot& slot = _slots[index];
+				return (slot.Generation == generation && slot.References > 0) ? &slot : nullptr;
+			}
+
+			/**
+			 * Get asset in slot, or empty pointer if index and generation don't match.
+			 */
+			inline const std::shared_ptr<T>& Get(uint32_t index, uint32_t generation) const
+			{
+				if (index >= _slots.size()) { return _null; }
+				const Slot& slot = _slots[index];
+				return (slot.Generation == generation && slot.References > 0) ? slot.Asset : _null;
+			}
+
+			/**
+			 * Free a slot and advance its generation.
+			 * Returns the asset it held, so caller decides when the last reference drops.
+			 */
+			inline std::shared_ptr<T> Free(uint32_t index, uint32_t generationMask)
+			{
+				Slot& slot = _slots[index];
+				std::shared_ptr<T> ret = std::move(slot.Asset);
+				slot.References = 0;
+				slot.Generation = (slot.Generation + 1) & generationMask;
+				if (slot.Generation == 0) { slot.Generation = 1; }
+				_free.push_back(index);
+				return ret;
+			}
+
+			/**
+			 * Get how many slots are in use.
+			 */
+			inline size_t Count() const { return _slots.size() - _free.size(); }
+		};
+
+		/**
+		 * Registry that gives assets 32 bit generational handles, so they can be referenced by plain integers.
+		 * Resolving a handle is an array lookup with no reference counting, and handles to released assets resolve to nothing instead of dangling.
+		 * The registry holds a reference to every registered asset until its handle is released.
+		 * Used only from the main thread.
+		 */
+		class AssetsRegistry
+		{
+		public:
+
+			/**
+			 * Handle bits layout: [generation | type | index].
+			 */
+			static const uint32_t IndexBits = 17;
+			static const uint32_t TypeBits = 3;
+			static const uint32_t GenerationBits = 12;
+
+			/**
+			 * Max assets per type.
+			 */
+			static const uint32_t MaxSlots = 1u << IndexBits;
+
+		private:
+
+			// bit masks
+			static const uint32_t IndexMask = MaxSlots - 1;
+			static const uint32_t TypeMask = (1u << TypeBits) - 1;
+			static const uint32_t GenerationMask = (1u << GenerationBits) - 1;
+
+			// slots per asset type
+			AssetsSlotMap<_Image> _images;
+			AssetsSlotMap<_Sound> _sounds;
+			AssetsSlotMap<_Music> _music;
+			AssetsSlotMap<_Config> _configs;
+			AssetsSlotMap<_Font> _fonts;
+			AssetsSlotMap<_Effect> _effects;
+
+			// handle of every registered asset, so the same asset always gets the same handle
+			std::unordered_map<const IAsset*, AssetHandle> _handles;
+
+			// handles to release on next flush
+			std::vector<AssetHandle> _deferred;
+
+		public:
+
+			/**
+			 * Get handle for an asset and add a reference to it.
+			 * If asset is already registered, will return its existing handle.
+			 *
+			 * \param asset Asset to get handle for.
+			 * \return Asset handle, or InvalidAssetHandle if asset is null or there are no free slots.
+			 */
+			AssetHandle Acquire(const AssetPtr& asset);
+
+			/**
+			 * Remove a reference from handle. When last reference is removed the slot is freed, and the asset is disposed if nothing else holds it.
+			 */
+			void Release(AssetHandle handle);
+
+			/**
+			 * Remove a reference from handle on next call to 'FlushDeferred()'.
+			 * Handle remains valid until then, so it's safe to release handles that are still used in current frame.
+			 */
+			void ReleaseDeferred(AssetHandle handle);
+
+			/**
+			 * Release all handles that were released with 'ReleaseDeferred()'.
+			 */
+			void FlushDeferred();
+
+			/**
+			 * Release all handles.
+			 */
+			void Clear();
+
+			/**
+			 * Get existing handle of an asset, without adding a reference to it.
+			 *
+			 * \return Asset handle, or InvalidAssetHandle if asset is not registered.
+			 */
+			AssetHandle Find(const IAsset* asset) const;
+
+			/**
+			 * Get if handle points to a registered asset.
+			 */
+			bool IsValid(AssetHandle handle) const;
+
+			/**
+			 * Get asset by handle, without type.
+			 *
+			 * \return Asset, or nullptr if handle is invalid.
+			 */
+			IAsset* Resolve(AssetHandle handle) const;
+
+			/**
+			 * Get typed asset by handle.
+			 * Return an empty pointer if handle is invalid or of a different type.
+			 */
+			inline const ImageAsset& GetImage(AssetHandle handle) const { return _images.Get(Index(handle), GenerationFor(handle, AssetTypes::Image)); }
+			inline const SoundAsset& GetSound(AssetHandle handle) const { return _sounds.Get(Index(handle), GenerationFor(handle, AssetTypes::Sound)); }
+			inline const MusicAsset& GetMusic(AssetHandle handle) const { return _music.Get(Index(handle), GenerationFor(handle, AssetTypes::Music)); }
+			inline const ConfigAsset& GetConfig(AssetHandle handle) const { return _configs.Get(Index(handle), GenerationFor(handle, AssetTypes::Config)); }
+			inline const FontAsset& GetFont(AssetHandle handle) const { return _fonts.Get(Index(handle), GenerationFor(handle, AssetTypes::Font)); }
+			inline const EffectAsset& GetEffect(AssetHandle handle) const { return _effects.Get(Index(handle), GenerationFor(handle, AssetTypes::Effect)); }
+
+			/**
+			 * Get how many handles are registered.
+			 */
+			size_t Count() const;
+
+		private:
+
+			/**
+			 * Build handle from its parts.
+			 */
+			static inline AssetHandle MakeHandle(uint32_t index, AssetTypes type, uint32_t generation) { return (generation << (IndexBits + TypeBits)) | (((uint32_t)type & TypeMask) << IndexBits) | (index & IndexMask); }
+
+			/**
+			 * Get handle parts.
+			 */
+			static inline uint32_t Index(AssetHandle handle) { return handle & IndexMask; }
+			static inline AssetTypes Type(AssetHandle handle) { return (AssetTypes)((handle >> IndexBits) & TypeMask); }
+			static inline uint32_t Generation(AssetHandle handle) { return handle >> (IndexBits + TypeBits); }
+
+			/**
+			 * Get handle generation if handle is of the given type, or 0 (which never matches a slot) otherwise.
+			 */
+			static inline uint32_t GenerationFor(AssetHandle handle, AssetTypes type) { return Type(handle) == type ? Generation(handle) : 0; }
+		};
+	}
+}
\ No newline at end of file
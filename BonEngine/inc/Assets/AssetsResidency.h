@@ -0,0 +1,139 @@
+/*****************************************************************//**
+ * \file   AssetsResidency.h
+ * \brief  Assets cache with memory budgets and LRU eviction.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "Defs.h"
+#include <list>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace bon
+{
+	namespace assets
+	{
+		/**
+		 * Keeps the assets cache, and decides which cached assets stay in memory.
+		 * Cached assets are held strongly, and ordered by how recently they were requested.
+		 * When a type goes over its memory budget, least recently requested assets that nobody else references are evicted.
+		 * Evicted or cleared assets that are still referenced elsewhere stay in cache as weak entries, so loading them again won't create duplicates.
+		 * Not thread safe - caller should lock.
+		 */
+		class AssetsResidency
+		{
+		private:
+
+			// a cache entry
+			struct Entry
+			{
+				// cache key
+				std::string Key;
+
+				// asset type
+				AssetTypes Type;
+
+				// strong reference (empty for weak entries) and weak reference
+				AssetPtr Strong;
+				std::weak_ptr<IAsset> Weak;
+
+				// asset address, for reverse lookup
+				const IAsset* Asset;
+
+				// estimated memory, in bytes
+				size_t RamBytes;
+				size_t VramBytes;
+			};
+
+			// entries, most recently requested first
+			std::list<Entry> _entries;
+
+			// lookup entries by key and by asset
+			std::unordered_map<std::string, std::list<Entry>::iterator> _byKey;
+			std::unordered_map<const IAsset*, std::list<Entry>::iterator> _byAsset;
+
+			// stats per type
+			AssetsCacheStats _stats[(int)AssetTypes::_Count];
+
+		public:
+
+			/**
+			 * Get asset from cache, and mark it as recently used.
+			 *
+			 * \param key Cache key.
+			 * \return Asset, or nullptr if not in cache.
+			 */
+			AssetPtr Get(const char* key);
+
+			/**
+			 * Put asset in cache.
+			 *
+			 * \param asset Asset to add.
+			 * \param key Cache key.
+			 */
+			void Put(const AssetPtr& asset, const char* key);
+
+			/**
+			 * Remove asset's entry, if in cache. Called when asset is disposed.
+			 *
+			 * \param asset Asset to remove.
+			 * \return True if asset was held strongly by cache (should not happen for disposed assets).
+			 */
+			bool Remove(const IAsset* asset);
+
+			/**
+			 * Refresh cached assets memory usage, then evict least recently requested assets that only the cache references, until all types are within budget.
+			 *
+			 * \param outReleased Evicted assets are moved here, so caller can release them after unlocking.
+			 */
+			void Evict(std::vector<AssetPtr>& outReleased);
+
+			/**
+			 * Release all strong references, turning all entries into weak entries.
+			 *
+			 * \param outReleased Released assets are moved here, so caller can release them after unlocking.
+			 */
+			void Clear(std::vector<AssetPtr>& outReleased);
+
+			/**
+			 * Set memory budgets for an asset type.
+			 *
+			 * \param type Asset type.
+			 * \param ramBytes System memory budget, in bytes (0 = unlimited).
+			 * \param vramBytes Video memory budget, in bytes (0 = unlimited).
+			 */
+			void SetBudget(AssetTypes type, size_t ramBytes, size_t vramBytes);
+
+			/**
+			 * Get cache stats for an asset type.
+			 */
+			inline const AssetsCacheStats& Stats(AssetTypes type) const { return _stats[(int)type]; }
+
+		private:
+
+			/**
+			 * Refresh memory usage of strong entries and update stats totals.
+			 * Assets memory may change after they're cached, for example streamed images start as a placeholder and grow as levels are loaded.
+			 */
+			void RefreshMemoryUsage();
+
+			/**
+			 * Get if a type is over its memory budget.
+			 */
+			bool OverBudget(AssetTypes type) const;
+
+			/**
+			 * Turn entry into a weak entry, moving its strong reference out.
+			 */
+			void Demote(Entry& entry, std::vector<AssetPtr>& outReleased);
+
+			/**
+			 * Remove entry from cache, and return the entry after it.
+			 */
+			std::list<Entry>::iterator Erase(std::list<Entry>::iterator entry);
+		};
+	}
+}
\ No newline at end of file
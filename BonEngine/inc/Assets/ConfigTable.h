@@ -0,0 +1,208 @@
+/*****************************************************************//**
+ * \file   ConfigTable.h
+ * \brief  Compiled config values, with interned keys and pre-parsed types.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "Defs.h"
+#include "../Framework/PointF.h"
+#include "../Framework/Color.h"
+#include "../Framework/RectangleF.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace bon
+{
+	namespace assets
+	{
+		/**
+		 * Interns config section + key names into integer handles.
+		 * Keys are case insensitive (like ini files), and the same section and key always get the same handle, in all config assets.
+		 * Thread safe (lookups only take a shared lock). To get values by name in hot paths use ConfigTable::Find(), which doesn't need interning.
+		 */
+		class BON_DLLEXPORT ConfigKeys
+		{
+		public:
+
+			/**
+			 * Get handle for section and key, creating a new handle if needed.
+			 *
+			 * \param section Section name.
+			 * \param name Key name.
+			 * \return Key handle.
+			 */
+			static ConfigKey Get(const char* section, const char* name);
+
+			/**
+			 * Get handle for section and key, without creating a new handle.
+			 *
+			 * \param section Section name.
+			 * \param name Key name.
+			 * \return Key handle, or InvalidConfigKey if section and key were never interned.
+			 */
+			static ConfigKey Find(const char* section, const char* name);
+
+			/**
+			 * Get section name of a key handle (lower case).
+			 */
+			static const char* Section(ConfigKey key);
+
+			/**
+			 * Get key name of a key handle (lower case).
+			 */
+			static const char* Name(ConfigKey key);
+		};
+
+		/**
+		 * Value types a config value was successfully parsed as.
+		 */
+		enum ConfigValueTypes : uint32_t
+		{
+			ConfigValueInt = 1 << 0,
+			ConfigValueFloat = 1 << 1,
+			ConfigValueBool = 1 << 2,
+			ConfigValuePoint = 1 << 3,
+			ConfigValueColor = 1 << 4,
+			ConfigValueRect = 1 << 5,
+		};
+
+		/**
+		 * A config value, with its string and all the types it could be parsed as.
+		 */
+		struct BON_DLLEXPORT ConfigValue
+		{
+			// original string value
+			std::string Str;
+
+			// which of the typed values below are valid (ConfigValueTypes flags)
+			uint32_t Types = 0;
+
+			// typed values
+			long Int = 0;
+			float Float = 0.0f;
+			bool Bool = false;
+			framework::PointF Point;
+			framework::Color Color;
+			framework::RectangleF Rect;
+
+			/**
+			 * Set string and parse all typed values from it.
+			 */
+			void Parse(const char* value);
+
+			/**
+			 * Get if value was parsed as type.
+			 */
+			inline bool Is(ConfigValueTypes type) const { return (Types & type) != 0; }
+		};
+
+#pragma warning ( push )
+#pragma warning ( disable: 4251 )
+		/**
+		 * Table of compiled config values, looked up by key handles.
+		 * Can be saved to a binary file and loaded back without parsing text, see 'CompiledConfigFolder' feature.
+		 *
+		 * Compiled file format (little endian):
+		 *	Header: magic, version, source size, source mtime, entries count.
+		 *	Entries: section, key and string value (uint32 length + chars), types, int (int64), float, bool (uint8), point, color and rect (floats).
+		 */
+		class BON_DLLEXPORT ConfigTable
+		{
+		public:
+
+			/**
+			 * A value in table, with its original section and key names.
+			 */
+			struct Entry
+			{
+				std::string Section;
+				std::string Name;
+				ConfigKey Key;
+				ConfigValue Value;
+			};
+
+		private:
+
+			// all entries
+			std::vector<Entry> _entries;
+
+			// entry index by key handle
+			std::unordered_map<ConfigKey, size_t> _index;
+
+			// entry index by case insensitive hash of section and key names, to get values by name without locking or building lower case keys
+			std::unordered_map<uint64_t, size_t> _nameIndex;
+
+			/**
+			 * Add entry to index by name.
+			 */
+			void IndexName(size_t index);
+
+		public:
+
+			/**
+			 * Set a value (parse it and intern its key).
+			 */
+			void Set(const char* section, const char* name, const char* value);
+
+			/**
+			 * Remove a value.
+			 */
+			void Remove(const char* section, const char* name);
+
+			/**
+			 * Remove all values.
+			 */
+			void Clear();
+
+			/**
+			 * Get value by key handle.
+			 *
+			 * \return Value, or nullptr if not in table.
+			 */
+			inline const ConfigValue* Get(ConfigKey key) const
+			{
+				auto found = _index.find(key);
+				return found != _index.end() ? &_entries[found->second].Value : nullptr;
+			}
+
+			/**
+			 * Get value by section and key names (case insensitive).
+			 * Doesn't lock or allocate, so its faster than getting key handle with ConfigKeys::Find() first.
+			 *
+			 * \return Value, or nullptr if not in table.
+			 */
+			const ConfigValue* Find(const char* section, const char* name) const;
+
+			/**
+			 * Get all entries.
+			 */
+			inline const std::vector<Entry>& Entries() const { return _entries; }
+
+			/**
+			 * Get if compiled configs are enabled (when 'CompiledConfigFolder' feature is set).
+			 */
+			static bool IsCompiledEnabled();
+
+			/**
+			 * Try to load table from compiled config folder.
+			 *
+			 * \param path Source ini file path.
+			 * \return True if found a valid compiled file and loaded it.
+			 */
+			bool LoadCompiled(const char* path);
+
+			/**
+			 * Save table to compiled config folder.
+			 *
+			 * \param path Source ini file path.
+			 */
+			void SaveCompiled(const char* path) const;
+		};
+#pragma warning (pop)
+	}
+}
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 #include "../dllimport.h"
 #include <memory>
+#include <cstdint>
 
 namespace bon
 {
@@ -46,6 +47,28 @@ namespace bon
 		typedef BON_DLLEXPORT std::shared_ptr<_Font>	FontAsset;
 		typedef BON_DLLEXPORT std::shared_ptr<_Effect>	EffectAsset;
 
+		/**
+		 * Handle to an asset registered in the assets registry.
+		 * A plain integer that encodes slot index, asset type and slot generation, so handles to released assets are detected.
+		 */
+		typedef BON_DLLEXPORT uint32_t AssetHandle;
+
+		/**
+		 * Define handle for no asset / errors.
+		 */
+		static const AssetHandle InvalidAssetHandle = 0;
+
+		/**
+		 * Handle to an interned config section + key, for fast config lookups without strings.
+		 * Get it once with '_Config::Key()' and reuse it.
+		 */
+		typedef BON_DLLEXPORT uint32_t ConfigKey;
+
+		/**
+		 * Define handle for no config key.
+		 */
+		static const ConfigKey InvalidConfigKey = 0;
+
 		/**
 		 * Struct used to hold initializer, disposer and context.
 		 */
@@ -69,5 +92,55 @@ namespace bon
 			Effect,
 			_Count
 		};
+
+		/**
+		 * How sound assets keep their samples in memory.
+		 */
+		enum class BON_DLLEXPORT SoundStorage
+		{
+			// compressed if file size is at least 'CompressedSoundsMinSize' feature, decoded otherwise
+			Auto = 0,
+
+			// decode the whole sound when loading (takes more memory, but cheapest to play)
+			Decoded = 1,
+
+			// keep the sound compressed in memory, and decode it on a worker thread while playing (supports ogg and wav files)
+			Compressed = 2,
+		};
+
+		/**
+		 * How image assets are loaded.
+		 */
+		enum class BON_DLLEXPORT ImageStreaming
+		{
+			// decode and upload the whole image when loading
+			Disabled = 0,
+
+			// return immediately with a placeholder, and stream the level of detail that matches the image on-screen size on worker threads
+			Progressive = 1,
+		};
+
+		/**
+		 * Assets cache residency stats, per asset type.
+		 */
+		struct BON_DLLEXPORT AssetsCacheStats
+		{
+			// assets held by cache
+			size_t CachedAssets = 0;
+
+			// assets in cache that were evicted or cleared, but are still alive because other code holds them
+			size_t WeakAssets = 0;
+
+			// estimated memory of assets held by cache, in bytes
+			size_t RamBytes = 0;
+			size_t VramBytes = 0;
+
+			// memory budgets, in bytes (0 = unlimited)
+			size_t RamBudget = 0;
+			size_t VramBudget = 0;
+
+			// total assets evicted from cache to stay within budget
+			size_t Evictions = 0;
+		};
 	}
 }
\ No newline at end of file
@@ -36,9 +36,10 @@ namespace bon
 			 * \param filename Image file path.
 			 * \param filter Image filtering mode.
 			 * \param useCache If true, will try to get asset from cache first. If not found in cache will add to cache after load.
+			 * \param streaming If progressive, will return immediately with a placeholder and stream the image level of detail by its on-screen size.
 			 * \return Image asset.
 			 */
-			virtual ImageAsset LoadImage(const char* filename, ImageFilterMode filter = ImageFilterMode::Nearest, bool useCache = true) = 0;
+			virtual ImageAsset LoadImage(const char* filename, ImageFilterMode filter = ImageFilterMode::Nearest, bool useCache = true, ImageStreaming streaming = ImageStreaming::Disabled) = 0;
 
 			/**
 			 * Creates and return an empty image asset.
@@ -71,9 +72,10 @@ namespace bon
 			 *
 			 * \param filename Sound file path.
 			 * \param useCache If true, will try to get asset from cache first. If not found in cache will add to cache after load.
+			 * \param storage Decode sound on load, or keep it compressed in memory and decode while playing.
 			 * \return Image asset.
 			 */
-			virtual SoundAsset LoadSound(const char* filename, bool useCache = true) = 0;
+			virtual SoundAsset LoadSound(const char* filename, bool useCache = true, SoundStorage storage = SoundStorage::Auto) = 0;
 
 			/**
 			 * Load and return a font asset.
@@ -127,9 +129,85 @@ namespace bon
 			 */
 			virtual bool SaveConfig(ConfigAsset config, const char* filename) = 0;
 
+			/**
+			 * Set memory budgets for cached assets of a given type.
+			 * Once per frame, if cached assets of this type take more memory than the budget, least recently loaded assets that are not used outside the cache are evicted.
+			 * Assets that are still used elsewhere are never evicted, and count towards the budget.
+			 *
+			 * \param type Asset type.
+			 * \param ramBytes System memory budget, in bytes (0 = unlimited).
+			 * \param vramBytes Video memory budget, in bytes (0 = unlimited).
+			 */
+			virtual void SetCacheBudget(AssetTypes type, size_t ramBytes, size_t vramBytes) = 0;
+
+			/**
+			 * Get cache residency stats for a given asset type.
+			 *
+			 * \param type Asset type.
+			 * \return Cache stats (cached assets, their estimated memory, budgets and evictions).
+			 */
+			virtual AssetsCacheStats GetCacheStats(AssetTypes type) const = 0;
+
+			/**
+			 * Get an integer handle for an asset, and add a reference to it.
+			 * Handles are resolved with an array lookup and no reference counting, so they are cheap to store and pass around.
+			 * The asset is kept alive until all references acquired for its handle are released.
+			 *
+			 * \param asset Asset to get handle for.
+			 * \return Asset handle (same asset always gets the same handle while registered), or InvalidAssetHandle if asset is null.
+			 */
+			virtual AssetHandle AcquireHandle(const AssetPtr& asset) = 0;
+
+			/**
+			 * Release a reference acquired with 'AcquireHandle()'.
+			 *
+			 * \param handle Handle to release.
+			 * \param deferred If true, will release handle on next assets update, so it remains valid until the end of current frame.
+			 */
+			virtual void ReleaseHandle(AssetHandle handle, bool deferred = false) = 0;
+
+			/**
+			 * Get existing handle of an asset, without adding a reference to it.
+			 * The returned handle is borrowed: it stays valid only while someone else holds a reference acquired with 'AcquireHandle()'.
+			 *
+			 * \param asset Asset to find handle for.
+			 * \return Asset handle, or InvalidAssetHandle if asset is null or has no handle.
+			 */
+			virtual AssetHandle FindHandle(const AssetPtr& asset) const = 0;
+
+			/**
+			 * Get if an asset handle is valid.
+			 *
+			 * \param handle Handle to check.
+			 * \return True if handle points to a registered asset, false if it was released or is invalid.
+			 */
+			virtual bool IsHandleValid(AssetHandle handle) const = 0;
+
+			/**
+			 * Get asset by handle, without type.
+			 *
+			 * \param handle Asset handle.
+			 * \return Asset, or nullptr if handle is invalid.
+			 */
+			virtual IAsset* ResolveHandle(AssetHandle handle) const = 0;
+
+			/**
+			 * Get typed assets by handle.
+			 * Return an empty pointer if handle is invalid or points to an asset of a different type.
+			 *
+			 * \param handle Asset handle.
+			 * \return Asset pointer, held by the registry.
+			 */
+			virtual const ImageAsset& GetImage(AssetHandle handle) const = 0;
+			virtual const SoundAsset& GetSound(AssetHandle handle) const = 0;
+			virtual const MusicAsset& GetMusic(AssetHandle handle) const = 0;
+			virtual const ConfigAsset& GetConfig(AssetHandle handle) const = 0;
+			virtual const FontAsset& GetFont(AssetHandle handle) const = 0;
+			virtual const EffectAsset& GetEffect(AssetHandle handle) const = 0;
+
 			/**
 			 * Clear all assets from cache.
-			 * Note: this won't necessarily dispose all assets - assets that are still held in external code will survive.
+			 * Note: this won't necessarily dispose all assets - assets that are still held in external code will survive, and loading them again will return the same instance.
 			 * To free all assets, you need to release all pointers to them.
 			 */
 			virtual void ClearCache() = 0;
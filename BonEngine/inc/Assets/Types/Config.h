@@ -134,6 +134,79 @@ namespace bon
 			 */
 			framework::Color GetColor(const char* section, const char* name, const framework::Color& defaultVal) const;
 
+			/**
+			 * Get handle for a section and key, to read values without strings.
+			 * Handles are shared by all config assets, so get them once (for example when loading a scene) and reuse them.
+			 *
+			 * \param section Config section name.
+			 * \param name Config name.
+			 * \return Key handle.
+			 */
+			static ConfigKey Key(const char* section, const char* name) { return ConfigKeys::Get(section, name); }
+
+			/**
+			 * Get string value from config by key handle.
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as string.
+			 */
+			const char* GetStr(ConfigKey key, const char* defaultVal) const;
+
+			/**
+			 * Get bool value from config by key handle.
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as boolean.
+			 */
+			bool GetBool(ConfigKey key, bool defaultVal) const;
+
+			/**
+			 * Get integer value from config by key handle.
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as integer.
+			 */
+			long GetInt(ConfigKey key, int defaultVal) const;
+
+			/**
+			 * Get float value from config by key handle.
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as float.
+			 */
+			float GetFloat(ConfigKey key, float defaultVal) const;
+
+			/**
+			 * Get point value from config by key handle (format: "x,y").
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as PointF.
+			 */
+			framework::PointF GetPointF(ConfigKey key, const framework::PointF& defaultVal) const;
+
+			/**
+			 * Get rectangle value from config by key handle (format: "x,y,w,h").
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as RectangleF.
+			 */
+			framework::RectangleF GetRectangleF(ConfigKey key, const framework::RectangleF& defaultVal) const;
+
+			/**
+			 * Get color value from config by key handle (format: "r,g,b,a" where values range from 0 to 255).
+			 *
+			 * \param key Key handle (see 'Key()').
+			 * \param defaultVal Default value to retrieve if not found.
+			 * \return Config value as Color.
+			 */
+			framework::Color GetColor(ConfigKey key, const framework::Color& defaultVal) const;
+
 			/**
 			 * Get the index of the selected option from options list.
 			 * For example, if options provided are ["dog", "cat", "mouse"], and value is "cat", will return 1.
@@ -9,6 +9,7 @@
 #include "../../dllimport.h"
 #include "IAsset.h"
 #include "../Defs.h"
+#include "../ConfigTable.h"
 #include <string>
 #include <set>
 
@@ -70,6 +71,29 @@ namespace bon
 			 */
 			virtual float GetFloat(const char* section, const char* name, float defaultVal) const = 0;
 
+			/**
+			 * Get if this handle supports getting compiled values by key handles.
+			 * If not, config will get values by the key section and name.
+			 */
+			virtual bool HaveCompiledValues() const { return false; }
+
+			/**
+			 * Get compiled value by key handle.
+			 *
+			 * \param key Key handle.
+			 * \return Compiled value, or nullptr if not found.
+			 */
+			virtual const ConfigValue* GetValue(ConfigKey /*key*/) const { return nullptr; }
+
+			/**
+			 * Get compiled value by section and key names.
+			 *
+			 * \param section Config section name.
+			 * \param name Config name.
+			 * \return Compiled value, or nullptr if not found.
+			 */
+			virtual const ConfigValue* GetValue(const char* /*section*/, const char* /*name*/) const { return nullptr; }
+
 			/**
 			 * Get set with all section names.
 			 */
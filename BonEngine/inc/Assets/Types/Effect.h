@@ -64,6 +64,26 @@ namespace bon
 				return _untypedHandle != nullptr && Handle()->IsValid();
 			}
 
+			/**
+			 * Return if this effect is compiled and ready to use.
+			 * Effects that are compiled lazily will return false until first used or warmed up.
+			 *
+			 * \return True if effect is compiled.
+			 */
+			bool IsCompiled() const
+			{
+				return Handle()->IsCompiled();
+			}
+
+			/**
+			 * Compile effect now, if not already compiled.
+			 * Use this during loading screens to avoid compiling effect on first use.
+			 */
+			void Compile()
+			{
+				Handle()->Compile();
+			}
+
 			/**
 			 * Return if this effect uses textures.
 			 * 
@@ -207,7 +227,7 @@ namespace bon
 			void SetUniformMatrix3(const char* name, int count, bool transpose, const float* values)
 			{
 				ValidateActive();
-				Handle()->SetUniformMatrix2(name, count, transpose, values);
+				Handle()->SetUniformMatrix3(name, count, transpose, values);
 			}
 
 			/**
@@ -216,7 +236,146 @@ namespace bon
 			void SetUniformMatrix4(const char* name, int count, bool transpose, const float* values)
 			{
 				ValidateActive();
-				Handle()->SetUniformMatrix2(name, count, transpose, values);
+				Handle()->SetUniformMatrix4(name, count, transpose, values);
+			}
+
+			/**
+			 * Get a uniform handle by name.
+			 * Setting uniforms with handles skip the name lookup, and don't require the effect to be active: values are staged and uploaded when effect is used.
+			 * 
+			 * \param name Uniform name.
+			 * \return Uniform handle.
+			 */
+			UniformHandle GetUniformHandle(const char* name)
+			{
+				return Handle()->GetUniformHandle(name);
+			}
+
+			/**
+			 * Set float uniform.
+			 */
+			void SetUniformFloat(UniformHandle uniform, float value)
+			{
+				Handle()->SetUniformFloat(uniform, value);
+			}
+
+			/**
+			 * Set vector2 uniform.
+			 */
+			void SetUniformVector2(UniformHandle uniform, float x, float y)
+			{
+				Handle()->SetUniformVector2(uniform, x, y);
+			}
+
+			/**
+			 * Set vector3 uniform.
+			 */
+			void SetUniformVector3(UniformHandle uniform, float x, float y, float z)
+			{
+				Handle()->SetUniformVector3(uniform, x, y, z);
+			}
+
+			/**
+			 * Set vector4 uniform.
+			 */
+			void SetUniformVector4(UniformHandle uniform, float x, float y, float z, float w)
+			{
+				Handle()->SetUniformVector4(uniform, x, y, z, w);
+			}
+
+			/**
+			 * Set int uniform.
+			 */
+			void SetUniformInt(UniformHandle uniform, int value)
+			{
+				Handle()->SetUniformInt(uniform, value);
+			}
+
+			/**
+			 * Set vector2 uniform.
+			 */
+			void SetUniformVector2(UniformHandle uniform, int x, int y)
+			{
+				Handle()->SetUniformVector2(uniform, x, y);
+			}
+
+			/**
+			 * Set vector3 uniform.
+			 */
+			void SetUniformVector3(UniformHandle uniform, int x, int y, int z)
+			{
+				Handle()->SetUniformVector3(uniform, x, y, z);
+			}
+
+			/**
+			 * Set vector4 uniform.
+			 */
+			void SetUniformVector4(UniformHandle uniform, int x, int y, int z, int w)
+			{
+				Handle()->SetUniformVector4(uniform, x, y, z, w);
+			}
+
+			/**
+			 * Set color uniform.
+			 */
+			void SetUniformColor(UniformHandle uniform, const bon::framework::Color& color, bool includeAlpha)
+			{
+				if (includeAlpha)
+				{
+					SetUniformVector4(uniform, color.R, color.G, color.B, color.A);
+				}
+				else
+				{
+					SetUniformVector3(uniform, color.R, color.G, color.B);
+				}
+			}
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			void SetUniformMatrix2(UniformHandle uniform, int count, bool transpose, const float* values)
+			{
+				Handle()->SetUniformMatrix2(uniform, count, transpose, values);
+			}
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			void SetUniformMatrix3(UniformHandle uniform, int count, bool transpose, const float* values)
+			{
+				Handle()->SetUniformMatrix3(uniform, count, transpose, values);
+			}
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			void SetUniformMatrix4(UniformHandle uniform, int count, bool transpose, const float* values)
+			{
+				Handle()->SetUniformMatrix4(uniform, count, transpose, values);
+			}
+
+			/**
+			 * Get a uniform block handle by name.
+			 * 
+			 * \param name Uniform block name.
+			 * \return Uniform block handle.
+			 */
+			UniformBlockHandle GetUniformBlockHandle(const char* name)
+			{
+				return Handle()->GetUniformBlockHandle(name);
+			}
+
+			/**
+			 * Set uniform block data, to upload as a uniform buffer.
+			 * Only works if uniform buffers are supported by the driver, and block data must match the shader layout (use std140).
+			 * 
+			 * \param block Uniform block handle.
+			 * \param data Block data.
+			 * \param size Data size in bytes.
+			 */
+			void SetUniformBlockData(UniformBlockHandle block, const void* data, size_t size)
+			{
+				Handle()->SetUniformBlockData(block, data, size);
 			}
 
 			/**
@@ -7,12 +7,47 @@
  *********************************************************************/
 #pragma once
 #include "../../dllimport.h"
+#include <cstddef>
 
 
 namespace bon
 {
 	namespace assets
 	{
+		/**
+		 * A resolved uniform of an effect.
+		 * Get it once with 'GetUniformHandle()' and use it to set uniform values without looking up the uniform name on every call.
+		 */
+		struct BON_DLLEXPORT UniformHandle
+		{
+			/**
+			 * Uniform index in effect, or -1 if invalid.
+			 */
+			int Id = -1;
+
+			/**
+			 * Get if this handle is valid.
+			 */
+			inline bool IsValid() const { return Id >= 0; }
+		};
+
+		/**
+		 * A resolved uniform block of an effect.
+		 * Uniform blocks are uploaded as uniform buffer objects, when supported by the driver.
+		 */
+		struct BON_DLLEXPORT UniformBlockHandle
+		{
+			/**
+			 * Uniform block index in effect, or -1 if invalid.
+			 */
+			int Id = -1;
+
+			/**
+			 * Get if this handle is valid.
+			 */
+			inline bool IsValid() const { return Id >= 0; }
+		};
+
 		/**
 		 * Define the interface for an effect internal handle.
 		 * To create new effect asset types, you must implement this API.
@@ -118,10 +153,113 @@ namespace bon
 			 */
 			virtual void SetUniformMatrix4(const char* name, int count, bool transpose, const float* values) = 0;
 
+			/**
+			 * Resolve a uniform by name and return its handle.
+			 * Uniform values set with handles are staged, and only changed values are uploaded when effect is bound or before drawing.
+			 *
+			 * \param name Uniform name.
+			 * \return Uniform handle.
+			 */
+			virtual UniformHandle GetUniformHandle(const char* name) = 0;
+
+			/**
+			 * Set float uniform.
+			 */
+			virtual void SetUniformFloat(UniformHandle uniform, float value) = 0;
+
+			/**
+			 * Set vector2 uniform.
+			 */
+			virtual void SetUniformVector2(UniformHandle uniform, float x, float y) = 0;
+
+			/**
+			 * Set vector3 uniform.
+			 */
+			virtual void SetUniformVector3(UniformHandle uniform, float x, float y, float z) = 0;
+
+			/**
+			 * Set vector4 uniform.
+			 */
+			virtual void SetUniformVector4(UniformHandle uniform, float x, float y, float z, float w) = 0;
+
+			/**
+			 * Set int uniform.
+			 */
+			virtual void SetUniformInt(UniformHandle uniform, int value) = 0;
+
+			/**
+			 * Set vector2 uniform.
+			 */
+			virtual void SetUniformVector2(UniformHandle uniform, int x, int y) = 0;
+
+			/**
+			 * Set vector3 uniform.
+			 */
+			virtual void SetUniformVector3(UniformHandle uniform, int x, int y, int z) = 0;
+
+			/**
+			 * Set vector4 uniform.
+			 */
+			virtual void SetUniformVector4(UniformHandle uniform, int x, int y, int z, int w) = 0;
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			virtual void SetUniformMatrix2(UniformHandle uniform, int count, bool transpose, const float* values) = 0;
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			virtual void SetUniformMatrix3(UniformHandle uniform, int count, bool transpose, const float* values) = 0;
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			virtual void SetUniformMatrix4(UniformHandle uniform, int count, bool transpose, const float* values) = 0;
+
+			/**
+			 * Resolve a uniform block by name and return its handle.
+			 *
+			 * \param name Uniform block name, as declared in shader.
+			 * \return Uniform block handle.
+			 */
+			virtual UniformBlockHandle GetUniformBlockHandle(const char* name) = 0;
+
+			/**
+			 * Set uniform block data.
+			 * Data is copied and uploaded as a uniform buffer when effect is bound or before drawing.
+			 *
+			 * \param block Uniform block handle.
+			 * \param data Block data (must match the block layout in shader, std140 is recommended).
+			 * \param size Data size in bytes.
+			 */
+			virtual void SetUniformBlockData(UniformBlockHandle block, const void* data, size_t size) = 0;
+
+			/**
+			 * Upload all staged uniforms that changed since last upload.
+			 * Called internally by the renderer when the effect is bound and before drawing.
+			 *
+			 * \param justBound True if effect program was just bound.
+			 */
+			virtual void FlushUniforms(bool justBound) = 0;
+
 			/**
 			 * Get this effect's program handle.
 			 */
 			virtual void* GetProgramHandle() const = 0;
+
+			/**
+			 * Get if this effect program is compiled and ready to use.
+			 * Effects that are compiled lazily will return false until first used.
+			 *
+			 * \return If effect program is compiled.
+			 */
+			virtual bool IsCompiled() const { return true; }
+
+			/**
+			 * Compile the effect program, if not already compiled.
+			 */
+			virtual void Compile() {}
 		};
 	}
 }
\ No newline at end of file
@@ -91,6 +91,14 @@ namespace bon
 			 * \return Asset type identifier.
 			 */
 			virtual AssetTypes AssetType() const = 0;
+
+			/**
+			 * Get estimated memory this asset takes.
+			 *
+			 * \param vram If true, will return video memory size, if false will return system memory size.
+			 * \return Estimated memory size, in bytes.
+			 */
+			virtual size_t MemoryUsage(bool /*vram*/) const { return 0; }
 		};
 	}
 }
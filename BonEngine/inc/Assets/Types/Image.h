@@ -97,6 +97,11 @@ namespace bon
 			 */
 			virtual AssetTypes AssetType() const override { return AssetTypes::Image; }
 
+			/**
+			 * Get estimated memory this image takes (texture in video memory, 4 bytes per pixel).
+			 */
+			virtual size_t MemoryUsage(bool vram) const override { return (vram && IsValid()) ? Handle()->MemoryUsage() : 0; }
+
 			/**
 			 * Get image filtering mode.
 			 * 
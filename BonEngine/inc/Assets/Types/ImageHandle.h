@@ -58,6 +58,13 @@ namespace bon
 			 */
 			virtual bool HaveAlphaChannel() const = 0;
 
+			/**
+			 * Get video memory used by the image texture, in bytes.
+			 *
+			 * \return Texture size.
+			 */
+			virtual size_t MemoryUsage() const { return (size_t)Width() * (size_t)Height() * 4; }
+
 			/**
 			 * Save image asset to file.
 			 *
@@ -10,6 +10,7 @@
 #include "IAsset.h"
 #include "../Defs.h"
 #include "SoundHandle.h"
+#include "../../Sfx/Defs.h"
 
 
 namespace bon
@@ -22,6 +23,16 @@ namespace bon
 		 */
 		class BON_DLLEXPORT _Sound : public IAsset
 		{
+		private:
+
+			// mix bus to play this sound on
+			sfx::SoundBus _bus = sfx::SoundBus::Sfx;
+
+			// voice management settings
+			int _priority = 0;
+			int _maxInstances = 0;
+			sfx::VoiceStealPolicy _stealPolicy = sfx::VoiceStealPolicy::Oldest;
+
 		public:
 
 			/**
@@ -58,6 +69,11 @@ namespace bon
 			 */
 			virtual AssetTypes AssetType() const override { return AssetTypes::Sound; }
 
+			/**
+			 * Get estimated memory this sound takes (samples, or compressed data, in system memory).
+			 */
+			virtual size_t MemoryUsage(bool vram) const override { return (!vram && IsValid()) ? Handle()->MemoryUsage() : 0; }
+
 			/**
 			 * Get track length, in seconds.
 			 *
@@ -69,6 +85,56 @@ namespace bon
 			* Get if this sound is currently playing.
 			*/
 			bool IsPlaying() const { return Handle()->IsPlaying(); }
+
+			/**
+			 * Set the mix bus to play this sound on.
+			 * Affects sounds played after calling this.
+			 *
+			 * \param bus Mix bus (default is Sfx).
+			 */
+			inline void SetBus(sfx::SoundBus bus) { _bus = bus; }
+
+			/**
+			 * Get the mix bus this sound plays on.
+			 */
+			inline sfx::SoundBus Bus() const { return _bus; }
+
+			/**
+			 * Set sound priority.
+			 * When all voices are in use, higher priority sounds steal voices from lower priority sounds, and are mixed first.
+			 *
+			 * \param priority Sound priority (default is 0).
+			 */
+			inline void SetPriority(int priority) { _priority = priority; }
+
+			/**
+			 * Get sound priority.
+			 */
+			inline int Priority() const { return _priority; }
+
+			/**
+			 * Set how many instances of this sound can play at the same time.
+			 *
+			 * \param maxInstances Max instances (0 = no limit).
+			 */
+			inline void SetMaxInstances(int maxInstances) { _maxInstances = maxInstances; }
+
+			/**
+			 * Get how many instances of this sound can play at the same time (0 = no limit).
+			 */
+			inline int MaxInstances() const { return _maxInstances; }
+
+			/**
+			 * Set what to do when playing this sound and it reached its max instances, or all voices are in use.
+			 *
+			 * \param policy Voice stealing policy (default is Oldest).
+			 */
+			inline void SetStealPolicy(sfx::VoiceStealPolicy policy) { _stealPolicy = policy; }
+
+			/**
+			 * Get voice stealing policy.
+			 */
+			inline sfx::VoiceStealPolicy StealPolicy() const { return _stealPolicy; }
 		};
 	}
 }
\ No newline at end of file
@@ -40,6 +40,13 @@ namespace bon
 			 */
 			virtual float Length() const = 0;
 
+			/**
+			 * Get memory used by the sound data, in bytes.
+			 *
+			 * \return Sound data size.
+			 */
+			virtual size_t MemoryUsage() const { return 0; }
+
 			/**
 			* Get if this sound is currently playing.
 			*/
@@ -51,6 +51,111 @@ namespace bon
 		 * If true, will floor drawing positions, and ceiling drawing size.
 		 */
 		bool RoundPixels = true;
+
+		/**
+		 * If set, will store compiled shader program binaries in this folder and reuse them on next runs, instead of compiling effects from source.
+		 * Cached binaries are keyed by shaders source and GPU driver, and will be recompiled automatically if invalid.
+		 * Set to nullptr to disable shaders cache.
+		 */
+		const char* ShaderCacheFolder = nullptr;
+
+		/**
+		 * If true, effects will only be compiled when first used, or when calling 'Gfx().WarmUpEffects()'.
+		 * Useful to reduce loading time when loading a lot of effects at once.
+		 */
+		bool LazyEffectsCompilation = false;
+
+		/**
+		 * How many frames to wait before reading pixels requested with 'Gfx().ReadPixelsAsync()'.
+		 * Higher values reduce the chance of waiting for the GPU, but take longer for pixels to be ready.
+		 */
+		int AsyncReadbackFrames = 2;
+
+		/**
+		 * If set, will start capturing frames to disk when main loop starts, using settings from this config file '[capture]' section.
+		 * Useful to record automated test runs without changing game code.
+		 */
+		const char* FrameCaptureConfig = nullptr;
+
+		/**
+		 * If set, will store decoded images pixels in this folder and load them on next runs, instead of decoding image files again.
+		 * Cached pixels are validated against source file size and modification time (or content, if modification time changed).
+		 * Set to nullptr to disable textures cache.
+		 */
+		const char* TextureCacheFolder = nullptr;
+
+		/**
+		 * If set, will store compiled config files (with pre-parsed values) in this folder and load them on next runs, instead of parsing ini files again.
+		 * Compiled configs are validated against source file size and modification time.
+		 * Set to nullptr to disable compiled configs.
+		 */
+		const char* CompiledConfigFolder = nullptr;
+
+		/**
+		 * Max bytes of textures pixels to upload to the GPU every frame, for uploads done in the background (like streamed images levels).
+		 * Set to 0 for no bytes limit.
+		 */
+		size_t TextureUploadBytesPerFrame = 4 * 1024 * 1024;
+
+		/**
+		 * Max time to spend on textures uploads every frame, in milliseconds, for uploads done in the background.
+		 * Set to 0 for no time limit.
+		 */
+		double TextureUploadTimePerFrame = 2.0;
+
+		/**
+		 * How many sounds can be mixed at the same time on the engine mixer.
+		 */
+		int AudioVoices = 32;
+
+		/**
+		 * How many extra sounds can play as virtual voices, which keep their position without being mixed.
+		 * Sounds become virtual when they are inaudible, or when there are more sounds playing than 'AudioVoices'.
+		 */
+		int AudioVirtualVoices = 128;
+
+		/**
+		 * If true, will not output audio to device, and the mixer will only render when calling 'Sfx().RenderOffline()'.
+		 * Useful to benchmark or test audio on machines without an audio device. Music is not rendered in this mode.
+		 * Note: if audio device fails to open, offline mode will be used automatically.
+		 */
+		bool OfflineAudio = false;
+
+		/**
+		 * Sound files of this size or bigger (in bytes) will be kept compressed in memory and decoded while playing,
+		 * unless a different storage is requested when loading them. Set to 0 to decode all sounds on load.
+		 * Useful for long ambience and dialog sounds, that take a lot of memory when decoded.
+		 */
+		size_t CompressedSoundsMinSize = 0;
+
+		/**
+		 * If true, UI elements will be allocated from memory arenas instead of the heap. Every root element gets its own arena, 
+		 * which is used for all elements created with a parent in that tree. Elements created without parent use a shared arena.
+		 * Makes building and destroying big UI trees cheaper, but elements must be created and destroyed on the main thread.
+		 */
+		bool UIArenaAllocation = false;
+
+		/**
+		 * If set, will record input events, frames delta time and cursor state into this file from the moment main loop starts.
+		 * Replay recorded sessions with 'InputReplayPath'.
+		 */
+		const char* InputRecordPath = nullptr;
+
+		/**
+		 * If set, will replay input recorded with 'InputRecordPath' from this file, and stop the engine when replay ends.
+		 * While replaying, live input is ignored and frames don't wait for real time, so the same session can be used to benchmark and compare builds.
+		 */
+		const char* InputReplayPath = nullptr;
+
+		/**
+		 * Fixed delta time to use for every replayed frame, in seconds. Set to 0 to use the recorded delta times.
+		 */
+		double InputReplayTimestep = 0.0;
+
+		/**
+		 * If set, will write the delta time and real time of every replayed frame to this file (CSV) when replay ends.
+		 */
+		const char* InputReplayReportPath = nullptr;
 	};
 
 	/**
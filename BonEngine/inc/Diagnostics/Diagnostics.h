@@ -27,6 +27,9 @@ namespace bon
 			// for counters
 			long _counters[(int)DiagnosticsCounters::_MaxCounters] = { 0 };
 
+			// for histograms
+			DiagnosticsHistogram _histograms[(int)DiagnosticsHistograms::_MaxHistograms];
+
 		protected:
 			/**
 			 * Called every frame.
@@ -65,6 +68,14 @@ namespace bon
 			 * \param counterId Counter id to reset.
 			 */
 			virtual void _ResetCounter(int counterId) override;
+
+			/**
+			 * Get histogram.
+			 *
+			 * \param histogramId Histogram id to get.
+			 * \return Histogram.
+			 */
+			virtual DiagnosticsHistogram& _GetHistogram(int histogramId) override;
 		};
 	}
 }
\ No newline at end of file
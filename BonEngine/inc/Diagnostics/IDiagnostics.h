@@ -33,11 +33,96 @@ namespace bon
 			   */
 			  LoadedAssets = 2,
 
+			  /**
+			   * Total frames captured and sent to encoders since frames capture started.
+			   */
+			  CapturedFrames = 3,
+
+			  /**
+			   * Total frames dropped by frames capture because encoders couldn't keep up.
+			   */
+			  DroppedCaptureFrames = 4,
+
+			  /**
+			   * Total times frames capture had to wait for encoders (when using 'Throttle' overflow mode).
+			   */
+			  ThrottledCaptureFrames = 5,
+
+			  /**
+			   * Sound voices currently mixed.
+			   */
+			  RealVoices = 6,
+
+			  /**
+			   * Sound voices currently playing without being mixed (inaudible or over the real voices limit).
+			   */
+			  VirtualVoices = 7,
+
+			  /**
+			   * Sound voices stolen during this frame, to play other sounds.
+			   */
+			  StolenVoices = 8,
+
+			  /**
+			   * Total audio callbacks since engine started.
+			   */
+			  AudioCallbacks = 9,
+
+			  /**
+			   * Total audio callbacks that took longer than the audio buffer duration, or came too late, so audio device probably ran out of samples.
+			   */
+			  AudioUnderruns = 10,
+
+			  /**
+			   * Total times a compressed sound played silence because its decoder didn't keep up.
+			   */
+			  AudioStreamUnderruns = 11,
+
+			  /**
+			   * Longest audio callback during last frame, in percent of the audio buffer duration.
+			   */
+			  AudioCallbackLoad = 12,
+
+			  /**
+			   * Longest time the mixer spent in buses DSP inserts for a single audio block during last frame, in microseconds.
+			   */
+			  AudioDspTime = 13,
+
+			  /**
+			   * Assets currently held by the assets cache.
+			   */
+			  CachedAssets = 14,
+
+			  /**
+			   * Estimated system memory of assets held by the assets cache, in KB.
+			   */
+			  CachedAssetsRamKB = 15,
+
+			  /**
+			   * Estimated video memory of assets held by the assets cache, in KB.
+			   */
+			  CachedAssetsVramKB = 16,
+
+			  /**
+			   * Total assets evicted from the assets cache to stay within memory budgets.
+			   */
+			  EvictedAssets = 17,
+
+			  /**
+			   * UI elements that clipped their children during this frame.
+			   */
+			  ClippedUIElements = 18,
+
+			  /**
+			   * UI elements skipped during this frame because they were entirely outside their parent clipping region.
+			   */
+			  CulledUIElements = 19,
+
 			  /**
 			   * Last built-in counter value.
 			   * If you want to add custom counters, start here and go up until 'MaxCounters'
 			   */
-			  _BuiltInCounterCount = 3,
+			  _BuiltInCounterCount = 20,
 
 			  /**
 			   * Max counters value.
@@ -45,6 +130,83 @@ namespace bon
 			  _MaxCounters = 50,
 		};
 
+		/**
+		 * Built in histograms we keep track on in diagnostics manager.
+		 */
+		enum class BON_DLLEXPORT DiagnosticsHistograms
+		{
+			/**
+			 * Audio callbacks time, in percent of the audio buffer duration.
+			 * Values above 100 mean the audio device probably ran out of samples.
+			 */
+			AudioCallbackLoad = 0,
+
+			/**
+			 * Last built-in histogram value.
+			 * If you want to add custom histograms, start here and go up until 'MaxHistograms'
+			 */
+			_BuiltInHistogramCount = 1,
+
+			/**
+			 * Max histograms value.
+			 */
+			_MaxHistograms = 10,
+		};
+
+		/**
+		 * Histogram of values, with fixed size buckets.
+		 */
+		struct BON_DLLEXPORT DiagnosticsHistogram
+		{
+			/**
+			 * Buckets count. Last bucket also counts all values beyond buckets range.
+			 */
+			static const int BucketsCount = 16;
+
+			/**
+			 * Values range of every bucket.
+			 */
+			long BucketSize = 10;
+
+			/**
+			 * Values count per bucket.
+			 */
+			long Buckets[BucketsCount] = { 0 };
+
+			/**
+			 * Total values count.
+			 */
+			long Count = 0;
+
+			/**
+			 * Biggest value added.
+			 */
+			long Max = 0;
+
+			/**
+			 * Add value to histogram.
+			 *
+			 * \param value Value to add.
+			 * \param count How many times to add it.
+			 */
+			inline void Add(long value, long count = 1)
+			{
+				long bucket = value / BucketSize;
+				Buckets[bucket < 0 ? 0 : (bucket >= BucketsCount ? BucketsCount - 1 : bucket)] += count;
+				Count += count;
+				if (value > Max) { Max = value; }
+			}
+
+			/**
+			 * Reset histogram values.
+			 */
+			inline void Reset()
+			{
+				for (auto& bucket : Buckets) { bucket = 0; }
+				Count = Max = 0;
+			}
+		};
+
 		/**
 		 * Interface for the diagnostics manager.
 		 * Used for FPS count and other debug methods.
@@ -75,7 +237,7 @@ namespace bon
 			 * \param counterId Counter id to get.
 			 * \param increaseBy How much to increase counter.
 			 */
-			inline void IncreaseCounter(DiagnosticsCounters counterId, int increaseBy = 1) { _IncreaseCounter((int)(counterId)); }
+			inline void IncreaseCounter(DiagnosticsCounters counterId, int increaseBy = 1) { _IncreaseCounter((int)(counterId), increaseBy); }
 
 			/**
 			 * Reset counter value.
@@ -84,6 +246,14 @@ namespace bon
 			 */
 			inline void ResetCounter(DiagnosticsCounters counterId) { _ResetCounter((int)(counterId)); }
 
+			/**
+			 * Get histogram.
+			 *
+			 * \param histogramId Histogram id to get.
+			 * \return Histogram, which you can also add values to or reset.
+			 */
+			inline DiagnosticsHistogram& GetHistogram(DiagnosticsHistograms histogramId) { return _GetHistogram((int)(histogramId)); }
+
 			/**
 			 * Get counter value.
 			 * 
@@ -107,6 +277,14 @@ namespace bon
 			 */
 			virtual void _ResetCounter(int counterId) = 0;
 
+			/**
+			 * Get histogram.
+			 *
+			 * \param histogramId Histogram id to get.
+			 * \return Histogram.
+			 */
+			virtual DiagnosticsHistogram& _GetHistogram(int histogramId) = 0;
+
 		protected:
 			/**
 			 * Get manager identifier.
@@ -26,6 +26,8 @@ namespace bon
 {
 	namespace engine
 	{
+		class InputRecorder;
+
 		/**
 		 * The main class that runs the BonEngine engine.
 		 * This is the class that gets instanciated and fire up the game main loop.
@@ -76,6 +78,9 @@ namespace bon
 			// total elapsed time since application started
 			double _elapsedTime = 0.0;
 
+			// input recorder, created when recording or replaying input
+			InputRecorder* _inputRecorder = nullptr;
+
 		public:
 
 			/**
@@ -299,6 +304,38 @@ namespace bon
 			 */
 			inline unsigned int SwitchedScenesCount() const { return _scenesSwitchCount; }
 
+			/**
+			 * Start recording input events, frames delta time and cursor state into a file, to replay later with 'InputReplayPath' feature.
+			 * Note: replay starts from the first scene, so for a deterministic replay use the 'InputRecordPath' feature to record from the start.
+			 *
+			 * \param path File to record to.
+			 */
+			void StartInputRecording(const char* path);
+
+			/**
+			 * Stop recording input.
+			 */
+			void StopInputRecording();
+
+			/**
+			 * Get if currently recording input.
+			 *
+			 * \return If recording input.
+			 */
+			bool IsRecordingInput() const;
+
+			/**
+			 * Get if currently replaying recorded input.
+			 *
+			 * \return If replaying input.
+			 */
+			bool IsReplayingInput() const;
+
+			/**
+			 * Get input recorder, or nullptr if never recorded or replayed input. Used internally.
+			 */
+			inline InputRecorder* _GetInputRecorder() const { return _inputRecorder; }
+
 		private:
 
 			/**
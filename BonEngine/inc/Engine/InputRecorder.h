@@ -0,0 +1,140 @@
+/*****************************************************************//**
+ * \file   InputRecorder.h
+ * \brief  Record input events to file and replay them deterministically.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "../Framework/Point.h"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+union SDL_Event;
+
+namespace bon
+{
+	namespace engine
+	{
+		/**
+		 * Record input events, frames delta time and cursor state into a binary file, and replay them.
+		 * While replaying, live input is ignored and every frame gets the recorded events, cursor and keyboard modifiers, with the recorded
+		 * delta time (or a fixed timestep), without waiting for real time. This makes a recorded session run the same way on every run and build,
+		 * so it can be used as a benchmark or a regression run.
+		 *
+		 * Recording file format (little endian):
+		 *	Header: magic, version.
+		 *	Frames: frame header (delta time, cursor position, keyboard modifiers, events count), then events (size (uint16) + event data).
+		 */
+		class InputRecorder
+		{
+		private:
+			// recording / replay file
+			std::ofstream _recordFile;
+			std::ifstream _replayFile;
+
+			// current frame data
+			double _deltaTime = 0;
+			framework::PointI _cursorPosition;
+			uint16_t _keyModifiers = 0;
+			uint16_t _eventsCount = 0;
+			std::vector<char> _events;
+
+			// replay events read position and index
+			size_t _eventsReadPos = 0;
+			uint16_t _eventIndex = 0;
+
+			// fixed timestep to use when replaying, or 0 to use recorded delta times
+			double _replayTimestep = 0;
+
+			// path to write replay frame times to, when replay ends
+			std::string _reportPath;
+
+			// measured replay frame times, in milliseconds, and when current frame started
+			std::vector<double> _frameTimes;
+			std::vector<double> _frameDeltas;
+			uint64_t _frameStartTime = 0;
+
+		public:
+
+			/**
+			 * Stop recording or replaying.
+			 */
+			~InputRecorder();
+
+			/**
+			 * Start recording input into a file.
+			 *
+			 * \param path File to record to.
+			 */
+			void StartRecording(const char* path);
+
+			/**
+			 * Start replaying input from a recording file.
+			 *
+			 * \param path Recording file to replay.
+			 * \param timestep Fixed delta time to use for every frame, or 0 to use the recorded delta times.
+			 * \param reportPath If not null, will write every replayed frame time to this file (CSV) when replay ends.
+			 */
+			void StartReplay(const char* path, double timestep, const char* reportPath);
+
+			/**
+			 * Stop recording or replaying.
+			 */
+			void Stop();
+
+			/**
+			 * Get if currently recording.
+			 */
+			inline bool IsRecording() const { return _recordFile.is_open(); }
+
+			/**
+			 * Get if currently replaying.
+			 */
+			inline bool IsReplaying() const { return _replayFile.is_open(); }
+
+			/**
+			 * Get cursor position of current frame.
+			 */
+			inline const framework::PointI& CursorPosition() const { return _cursorPosition; }
+
+			/**
+			 * Start a new frame.
+			 * When recording, store frame delta time and cursor state. When replaying, read next frame and replace delta time with its delta time.
+			 *
+			 * \param deltaTime Frame delta time (replaced when replaying).
+			 * \return False if replaying and there are no more frames to replay.
+			 */
+			bool BeginFrame(double& deltaTime);
+
+			/**
+			 * Add event to current recorded frame.
+			 *
+			 * \param event Event to record.
+			 */
+			void RecordEvent(const SDL_Event& event);
+
+			/**
+			 * Get next replayed event of current frame.
+			 *
+			 * \param event Event to fill.
+			 * \return False if there are no more events in current frame.
+			 */
+			bool NextEvent(SDL_Event& event);
+
+			/**
+			 * End current frame. When recording, write frame to file.
+			 */
+			void EndFrame();
+
+		private:
+
+			/**
+			 * Write replay frame times report.
+			 */
+			void WriteReport();
+		};
+	}
+}
@@ -60,8 +60,11 @@ namespace bon
 			// substract rendering.
 			Subtract = 10,
 
+			// render with premultiplied alpha channels (for example images that were rendered with alpha blend on a transparent render target).
+			Premultiplied = 11,
+
 			// blend modes count.
-			_Count = 11,
+			_Count = 12,
 		};
 	}
 }
\ No newline at end of file
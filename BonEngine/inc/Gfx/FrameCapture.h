@@ -0,0 +1,85 @@
+/*****************************************************************//**
+ * \file   FrameCapture.h
+ * \brief  Settings for capturing rendered frames to disk.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Output formats for frames capture.
+		 */
+		enum class BON_DLLEXPORT FrameCaptureFormats
+		{
+			// save every frame as a PNG file in output folder.
+			PngSequence = 0,
+
+			// write all frames into a single raw YUV4MPEG2 (.y4m) video file.
+			Y4M = 1,
+		};
+
+		/**
+		 * What to do when frames are captured faster than they can be encoded.
+		 */
+		enum class BON_DLLEXPORT FrameCaptureOverflow
+		{
+			// skip frames until encoders catch up. keeps the game running smoothly.
+			DropFrames = 0,
+
+			// wait for encoders to catch up. slows the game down, but every frame is saved.
+			Throttle = 1,
+		};
+
+		/**
+		 * Settings for frames capture.
+		 */
+		struct BON_DLLEXPORT FrameCaptureSettings
+		{
+			/**
+			 * Output format.
+			 */
+			FrameCaptureFormats Format = FrameCaptureFormats::PngSequence;
+
+			/**
+			 * Output path. Folder to write PNG files into, or video file path for Y4M.
+			 */
+			const char* OutputPath = "capture";
+
+			/**
+			 * Capture one out of every N rendered frames.
+			 */
+			int CaptureEveryNFrames = 1;
+
+			/**
+			 * Max frames waiting to be encoded before dropping or throttling.
+			 */
+			int MaxQueuedFrames = 8;
+
+			/**
+			 * How many worker threads to encode frames with. Y4M always uses a single worker, since frames must be written in order.
+			 */
+			int WorkerThreads = 2;
+
+			/**
+			 * What to do when encoders can't keep up.
+			 */
+			FrameCaptureOverflow Overflow = FrameCaptureOverflow::DropFrames;
+
+			/**
+			 * Frame rate to write in Y4M header.
+			 */
+			int FrameRate = 60;
+
+			/**
+			 * Stop capturing automatically after this many frames. 0 = no limit.
+			 */
+			int MaxFrames = 0;
+		};
+	}
+}
\ No newline at end of file
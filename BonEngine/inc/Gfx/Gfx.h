@@ -237,6 +237,36 @@ namespace bon
 			*/
 			void SetViewport(const framework::RectangleI* viewport) override;
 
+			/**
+			 * Set a clipping rectangle (will only render pixels inside the given region, without changing drawing coordinates).
+			 * Clipping rect is in drawing coordinates, ie the current drawing offset is applied to it.
+			 *
+			 * \param clipRect Clipping rect to set, or nullptr to disable clipping.
+			 */
+			virtual void SetClipRect(const framework::RectangleI* clipRect) override;
+
+			/**
+			 * Get current clipping rectangle.
+			 *
+			 * \return Clipping rect, or nullptr if clipping is disabled.
+			 */
+			virtual const framework::RectangleI* GetClipRect() const override;
+
+			/**
+			 * Set offset to add to all drawing positions.
+			 * This is useful to draw things positioned in screen coordinates on a smaller render target.
+			 *
+			 * \param offset Drawing offset, in pixels.
+			 */
+			virtual void SetDrawOffset(const framework::PointI& offset) override;
+
+			/**
+			 * Get offset we add to all drawing positions.
+			 *
+			 * \return Drawing offset, in pixels.
+			 */
+			virtual const framework::PointI& GetDrawOffset() const override;
+
 			/**
 			 * Set the window's title.
 			 *
@@ -273,12 +303,58 @@ namespace bon
 			 */
 			virtual assets::EffectAsset GetActiveEffect() const override;
 
+			/**
+			 * Compile effects that were loaded but not compiled yet (when 'LazyEffectsCompilation' feature is enabled).
+			 * Call this every frame during loading screens, to avoid compiling effects on their first use.
+			 *
+			 * \param maxTime Max time to spend compiling effects, in seconds. 0 = compile all pending effects.
+			 * \return How many effects are still waiting to be compiled.
+			 */
+			virtual int WarmUpEffects(double maxTime = 0.0) override;
+
 			/**
 			 * Take a screenshot of what's currently presented on screen and return as an image asset.
 			 *
 			 * \return New image containing whats currently rendered on screen.
 			 */
 			virtual assets::ImageAsset CreateImageFromScreen() const override;
+
+			/**
+			 * Read pixels from an image or from screen, without stalling until the GPU finish rendering.
+			 * Pixels will be ready a few frames later (see 'AsyncReadbackFrames' feature), check 'IsReady()' on the returned object.
+			 *
+			 * \param image Image to read pixels from, or nullptr to read from screen.
+			 * \param sourceRect Region to read, or empty rectangle to read everything.
+			 * \param saveToFile If not null, will save pixels as PNG file once ready (saving is done in background).
+			 * \return Pixels readback object, that will be filled once pixels are ready.
+			 */
+			virtual PixelsReadback ReadPixelsAsync(const assets::ImageAsset& image, const framework::RectangleI& sourceRect, const char* saveToFile = nullptr) override;
+
+			/**
+			 * Start capturing rendered frames to disk, as PNG sequence or Y4M video.
+			 *
+			 * \param settings Capture settings.
+			 */
+			virtual void StartFrameCapture(const FrameCaptureSettings& settings) override;
+
+			/**
+			 * Start capturing rendered frames to disk, with settings from config file '[capture]' section.
+			 *
+			 * \param config Config asset with capture settings.
+			 */
+			virtual void StartFrameCapture(const assets::ConfigAsset& config) override;
+
+			/**
+			 * Stop capturing frames, and wait for all captured frames to be written.
+			 */
+			virtual void StopFrameCapture() override;
+
+			/**
+			 * Get if currently capturing frames.
+			 *
+			 * \return True if capturing frames.
+			 */
+			virtual bool IsCapturingFrames() const override;
 		};
 	}
 }
\ No newline at end of file
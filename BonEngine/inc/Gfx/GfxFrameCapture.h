@@ -0,0 +1,135 @@
+/*****************************************************************//**
+ * \file   GfxFrameCapture.h
+ * \brief  Capture rendered frames and encode them to disk on worker threads.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fstream>
+#include "FrameCapture.h"
+#include "GfxReadbacks.h"
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Capture frames using async readbacks, and encode them in background.
+		 * Frames go through these stages: readback requested -> readback ready -> queued for encoding -> encoded by worker thread.
+		 */
+		class GfxFrameCapture
+		{
+		private:
+
+			// a frame waiting for readback or encoding
+			struct CapturedFrame
+			{
+				int Index = 0;
+				PixelsReadback Pixels;
+			};
+
+			// readbacks to get frames from
+			GfxReadbacks* _readbacks = nullptr;
+
+			// capture settings (output path is copied)
+			FrameCaptureSettings _settings;
+			std::string _outputPath;
+
+			// is currently capturing
+			bool _isCapturing = false;
+
+			// frames counters
+			int _renderedFrames = 0;
+			int _capturedFrames = 0;
+
+			// capture size (Y4M requires all frames to be the same size)
+			int _width = 0;
+			int _height = 0;
+
+			// frames waiting for readback, in order
+			std::deque<CapturedFrame> _waitingReadback;
+
+			// frames waiting to be encoded, and sync objects to access them from workers
+			std::deque<CapturedFrame> _encodeQueue;
+			std::mutex _queueMutex;
+			std::condition_variable _queueHasFrames;
+			std::condition_variable _queueHasSpace;
+			bool _stopWorkers = false;
+
+			// worker threads
+			std::vector<std::thread> _workers;
+
+			// y4m output file (only used by the single y4m worker)
+			std::ofstream _y4mFile;
+			std::vector<unsigned char> _yuvBuffer;
+
+		public:
+
+			/**
+			 * Initialize frames capture.
+			 */
+			void Initialize(GfxReadbacks* readbacks);
+
+			/**
+			 * Start capturing frames.
+			 *
+			 * \param settings Capture settings.
+			 * \param width Frames width.
+			 * \param height Frames height.
+			 */
+			void Start(const FrameCaptureSettings& settings, int width, int height);
+
+			/**
+			 * Stop capturing and wait for all captured frames to be encoded.
+			 */
+			void Stop();
+
+			/**
+			 * Get if currently capturing frames.
+			 */
+			inline bool IsCapturing() const { return _isCapturing; }
+
+			/**
+			 * Call after frame is rendered, before presenting it, to request its pixels.
+			 *
+			 * \param width Current screen width.
+			 * \param height Current screen height.
+			 */
+			void OnFrameRendered(int width, int height);
+
+			/**
+			 * Call once per frame after readbacks update, to move ready frames to encoders.
+			 */
+			void Update();
+
+		private:
+
+			/**
+			 * Push a frame to encoding queue, drop or throttle if queue is full.
+			 */
+			void QueueForEncoding(CapturedFrame& frame);
+
+			/**
+			 * Worker thread main loop.
+			 */
+			void WorkerLoop();
+
+			/**
+			 * Encode a single frame.
+			 */
+			void Encode(const CapturedFrame& frame);
+
+			/**
+			 * Write frame to y4m file.
+			 */
+			void WriteY4MFrame(const PixelsReadback& pixels);
+		};
+	}
+}
\ No newline at end of file
@@ -37,9 +37,15 @@ namespace bon
 
 			/**
 			* Compile and return a GLSL program.
+			* If program binaries cache is enabled (see 'ShaderCacheFolder' feature), will try to load a previously compiled binary first.
 			*/
 			static GLuint CompileProgram(const char* vtxShader, const char* fragShader);
 
+			/**
+			 * Check if the driver supports program binaries, and program binaries cache is enabled.
+			 */
+			static bool ProgramBinaryCacheEnabled();
+
 			/**
 			 * Init gl extensions.
 			 */
@@ -95,6 +101,11 @@ namespace bon
 			 */
 			static void SetTexture(SDL_Texture* texture);
 
+			/**
+			 * Set offset to add to all drawing positions (translates model view matrix).
+			 */
+			static void SetDrawOffset(int x, int y);
+
 			/**
 			 * Clears a texture completely to transparent black.
 			 */
@@ -159,6 +170,86 @@ namespace bon
 			 * Set a matrix uniform.
 			 */
 			static void SetUniformMatrix4(GLint uniform, int count, bool transpose, const float* values);
+
+			/**
+			 * Check if uniform buffer objects are supported.
+			 */
+			static bool SupportsUniformBuffers();
+
+			/**
+			 * Get uniform block index from program, or -1 if not found.
+			 */
+			static GLint GetUniformBlockIndex(GLint programId, const char* name);
+
+			/**
+			 * Attach a program uniform block to a binding point.
+			 */
+			static void SetUniformBlockBinding(GLint programId, GLint blockIndex, GLuint bindingPoint);
+
+			/**
+			 * Upload data to a uniform buffer.
+			 * If buffer is 0, will create a new buffer and set it.
+			 */
+			static void UploadUniformBuffer(GLuint& buffer, const void* data, size_t size, bool resize);
+
+			/**
+			 * Bind a uniform buffer to a binding point.
+			 */
+			static void BindUniformBuffer(GLuint bindingPoint, GLuint buffer);
+
+			/**
+			 * Delete a buffer object.
+			 */
+			static void DeleteBuffer(GLuint buffer);
+
+			/**
+			 * Check if pixel buffer objects are supported.
+			 */
+			static bool SupportsPixelBuffers();
+
+			/**
+			 * Start reading pixels (RGBA) from the current read framebuffer into a pixel buffer, without waiting for the GPU.
+			 * If buffer is 0, will create a new buffer and set it. Buffer storage is grown if capacity is too small.
+			 */
+			static void ReadPixelsToBuffer(GLuint& buffer, size_t& capacity, int x, int y, int width, int height);
+
+			/**
+			 * Copy pixels from a pixel buffer into memory.
+			 * Will block if the GPU did not finish writing to buffer yet.
+			 */
+			static bool CopyPixelBuffer(GLuint buffer, int width, int height, bool flipRows, unsigned char* dest);
+
+			/**
+			 * Upload rows of RGBA pixels into a texture.
+			 * If pixel buffers are supported, pixels are copied into a pixel buffer and the driver transfers them to the texture without blocking.
+			 * If buffer is 0, will create a new buffer and set it. Buffer storage is grown if capacity is too small.
+			 */
+			static void UploadTextureRows(SDL_Texture* texture, GLuint& buffer, size_t& capacity, int y, int width, int rows, const unsigned char* pixels);
+
+			/**
+			 * Insert a fence to the GPU commands stream, or return nullptr if fences are not supported.
+			 */
+			static void* CreateFence();
+
+			/**
+			 * Check if GPU passed a fence, without waiting. Always true if fence is nullptr.
+			 */
+			static bool IsFenceSignaled(void* fence);
+
+			/**
+			 * Delete a fence.
+			 */
+			static void DeleteFence(void* fence);
+
+			/**
+			 * Check if framebuffer blit is supported.
+			 */
+			static bool SupportsFramebufferBlit();
+
+			/**
+			 * Copy the screen into the currently bound render target, without leaving the GPU.
+			 */
+			static void BlitScreenToCurrentTarget(int screenWidth, int screenHeight, int targetWidth, int targetHeight);
 		};
 	}
 }
\ No newline at end of file
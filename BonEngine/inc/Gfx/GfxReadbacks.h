@@ -0,0 +1,109 @@
+/*****************************************************************//**
+ * \file   GfxReadbacks.h
+ * \brief  Read pixels from GPU asynchronously, using a ring of pixel buffers.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <list>
+#include <future>
+#include <Framework/Rectangle.h>
+#include "PixelsReadback.h"
+
+struct SDL_Renderer;
+struct SDL_Texture;
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Manage async pixels readbacks.
+		 * Every request reads pixels into a pixel buffer without waiting for the GPU, and the buffer is only mapped a few frames later, once the GPU is done with it.
+		 */
+		class GfxReadbacks
+		{
+		private:
+
+			// a pixel buffer in the readbacks ring
+			struct ReadbackSlot
+			{
+				// request we read pixels for, or null if slot is free
+				PixelsReadback Request;
+
+				// pixel buffer and its allocated size
+				unsigned int Buffer = 0;
+				size_t Capacity = 0;
+
+				// fence to check if GPU finished writing to buffer
+				void* Fence = nullptr;
+
+				// frames left until we try to map the buffer
+				int FramesLeft = 0;
+
+				// should we flip rows when copying pixels (reading from screen)
+				bool FlipRows = false;
+			};
+
+			// readbacks ring
+			std::vector<ReadbackSlot> _slots;
+
+			// next slot to use
+			size_t _nextSlot = 0;
+
+			// files currently being saved in background
+			std::list<std::future<void>> _pendingSaves;
+
+			// renderer to read from
+			SDL_Renderer* _renderer = nullptr;
+
+		public:
+
+			/**
+			 * Initialize readbacks ring.
+			 */
+			void Initialize(SDL_Renderer* renderer);
+
+			/**
+			 * Request to read pixels from a texture or from screen.
+			 *
+			 * \param texture Texture to read from, or nullptr to read from screen.
+			 * \param width Texture or screen width.
+			 * \param height Texture or screen height.
+			 * \param sourceRect Region to read, or empty rect to read everything.
+			 * \param saveToFile If not null, will save pixels to this file once ready.
+			 * \return Readback to be filled once GPU is done.
+			 */
+			PixelsReadback Request(SDL_Texture* texture, int width, int height, const framework::RectangleI& sourceRect, const char* saveToFile);
+
+			/**
+			 * Call once per frame to complete readbacks that are ready.
+			 */
+			void Update();
+
+			/**
+			 * Complete all pending readbacks now, even if we need to wait for the GPU.
+			 */
+			void CompleteAll();
+
+			/**
+			 * Complete pending readbacks, wait for files being saved and free buffers.
+			 */
+			void Dispose();
+
+		private:
+
+			/**
+			 * Copy pixels from slot into its request and free the slot.
+			 */
+			void Complete(ReadbackSlot& slot);
+
+			/**
+			 * Handle a readback that just got ready.
+			 */
+			void OnReady(const PixelsReadback& request);
+		};
+	}
+}
\ No newline at end of file
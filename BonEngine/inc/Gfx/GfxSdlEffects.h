@@ -39,6 +39,14 @@ namespace bon
 			 * Load and return default shader for drawing shapes.
 			 */
 			bon::assets::EffectAsset LoadDefaultShapesProgram();
+
+			/**
+			 * Compile effects that were loaded with lazy compilation and were not used yet.
+			 *
+			 * \param maxTime Max time to spend compiling effects, in seconds. 0 = no limit.
+			 * \return How many effects are still waiting to be compiled.
+			 */
+			int CompilePendingEffects(double maxTime);
 		};
 	}
 }
\ No newline at end of file
@@ -15,6 +15,10 @@
 #include <Assets/Types/Effect.h>
 #include <Gfx/Defs.h>
 #include "GfxSdlEffects.h"
+#include "GfxReadbacks.h"
+#include "GfxFrameCapture.h"
+#include "GfxTextureStreamer.h"
+#include "GfxUploadQueue.h"
 
  // forward declare some SDL stuff
 struct SDL_Window;
@@ -49,6 +53,25 @@ namespace bon
 			// currently active effect
 			assets::EffectAsset _currentEffect;
 
+			// async pixels readbacks
+			GfxReadbacks _readbacks;
+
+			// frames capture
+			GfxFrameCapture _frameCapture;
+
+			// progressive images streaming
+			GfxTextureStreamer _textureStreamer;
+
+			// time-sliced textures uploads
+			GfxUploadQueue _uploadQueue;
+
+			// offset to add to all drawing positions
+			framework::PointI _drawOffset;
+
+			// current clipping rect, if enabled
+			framework::RectangleI _clipRect;
+			bool _hasClipRect = false;
+
 #pragma warning (pop)
 
 		public:
@@ -161,6 +184,45 @@ namespace bon
 			 */
 			assets::_ImageHandle* RenderScreenToImage() const;
 
+			/**
+			 * Request to read pixels from a texture or from screen, without waiting for the GPU.
+			 *
+			 * \param texture Texture to read from, or nullptr to read from screen.
+			 * \param width Texture width (ignored when reading from screen).
+			 * \param height Texture height (ignored when reading from screen).
+			 * \param sourceRect Source rect to read, or empty to read whole texture.
+			 * \param saveToFile If not null, will save pixels to this file once ready.
+			 * \return Readback that will be filled a few frames later.
+			 */
+			PixelsReadback ReadPixelsAsync(SDL_Texture* texture, int width, int height, const framework::RectangleI& sourceRect, const char* saveToFile);
+
+			/**
+			 * Start capturing rendered frames to disk.
+			 *
+			 * \param settings Capture settings.
+			 */
+			void StartFrameCapture(const FrameCaptureSettings& settings);
+
+			/**
+			 * Stop capturing frames and wait for all captured frames to be written.
+			 */
+			void StopFrameCapture();
+
+			/**
+			 * Get if currently capturing frames.
+			 */
+			inline bool IsCapturingFrames() const { return _frameCapture.IsCapturing(); }
+
+			/**
+			 * Get progressive images streamer.
+			 */
+			inline GfxTextureStreamer& TextureStreamer() { return _textureStreamer; }
+
+			/**
+			 * Get textures upload queue.
+			 */
+			inline GfxUploadQueue& UploadQueue() { return _uploadQueue; }
+
 			/**
 			 * Set textures filtering mode.
 			 * 
@@ -301,6 +363,30 @@ namespace bon
 			*/
 			void SetViewport(const framework::RectangleI* viewport);
 
+			/**
+			 * Set offset to add to all drawing positions.
+			 *
+			 * \param offset Drawing offset, in pixels.
+			 */
+			void SetDrawOffset(const framework::PointI& offset);
+
+			/**
+			 * Get offset we add to all drawing positions.
+			 */
+			inline const framework::PointI& GetDrawOffset() const { return _drawOffset; }
+
+			/**
+			 * Set clipping rect, in drawing coordinates.
+			 *
+			 * \param clipRect Clipping rect, or nullptr to disable clipping.
+			 */
+			void SetClipRect(const framework::RectangleI* clipRect);
+
+			/**
+			 * Get clipping rect, or nullptr if clipping is disabled.
+			 */
+			inline const framework::RectangleI* GetClipRect() const { return _hasClipRect ? &_clipRect : nullptr; }
+
 			/**
 			 * Dispose renderer, window ect.
 			 */
@@ -341,6 +427,14 @@ namespace bon
 			 */
 			void RestoreDefaultEffect();
 
+			/**
+			 * Compile effects that are waiting for lazy compilation.
+			 *
+			 * \param maxTime Max time to spend compiling effects, in seconds. 0 = no limit.
+			 * \return How many effects are still waiting to be compiled.
+			 */
+			int WarmUpEffects(double maxTime);
+
 			/**
 			 * Get current effect handle.
 			 */
@@ -356,13 +450,18 @@ namespace bon
 			/**
 			 * Handle images without alpha channels by adding alpha of 1.
 			 */
-			void HandleImagesWithoutAlpha(assets::ImageAsset image);
+			void HandleImagesWithoutAlpha(const assets::_Image* image);
 
 			/**
 			 * Restore default internal states.
 			 */
 			void RestoreDefaultStates();
 
+			/**
+			 * Apply current clipping rect and drawing offset to renderer.
+			 */
+			void ApplyClipRect();
+
 			/**
 			 * Draw texture directly. Used internally.
 			 */
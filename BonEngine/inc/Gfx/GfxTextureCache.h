@@ -0,0 +1,136 @@
+/*****************************************************************//**
+ * \file   GfxTextureCache.h
+ * \brief  Cache of decoded images pixels, to skip decoding image files on every run.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// forward declare some SDL stuff
+struct SDL_Surface;
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Decoded image pixels loaded from or saved to texture cache.
+		 */
+		struct CachedImagePixels
+		{
+			// pixels data (RGBA, 8 bits per channel)
+			std::vector<unsigned char> Pixels;
+
+			// image size
+			int Width = 0;
+			int Height = 0;
+
+			// did the source image have alpha channel
+			bool HaveAlpha = false;
+
+			// source file content hash (0 = not calculated yet). set when loading and saving, so saving more levels of the same image won't hash it again
+			uint64_t SourceHash = 0;
+		};
+
+		/**
+		 * Store decoded images pixels in cache folder, compressed with a fast LZ4 block codec.
+		 * Cache files are keyed by image path and level (level 0 is the full image, every level after it is half the size of the previous one, used for streamed images),
+		 * and validated against source file size and modification time, or content hash if modification time changed.
+		 * Pixels are compressed in independent chunks, so they can be decompressed in parallel on a pool of worker threads,
+		 * straight from the memory mapped cache file.
+		 *
+		 * Cache file format (little endian):
+		 *	Header: magic, version, width, height, flags, codec, source size, source mtime, source hash, chunk raw size, chunks count.
+		 *	Chunks table: compressed size of every chunk (uint32).
+		 *	Chunks data.
+		 */
+		class GfxTextureCache
+		{
+		public:
+
+			/**
+			 * Get if texture cache is enabled (when 'TextureCacheFolder' feature is set).
+			 */
+			static bool IsEnabled();
+
+			/**
+			 * Get folder to store cache files in: 'TextureCacheFolder' feature if set, or a folder under system temp directory otherwise
+			 * (only used by streamed images when texture cache is not enabled).
+			 */
+			static std::string Folder();
+
+			/**
+			 * Get if a decoded image has transparency (alpha channel or color key).
+			 * Used for images 'HaveAlpha' flag, whether they are loaded from cache or not.
+			 *
+			 * \param surface Decoded image.
+			 */
+			static bool HaveAlpha(SDL_Surface* surface);
+
+			/**
+			 * Convert a decoded image to RGBA pixels, to store in cache.
+			 *
+			 * \param surface Decoded image (not freed).
+			 * \param out Converted pixels, size and alpha flag.
+			 * \return False if failed to convert.
+			 */
+			static bool FromSurface(SDL_Surface* surface, CachedImagePixels& out);
+
+			/**
+			 * Stop worker threads used to compress and decompress cache files.
+			 * Called when gfx is disposed. Workers start again on next use.
+			 */
+			static void StopWorkers();
+
+			/**
+			 * Try to load image pixels from cache.
+			 *
+			 * \param path Source image path.
+			 * \param out Loaded pixels.
+			 * \param level Image level to load (0 = full image).
+			 * \return True if found valid cache entry and loaded it.
+			 */
+			static bool Load(const char* path, CachedImagePixels& out, int level = 0);
+
+			/**
+			 * Save image pixels to cache.
+			 *
+			 * \param path Source image path.
+			 * \param image Image pixels to store. Will set its source hash, if not set.
+			 * \param level Image level the pixels belong to (0 = full image).
+			 */
+			static void Save(const char* path, CachedImagePixels& image, int level = 0);
+
+			/**
+			 * Compress data with LZ4 block format.
+			 *
+			 * \param src Data to compress.
+			 * \param srcSize Data size.
+			 * \param dest Output buffer, must be at least 'CompressBound(srcSize)' bytes.
+			 * \return Compressed size.
+			 */
+			static size_t Compress(const unsigned char* src, size_t srcSize, unsigned char* dest);
+
+			/**
+			 * Get max compressed size for given data size.
+			 */
+			static inline size_t CompressBound(size_t srcSize) { return srcSize + (srcSize / 255) + 16; }
+
+			/**
+			 * Decompress LZ4 block format data.
+			 *
+			 * \param src Compressed data.
+			 * \param srcSize Compressed data size.
+			 * \param dest Output buffer.
+			 * \param destSize Expected decompressed size.
+			 * \return True if decompressed successfully to exactly 'destSize' bytes.
+			 */
+			static bool Decompress(const unsigned char* src, size_t srcSize, unsigned char* dest, size_t destSize);
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+/*****************************************************************//**
+ * \file   GfxTextureStreamer.h
+ * \brief  Progressive streaming of large images, by on-screen size.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <Assets/Defs.h>
+#include <Assets/Types/ImageHandle.h>
+
+namespace bon
+{
+	namespace gfx
+	{
+		// forward declare
+		class GfxSdlWrapper;
+
+		/**
+		 * An image loaded progressively.
+		 * Level 0 is the full image, and every level after it is half the size of the previous one.
+		 * Only a single level is kept in video memory, picked by the size the image is drawn at.
+		 */
+		class StreamedTexture
+		{
+		public:
+
+			// source file
+			std::string Path;
+
+			// full image size
+			int Width = 0;
+			int Height = 0;
+
+			// smallest level, used as placeholder
+			int PlaceholderLevel = 0;
+
+			// filtering mode to create textures with
+			assets::ImageFilterMode Filter = assets::ImageFilterMode::Nearest;
+
+			// image handle to set textures on (main thread only)
+			assets::_ImageHandle* Handle = nullptr;
+
+			// level currently in texture (-1 = nothing loaded yet), and its size
+			int ResidentLevel = -1;
+			int TextureWidth = 1;
+			int TextureHeight = 1;
+
+			// level we want resident, finest level needed to draw during this frame, and when target level was last needed
+			int TargetLevel = 0;
+			int FrameLevel = 0;
+			double LastNeededTime = 0.0;
+
+			// is there a decode or upload in progress, and did decoding fail (stop requesting levels)
+			bool Pending = false;
+			bool Failed = false;
+
+			// did source image have alpha channel (assume it does until decoded)
+			bool HaveAlpha = true;
+
+			// placeholder level pixels, kept in memory so we can drop to placeholder without decoding again
+			std::vector<unsigned char> PlaceholderPixels;
+
+			// set when image is disposed, so decoder can skip it
+			std::atomic<bool> Disposed{ false };
+
+			/**
+			 * Get level size.
+			 */
+			inline int LevelWidth(int level) const { int ret = Width >> level; return ret > 0 ? ret : 1; }
+			inline int LevelHeight(int level) const { int ret = Height >> level; return ret > 0 ? ret : 1; }
+
+			/**
+			 * Mark that image is drawn at given on-screen size (size of the whole image, not just the drawn region).
+			 */
+			void OnDraw(float screenWidth, float screenHeight);
+		};
+
+		/**
+		 * Stream images levels from disk on worker threads, and upload the level each image needs through the gfx upload queue.
+		 * Images start with their placeholder level as a preview if its in textures cache (or a 1x1 transparent texture if not), and get the level that
+		 * matches their on-screen size as soon as it's decoded. The first decode builds all levels and stores them in textures cache, so switching levels
+		 * later only loads the level needed instead of decoding the full image again.
+		 * Dropping to a smaller level is delayed, to avoid decoding again when an image is zoomed in and out.
+		 */
+		class GfxTextureStreamer
+		{
+		public:
+
+			/**
+			 * Max placeholder level size, in pixels.
+			 */
+			static const int PlaceholderSize = 32;
+
+			/**
+			 * How many decoder threads to run.
+			 */
+			static const int WorkerThreads = 2;
+
+			/**
+			 * How long a level must be unneeded before dropping to a smaller level, in seconds.
+			 */
+			static constexpr double DowngradeDelay = 2.0;
+
+		private:
+
+			// a level to decode
+			struct DecodeRequest
+			{
+				std::shared_ptr<StreamedTexture> Texture;
+				int Level;
+				bool NeedPlaceholder;
+			};
+
+			// decoded level
+			struct DecodeResult
+			{
+				std::shared_ptr<StreamedTexture> Texture;
+				int Level = 0;
+				int Width = 0;
+				int Height = 0;
+				bool HaveAlpha = true;
+				bool Failed = false;
+				std::vector<unsigned char> Pixels;
+				std::vector<unsigned char> PlaceholderPixels;
+			};
+
+			// streamed images (main thread only)
+			std::vector<std::shared_ptr<StreamedTexture>> _textures;
+
+			// decode requests and results, protected by mutex
+			std::deque<DecodeRequest> _requests;
+			std::vector<DecodeResult> _results;
+			std::mutex _mutex;
+			std::condition_variable _wakeUp;
+
+			// decoder threads
+			std::vector<std::thread> _workers;
+			std::atomic<bool> _running{ false };
+
+			// gfx wrapper to create textures with
+			GfxSdlWrapper* _gfx = nullptr;
+
+		public:
+
+			/**
+			 * Stop decoders on destruction.
+			 */
+			~GfxTextureStreamer();
+
+			/**
+			 * Start decoder threads.
+			 */
+			void Start(GfxSdlWrapper* gfx);
+
+			/**
+			 * Stop decoder threads and drop pending requests.
+			 */
+			void Stop();
+
+			/**
+			 * Create a streamed image.
+			 *
+			 * \param path Image file path.
+			 * \param width Full image width.
+			 * \param height Full image height.
+			 * \param filter Filtering mode.
+			 * \param handle Image handle to set textures on. Will get the cached placeholder level, or a 1x1 transparent texture until first level is decoded.
+			 * \return Streamed image, or nullptr if failed to create placeholder texture.
+			 */
+			std::shared_ptr<StreamedTexture> Create(const char* path, int width, int height, assets::ImageFilterMode filter, assets::_ImageHandle* handle);
+
+			/**
+			 * Stop streaming an image. Called when image is disposed (image handle owns and destroys the texture).
+			 */
+			void Remove(StreamedTexture* texture);
+
+			/**
+			 * Upload decoded levels and request levels images need. Called once per frame, on main thread.
+			 */
+			void Update();
+
+			/**
+			 * Read image size from file header, without decoding it.
+			 * Supports png, jpeg, bmp and gif files.
+			 *
+			 * \param path Image file path.
+			 * \param outWidth Image width.
+			 * \param outHeight Image height.
+			 * \return True if succeed to read size.
+			 */
+			static bool ReadImageSize(const char* path, int& outWidth, int& outHeight);
+
+		private:
+
+			/**
+			 * Decoder thread main loop.
+			 */
+			void Run();
+
+			/**
+			 * Load a level from textures cache, or decode the image and store all its levels in cache.
+			 */
+			void Decode(const DecodeRequest& request, DecodeResult& result);
+
+			/**
+			 * Create a texture for level and queue its pixels upload. Once uploaded, texture is swapped into image handle.
+			 */
+			bool Upload(const std::shared_ptr<StreamedTexture>& texture, int level, int width, int height, std::vector<unsigned char>&& pixels);
+
+			/**
+			 * Shrink RGBA pixels to half size, with a box filter.
+			 */
+			static void Downsample(const std::vector<unsigned char>& source, int width, int height, std::vector<unsigned char>& dest, int& outWidth, int& outHeight);
+		};
+	}
+}
\ No newline at end of file
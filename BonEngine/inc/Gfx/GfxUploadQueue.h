@@ -0,0 +1,110 @@
+/*****************************************************************//**
+ * \file   GfxUploadQueue.h
+ * \brief  Upload textures pixels over multiple frames, within a per-frame budget.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <deque>
+#include <functional>
+
+struct SDL_Texture;
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Queue of textures pixels to upload to the GPU.
+		 * Uploads are split into chunks of rows, and every frame we only upload as many chunks as the 'TextureUploadBytesPerFrame' and 'TextureUploadTimePerFrame' features allow.
+		 * Uses pixel buffers when supported, so the driver can transfer pixels without blocking the main thread.
+		 */
+		class GfxUploadQueue
+		{
+		public:
+
+			/**
+			 * Called when all pixels were uploaded to texture, or when upload was dropped (success = false).
+			 * Texture ownership moves to the callback, which should destroy it if it's not going to use it.
+			 */
+			typedef std::function<void(SDL_Texture* texture, bool success)> UploadCallback;
+
+			/**
+			 * Max bytes to upload in a single chunk.
+			 */
+			static const size_t ChunkBytes = 256 * 1024;
+
+		private:
+
+			// a pending upload
+			struct Upload
+			{
+				SDL_Texture* Texture;
+				int Width;
+				int Height;
+				int NextRow;
+				std::vector<unsigned char> Pixels;
+				UploadCallback OnComplete;
+			};
+
+			// pending uploads, in order
+			std::deque<Upload> _uploads;
+
+			// pixel buffer to upload through, and its allocated size
+			unsigned int _buffer = 0;
+			size_t _capacity = 0;
+
+			// bytes waiting to be uploaded
+			size_t _pendingBytes = 0;
+
+		public:
+
+			/**
+			 * Add pixels to upload to a texture.
+			 *
+			 * \param texture Texture to upload to. Must be a static RGBA32 texture, with the same size as pixels.
+			 * \param width Texture width.
+			 * \param height Texture height.
+			 * \param pixels RGBA pixels to upload.
+			 * \param onComplete Called once all pixels are uploaded.
+			 */
+			void Enqueue(SDL_Texture* texture, int width, int height, std::vector<unsigned char>&& pixels, UploadCallback onComplete);
+
+			/**
+			 * Upload chunks within this frame budget. Called once per frame, on main thread.
+			 * At least one chunk is uploaded every frame, so uploads always progress.
+			 */
+			void Update();
+
+			/**
+			 * Upload everything now, ignoring budget.
+			 */
+			void Flush();
+
+			/**
+			 * Drop all pending uploads (calling their callbacks with success = false) and free pixel buffer.
+			 */
+			void Dispose();
+
+			/**
+			 * Get how many uploads are pending.
+			 */
+			inline size_t PendingUploads() const { return _uploads.size(); }
+
+			/**
+			 * Get how many bytes are waiting to be uploaded.
+			 */
+			inline size_t PendingBytes() const { return _pendingBytes; }
+
+		private:
+
+			/**
+			 * Upload next chunk of the first upload in queue, up to given bytes (at least one row).
+			 * Return uploaded bytes.
+			 */
+			size_t UploadChunk(size_t maxBytes);
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*****************************************************************//**
+ * \file   PixelsReadback.h
+ * \brief  Pixels read back from GPU asynchronously.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "../Framework/Point.h"
+#include "../Framework/Color.h"
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Pixels requested from GPU with 'Gfx().ReadPixelsAsync()'.
+		 * Reading pixels from GPU without waiting for it to finish rendering takes a few frames, so this object starts empty and gets filled later.
+		 * Check 'IsReady()' before accessing pixels.
+		 */
+		class BON_DLLEXPORT _PixelsReadback
+		{
+		private:
+#pragma warning ( push )
+#pragma warning ( disable: 4251 )
+			// pixels data (RGBA, 8 bits per channel, rows go from top to bottom)
+			std::vector<unsigned char> _pixels;
+
+			// optional file to save pixels to once ready
+			std::string _saveToFile;
+#pragma warning (pop)
+
+			// pixels size
+			int _width;
+			int _height;
+
+			// state
+			bool _ready = false;
+			bool _failed = false;
+
+		public:
+
+			/**
+			 * Create the readback request.
+			 *
+			 * \param width Region width.
+			 * \param height Region height.
+			 * \param saveToFile If not null, will save pixels to this file once ready.
+			 */
+			_PixelsReadback(int width, int height, const char* saveToFile) : _width(width), _height(height)
+			{
+				if (saveToFile) { _saveToFile = saveToFile; }
+			}
+
+			/**
+			 * Get if pixels are ready to read.
+			 *
+			 * \return True if pixels are ready.
+			 */
+			inline bool IsReady() const { return _ready; }
+
+			/**
+			 * Get if readback failed. A failed readback is also ready, but without pixels.
+			 *
+			 * \return True if readback failed.
+			 */
+			inline bool Failed() const { return _failed; }
+
+			/**
+			 * Get pixels region width.
+			 */
+			inline int Width() const { return _width; }
+
+			/**
+			 * Get pixels region height.
+			 */
+			inline int Height() const { return _height; }
+
+			/**
+			 * Get raw pixels data, or nullptr if not ready.
+			 * Pixels are RGBA, 8 bits per channel, rows go from top to bottom and row pitch is Width() * 4.
+			 *
+			 * \return Pixels data.
+			 */
+			inline const unsigned char* Pixels() const { return (_ready && !_failed) ? _pixels.data() : nullptr; }
+
+			/**
+			 * Get a pixel color.
+			 *
+			 * \param position Pixel position, relative to the region that was read.
+			 * \return Pixel color, or transparent black if not ready or out of range.
+			 */
+			framework::Color GetPixel(const framework::PointI& position) const;
+
+			/**
+			 * Save pixels to a PNG file.
+			 *
+			 * \param filename File to save.
+			 * \return True if saved successfully.
+			 */
+			bool SaveToFile(const char* filename) const;
+
+			/**
+			 * Get the file to save pixels to once ready, or empty string if not set.
+			 */
+			inline const std::string& _SaveToFilePath() const { return _saveToFile; }
+
+			/**
+			 * Get pixels buffer to fill. Used internally.
+			 */
+			inline std::vector<unsigned char>& _Buffer() { return _pixels; }
+
+			/**
+			 * Mark pixels as ready. Used internally.
+			 *
+			 * \param success False if failed to read pixels.
+			 */
+			inline void _SetReady(bool success) { _ready = true; _failed = !success; }
+		};
+
+		/**
+		 * Pixels readback pointer.
+		 */
+		typedef BON_DLLEXPORT std::shared_ptr<_PixelsReadback> PixelsReadback;
+	}
+}
\ No newline at end of file
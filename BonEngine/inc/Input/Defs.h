@@ -353,7 +353,20 @@ namespace bon
 				MouseRight,
 				MouseX1,
 				MouseX2,
+
+				_Count
 		};
+
+		/**
+		 * Handle of a registered input action.
+		 * Querying actions by handle is much faster than by action id string, get handles with Input().RegisterAction().
+		 */
+		typedef int ActionHandle;
+
+		/**
+		 * Invalid action handle value.
+		 */
+		const ActionHandle InvalidActionHandle = -1;
 	
 		/**
 		 * Convert string to a key code value.
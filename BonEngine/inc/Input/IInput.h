@@ -75,6 +75,48 @@ namespace bon
 			 */
 			virtual bool PressedNow(KeyCodes key) const = 0;
 
+			/**
+			 * Register an action id and get its handle, or get existing handle if already registered.
+			 * Handles are valid for as long as the input manager lives, and querying by handle doesn't involve any string operations.
+			 * Note: action ids are also registered automatically when binding keys to them.
+			 *
+			 * \param actionId Action identifier to register.
+			 * \return Action handle.
+			 */
+			virtual ActionHandle RegisterAction(const char* actionId) = 0;
+
+			/**
+			 * Get the action id of a registered action handle.
+			 *
+			 * \param action Action handle.
+			 * \return Action identifier, or nullptr if handle is invalid.
+			 */
+			virtual const char* GetActionId(ActionHandle action) const = 0;
+
+			/**
+			 * Get if a given game action is down.
+			 *
+			 * \param action Action handle, from RegisterAction().
+			 * \return If input action is currently down.
+			 */
+			virtual bool Down(ActionHandle action) const = 0;
+
+			/**
+			 * Get if a given game action was released this frame
+			 *
+			 * \param action Action handle, from RegisterAction().
+			 * \return If input action was released now.
+			 */
+			virtual bool ReleasedNow(ActionHandle action) const = 0;
+
+			/**
+			 * Get if a given game action was pressed this frame
+			 *
+			 * \param action Action handle, from RegisterAction().
+			 * \return If input action was pressed now.
+			 */
+			virtual bool PressedNow(ActionHandle action) const = 0;
+
 			/**
 			 * Artificially set the state of a given key.
 			 *
@@ -98,6 +140,14 @@ namespace bon
 			 */
 			virtual std::vector<KeyCodes> GetAssignedKeys(const char* actionId) const = 0;
 
+			/**
+			 * Get all key codes assigned to a given action handle.
+			 *
+			 * \param action Action handle to get assigned keys to.
+			 * \return Vector with all keys currently assigned to action.
+			 */
+			virtual std::vector<KeyCodes> GetAssignedKeys(ActionHandle action) const = 0;
+
 			/**
 			 * Load controls from a config file. All keys must be under 'controls' section.
 			 *
@@ -129,13 +179,22 @@ namespace bon
 			virtual const framework::PointI& CursorDelta() const = 0;
 
 			/**
-			 * Bind a key to an action id.
+			 * Bind a key to an action id, replacing any previous actions bound to this key.
 			 *
 			 * \param keyCode Key code to bind.
 			 * \param actionId Action to trigger when this key pressed.
 			 */
 			virtual void SetKeyBind(KeyCodes keyCode, const char* actionId) = 0;
 
+			/**
+			 * Bind a key to an additional action id, without removing previous actions bound to this key.
+			 * Keys can trigger multiple actions, and actions can be triggered by multiple keys.
+			 *
+			 * \param keyCode Key code to bind.
+			 * \param actionId Action to trigger when this key pressed.
+			 */
+			virtual void AddKeyBind(KeyCodes keyCode, const char* actionId) = 0;
+
 			/**
 			 * Set clipboard value.
 			 * 
@@ -10,6 +10,8 @@
 #include "IInput.h"
 #include "../Framework/Point.h"
 #include <unordered_map>
+#include <vector>
+#include <string>
 
 
 namespace bon
@@ -33,14 +35,29 @@ namespace bon
 				unsigned long long FixedUpdateFrameId = -1;
 			};
 
-			// raw keyboard, keys, scroller and even mouse-move values
-			std::unordered_map<KeyCodes, _ActionStates> _currKeyStates;
+			// number of key codes
+			static const size_t KeysCount = (size_t)KeyCodes::_Count;
 
-			// bind keys to commands
-			std::unordered_map<KeyCodes, std::string> _keyBinds;
+			// raw keyboard and mouse keys states, indexed by key code
+			_ActionStates _currKeyStates[KeysCount];
 
-			// action states
-			std::unordered_map<std::string, _ActionStates> _actionStates;
+			// actions bound to every key, indexed by key code
+			std::vector<ActionHandle> _keyBinds[KeysCount];
+
+			// how many key binds we have in total
+			size_t _keyBindsCount = 0;
+
+			// registered actions handles, by action id
+			std::unordered_map<std::string, ActionHandle> _actionHandles;
+
+			// registered action ids, indexed by handle
+			std::vector<std::string> _actionIds;
+
+			// keys bound to every action, indexed by handle
+			std::vector<std::vector<KeyCodes>> _actionKeys;
+
+			// action states, indexed by handle
+			std::vector<_ActionStates> _actionStates;
 
 			// the position of mouse or other pointers
 			framework::PointI _cursorPosition;
@@ -104,6 +121,48 @@ namespace bon
 			 */
 			virtual bool PressedNow(KeyCodes key) const override;
 
+			/**
+			 * Register an action id and get its handle, or get existing handle if already registered.
+			 * Handles are valid for as long as the input manager lives, and querying by handle doesn't involve any string operations.
+			 * Note: action ids are also registered automatically when binding keys to them.
+			 *
+			 * \param actionId Action identifier to register.
+			 * \return Action handle.
+			 */
+			virtual ActionHandle RegisterAction(const char* actionId) override;
+
+			/**
+			 * Get the action id of a registered action handle.
+			 *
+			 * \param action Action handle.
+			 * \return Action identifier, or nullptr if handle is invalid.
+			 */
+			virtual const char* GetActionId(ActionHandle action) const override;
+
+			/**
+			 * Get if a given game action is down.
+			 *
+			 * \param action Action handle, from RegisterAction().
+			 * \return If input action is currently down.
+			 */
+			virtual bool Down(ActionHandle action) const override;
+
+			/**
+			 * Get if a given game action was released this frame
+			 *
+			 * \param action Action handle, from RegisterAction().
+			 * \return If input action was released now.
+			 */
+			virtual bool ReleasedNow(ActionHandle action) const override;
+
+			/**
+			 * Get if a given game action was pressed this frame
+			 *
+			 * \param action Action handle, from RegisterAction().
+			 * \return If input action was pressed now.
+			 */
+			virtual bool PressedNow(ActionHandle action) const override;
+
 			/**
 			 * Artificially set the state of a given key.
 			 *
@@ -142,13 +201,22 @@ namespace bon
 			virtual const framework::PointI& CursorDelta() const override { return _cursorMovement; }
 
 			/**
-			 * Bind a key to an action id.
+			 * Bind a key to an action id, replacing any previous actions bound to this key.
 			 * 
 			 * \param keyCode Key code to bind.
 			 * \param actionId Action to trigger when this key pressed.
 			 */
 			virtual void SetKeyBind(KeyCodes keyCode, const char* actionId) override;
 
+			/**
+			 * Bind a key to an additional action id, without removing previous actions bound to this key.
+			 * Keys can trigger multiple actions, and actions can be triggered by multiple keys.
+			 *
+			 * \param keyCode Key code to bind.
+			 * \param actionId Action to trigger when this key pressed.
+			 */
+			virtual void AddKeyBind(KeyCodes keyCode, const char* actionId) override;
+
 			/**
 			 * Get all key codes assigned to a given action id.
 			 *
@@ -157,6 +225,14 @@ namespace bon
 			 */
 			virtual std::vector<KeyCodes> GetAssignedKeys(const char* actionId) const override;
 
+			/**
+			 * Get all key codes assigned to a given action handle.
+			 *
+			 * \param action Action handle to get assigned keys to.
+			 * \return Vector with all keys currently assigned to action.
+			 */
+			virtual std::vector<KeyCodes> GetAssignedKeys(ActionHandle action) const override;
+
 			/**
 			 * Set clipboard value.
 			 *
@@ -204,6 +280,22 @@ namespace bon
 			 */
 			KeyStates GetState(KeyCodes keyCode) const;
 
+			/**
+			 * Get key state from stored state and update frames.
+			 *
+			 * \param state Stored state to convert.
+			 * \return Key state.
+			 */
+			KeyStates GetState(const _ActionStates& state) const;
+
+			/**
+			 * Get handle of an action id without registering it.
+			 *
+			 * \param actionId Action to get.
+			 * \return Action handle, or InvalidActionHandle if not registered.
+			 */
+			ActionHandle FindAction(const char* actionId) const;
+
 			/**
 			 * Initialize manager when engine starts.
 			 */
@@ -242,6 +334,21 @@ namespace bon
 			 */
 			void SetDefaultKeyBinds();
 
+			/**
+			 * Remove all actions bound to a key.
+			 */
+			void RemoveKeyBinds(KeyCodes keyCode);
+
+			/**
+			 * Remove all key binds.
+			 */
+			void ClearKeyBinds();
+
+			/**
+			 * Update action state from the states of all keys bound to it.
+			 */
+			void UpdateActionState(ActionHandle action, const _ActionStates& changedKeyState);
+
 			// current frame's text input data
 			TextInputData _textInputData;
 		};
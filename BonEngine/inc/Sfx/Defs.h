@@ -28,6 +28,16 @@ namespace bon
 		 */
 		static const SoundChannelId InvalidSoundChannel = -2;
 
+		/**
+		 * Represent the handle of a sound emitter, used for positional audio.
+		 */
+		typedef BON_DLLEXPORT int SoundEmitterId;
+
+		/**
+		 * Define emitter id for invalid emitter / errors.
+		 */
+		static const SoundEmitterId InvalidSoundEmitter = -1;
+
 		/**
 		 * Format types for audio initialization.
 		 */
@@ -35,5 +45,73 @@ namespace bon
 		{
 			U8, S8, U16LSB, S16LSB, U16MSB, S16MSB
 		};
+
+		/**
+		 * Resampling quality for pitched sounds.
+		 */
+		enum class BON_DLLEXPORT ResampleQuality
+		{
+			// linear interpolation between 2 samples. fastest, but dull and may alias.
+			Linear = 0,
+
+			// cubic interpolation between 4 samples. good balance between quality and speed.
+			Cubic = 1,
+
+			// 8 taps windowed sinc. best quality, slowest.
+			Sinc = 2,
+		};
+
+		/**
+		 * Mix buses sounds are routed to.
+		 * Every bus has its own volume and DSP inserts, before being mixed into the final output.
+		 */
+		enum class BON_DLLEXPORT SoundBus
+		{
+			// sound effects (default bus for sounds).
+			Sfx = 0,
+
+			// music tracks.
+			Music = 1,
+
+			// user interface sounds.
+			UI = 2,
+
+			// dialogs and voice overs.
+			Voice = 3,
+
+			// buses count.
+			_Count = 4,
+		};
+
+		/**
+		 * What to do when a sound can't get a voice, because it reached its max instances or all voices are in use.
+		 */
+		enum class BON_DLLEXPORT VoiceStealPolicy
+		{
+			// stop the oldest instance (or lowest priority voice) and play the new sound.
+			Oldest = 0,
+
+			// stop the quietest instance (or lowest priority voice) and play the new sound.
+			Quietest = 1,
+
+			// don't play the new sound.
+			None = 2,
+		};
+
+		/**
+		 * How sound emitters volume drops with distance from listener.
+		 * Emitters are always at full volume up to their min distance, and silent beyond their max distance.
+		 */
+		enum class BON_DLLEXPORT SoundRolloff
+		{
+			// volume drops linearly from min distance to max distance.
+			Linear = 0,
+
+			// volume drops like real sounds: min distance / distance.
+			Inverse = 1,
+
+			// volume drops fast: (min distance / distance) ^ 2.
+			InverseSquare = 2,
+		};
 	}
 }
\ No newline at end of file
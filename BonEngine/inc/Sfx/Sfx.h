@@ -127,6 +127,158 @@ namespace bon
 			 */
 			virtual void SetChannelVolume(SoundChannelId channel, int volume) override;
 
+			/**
+			 * Set the pitch of a currently playing sound channel.
+			 * Pitch can change smoothly while the sound is playing, for example to follow an engine RPM.
+			 *
+			 * \param channel Channel id to set (or AllChannels for all channels).
+			 * \param pitch Pitch to set (1 = no pitch).
+			 */
+			virtual void SetChannelPitch(SoundChannelId channel, float pitch) override;
+
+			/**
+			 * Get the pitch of a sound channel.
+			 *
+			 * \param channel Channel id to get pitch for.
+			 * \return Channel pitch.
+			 */
+			virtual float GetChannelPitch(SoundChannelId channel) const override;
+
+			/**
+			 * Set resampling quality for pitched sounds.
+			 *
+			 * \param quality Resampling quality (default is Cubic).
+			 */
+			virtual void SetResampleQuality(ResampleQuality quality) override;
+
+			/**
+			 * Get resampling quality for pitched sounds.
+			 */
+			virtual ResampleQuality GetResampleQuality() const override;
+
+			/**
+			 * Set the volume of a mix bus.
+			 * Sounds play on the bus set with 'Sound->SetBus()', music plays on the Music bus.
+			 *
+			 * \param bus Bus to set volume for.
+			 * \param volume Bus volume (0.0 - 1.0).
+			 */
+			virtual void SetBusVolume(SoundBus bus, float volume) override;
+
+			/**
+			 * Get the volume of a mix bus.
+			 */
+			virtual float GetBusVolume(SoundBus bus) const override;
+
+			/**
+			 * Add DSP insert to a mix bus, to process its samples before they are mixed into output.
+			 * Inserts are processed in the order they were added, from the audio thread.
+			 *
+			 * \param bus Bus to add insert to.
+			 * \param dsp DSP to add.
+			 */
+			virtual void AddBusInsert(SoundBus bus, SoundDsp dsp) override;
+
+			/**
+			 * Remove DSP insert from a mix bus.
+			 */
+			virtual void RemoveBusInsert(SoundBus bus, SoundDsp dsp) override;
+
+			/**
+			 * Get how long a bus DSP insert takes to process an audio block, in microseconds.
+			 *
+			 * \param bus Bus DSP is inserted on.
+			 * \param dsp DSP to get cost of.
+			 * \param averageTime Will be set to average processing time since DSP was added.
+			 * \param maxTime Will be set to longest processing time since DSP was added.
+			 * \return False if DSP is not inserted on bus.
+			 */
+			virtual bool GetBusInsertCost(SoundBus bus, SoundDsp dsp, double& averageTime, double& maxTime) override;
+
+			/**
+			 * Write audio thread stats to log: callbacks, underruns, callbacks load histogram and buses DSP inserts cost.
+			 * Stats are also available as diagnostics counters and histograms.
+			 */
+			virtual void LogAudioStats() override;
+
+			/**
+			 * Get if audio is rendered offline (see 'OfflineAudio' feature).
+			 */
+			virtual bool IsOfflineAudio() const override;
+
+			/**
+			 * Render mixer output into buffer, when audio is rendered offline.
+			 * Useful to benchmark or test audio without an audio device.
+			 *
+			 * \param buffer Output buffer, interleaved float samples. Must have room for frames * output channels.
+			 * \param frames Frames to render.
+			 * \return How many frames were rendered (0 if audio is not offline).
+			 */
+			virtual int RenderOffline(float* buffer, int frames) override;
+
+			/**
+			 * Set the listener transform for positional audio.
+			 *
+			 * \param position Listener position (usually the camera or player position).
+			 * \param rotation Listener rotation, in degrees.
+			 */
+			virtual void SetListener(const framework::PointF& position, float rotation = 0.0f) override;
+
+			/**
+			 * Get the listener position.
+			 */
+			virtual const framework::PointF& GetListenerPosition() const override;
+
+			/**
+			 * Set the distance from listener at which sounds are panned completely to one side (default is 500).
+			 */
+			virtual void SetSpatialPanDistance(float distance) override;
+
+			/**
+			 * Create a sound emitter for positional audio.
+			 * Gain and panning of sounds played on emitters are updated automatically every frame, based on emitter and listener positions.
+			 *
+			 * \param position Emitter position.
+			 * \param minDistance Distance from listener up to which emitter plays at full volume.
+			 * \param maxDistance Distance from listener beyond which emitter is silent (and its sounds become virtual).
+			 * \param rolloff How volume drops between min and max distance.
+			 * \return Emitter id.
+			 */
+			virtual SoundEmitterId CreateEmitter(const framework::PointF& position, float minDistance = 50.0f, float maxDistance = 1000.0f, SoundRolloff rolloff = SoundRolloff::Inverse) override;
+
+			/**
+			 * Destroy a sound emitter. Sounds playing on it will keep playing with their last volume and panning.
+			 */
+			virtual void DestroyEmitter(SoundEmitterId emitter) override;
+
+			/**
+			 * Set sound emitter position.
+			 */
+			virtual void SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position) override;
+
+			/**
+			 * Get sound emitter position.
+			 */
+			virtual framework::PointF GetEmitterPosition(SoundEmitterId emitter) const override;
+
+			/**
+			 * Set sound emitter distances and rolloff curve.
+			 */
+			virtual void SetEmitterRolloff(SoundEmitterId emitter, float minDistance, float maxDistance, SoundRolloff rolloff) override;
+
+			/**
+			 * Play a sound effect on a sound emitter.
+			 *
+			 * \param emitter Emitter to play sound on.
+			 * \param sound Sound track to play.
+			 * \param volume Playing sound volume (1-100 is recommanded range).
+			 * \param loops How many times to repeat the sound track (-1 = endless loop).
+			 * \param pitch Apply pitch effect on sound effect (1 = no pitch).
+			 * \param fadeInTime If not 0, will fade sound in over this time period (in seconds).
+			 * \return channel id to allow control over this sound while it plays. If fail to play sound, will return InvalidSoundChannel.
+			 */
+			virtual SoundChannelId PlaySoundAt(SoundEmitterId emitter, assets::SoundAsset sound, int volume = 100, int loops = 0, float pitch = 1.0f, float fadeInTime = 0) override;
+
 			/**
 			 * Set channel distance from listener (affect volume).
 			 *
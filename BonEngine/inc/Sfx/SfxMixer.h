@@ -0,0 +1,455 @@
+/*****************************************************************//**
+ * \file   SfxMixer.h
+ * \brief  Engine software mixer, mixing voices into float buses.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <Sfx/Defs.h>
+#include <Sfx/SoundDsp.h>
+#include <Sfx/SfxSoundStream.h>
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Software mixer that plays sounds on voices, mixes them into float buses, runs buses DSP inserts, and writes the final output.
+		 * Mixing is called from the audio thread (or from the main thread when rendering offline), while voices are controlled from the main thread.
+		 * Voices parameters are atomic, so controlling them never blocks the audio thread.
+		 */
+		class SfxMixer
+		{
+		public:
+
+			/**
+			 * Audio thread timing stats, written by the audio thread without locks or allocations, and collected by the main thread.
+			 * Max values are since last time main thread collected them.
+			 */
+			struct Stats
+			{
+				/**
+				 * Callback load histogram buckets count and size (in percent of buffer duration).
+				 */
+				static const int LoadBuckets = 16;
+				static const int LoadBucketSize = 10;
+
+				// total callbacks, underruns (callbacks that took longer than buffer duration or came late) and streams that ran out of frames
+				std::atomic<uint64_t> Callbacks{ 0 };
+				std::atomic<uint64_t> Underruns{ 0 };
+				std::atomic<uint64_t> StreamUnderruns{ 0 };
+
+				// longest callback, in microseconds and in percent of buffer duration
+				std::atomic<uint32_t> MaxCallbackTime{ 0 };
+				std::atomic<uint32_t> MaxCallbackLoad{ 0 };
+
+				// longest time in DSP inserts while mixing a single block, in microseconds
+				std::atomic<uint32_t> MaxDspTime{ 0 };
+
+				// callbacks count per load bucket
+				std::atomic<uint32_t> Load[LoadBuckets];
+
+				/**
+				 * Init stats.
+				 */
+				Stats() { for (auto& bucket : Load) { bucket = 0; } }
+			};
+
+			/**
+			 * DSP insert processing cost.
+			 */
+			struct DspCost
+			{
+				// processed blocks, and total processing time in microseconds
+				std::atomic<uint64_t> Blocks{ 0 };
+				std::atomic<uint64_t> TotalTime{ 0 };
+
+				// longest block processing time, in microseconds
+				std::atomic<uint32_t> MaxTime{ 0 };
+			};
+
+		private:
+
+			// voice states
+			enum VoiceStates
+			{
+				// voice is free to use
+				Free = 0,
+
+				// main thread is setting up the voice
+				Starting = 1,
+
+				// voice is playing
+				Playing = 2,
+
+				// voice was stopped immediately, audio thread will free it without reading its samples
+				Stopping = 3,
+			};
+
+			// a sound playing on the mixer
+			struct Voice
+			{
+				// voice state
+				std::atomic<int> State{ Free };
+
+				// source samples, in mixer format, and frames count
+				const void* Data = nullptr;
+				uint32_t Frames = 0;
+
+				// if set, voice plays from this stream instead of source samples (data is only used to identify the sound)
+				SoundStream* Stream = nullptr;
+
+				// bus to mix into
+				SoundBus Bus = SoundBus::Sfx;
+
+				// parameters that can change while playing
+				std::atomic<float> Volume{ 1.0f };
+				std::atomic<float> PanLeft{ 1.0f };
+				std::atomic<float> PanRight{ 1.0f };
+				std::atomic<float> Distance{ 0.0f };
+				std::atomic<float> Pitch{ 1.0f };
+
+				// fade out request, in seconds (0 = no request)
+				std::atomic<float> FadeOutRequest{ 0.0f };
+
+				// if true, voice keeps its position without being mixed
+				std::atomic<bool> Virtual{ false };
+
+				// following fields are only used by the audio thread after voice starts playing.
+				// how many loops left to play (-1 = endless)
+				int LoopsLeft = 0;
+
+				// playback position, in fixed point frames (for streams, relative to stream read position)
+				uint64_t Position = 0;
+
+				// fade in / out progress, in frames
+				int FadeInTotal = 0;
+				int FadeInDone = 0;
+				int FadeOutTotal = 0;
+				int FadeOutLeft = 0;
+
+				// gains applied in last block, to ramp from when gains change (negative = first block).
+				// virtual voices ramp down to 0 before they stop being mixed, and ramp up from 0 when they become real again
+				float LastGainLeft = -1.0f;
+				float LastGainRight = -1.0f;
+			};
+
+			// a mix bus
+			struct Bus
+			{
+				// bus volume
+				std::atomic<float> Volume{ 1.0f };
+
+				// volume applied in last block, to ramp from when volume changes
+				float LastVolume = 1.0f;
+
+				// bus samples buffer
+				std::vector<float> Buffer;
+			};
+
+			// voices
+			std::vector<Voice> _voices;
+
+			// buses
+			Bus _buses[(int)SoundBus::_Count];
+
+			// buses DSP inserts, processed in order, and their processing cost.
+			// snapshots are immutable once published to the audio thread; changing inserts publishes a new snapshot
+			struct InsertsSnapshot
+			{
+				std::vector<SoundDsp> Inserts[(int)SoundBus::_Count];
+				std::vector<std::shared_ptr<DspCost>> Costs[(int)SoundBus::_Count];
+			};
+
+			// current inserts snapshot, and the snapshot audio thread reads (points to current snapshot once its published)
+			std::unique_ptr<InsertsSnapshot> _inserts{ new InsertsSnapshot() };
+			std::atomic<const InsertsSnapshot*> _publishedInserts{ _inserts.get() };
+
+			// protect changing inserts snapshot (audio thread never locks it)
+			std::mutex _insertsMutex;
+
+			// voice samples buffer, and output buffer when mixing to device
+			std::vector<float> _voiceBuffer;
+			std::vector<float> _outBuffer;
+
+			// buffer to copy stream frames into before resampling them
+			std::vector<float> _streamBuffer;
+
+			// mixer format
+			int _frequency = 44100;
+			uint16_t _format = 0;
+			int _channels = 2;
+			int _blockFrames = 0;
+
+			// resampling quality
+			std::atomic<ResampleQuality> _quality{ ResampleQuality::Cubic };
+
+			// is rendering offline (no audio device)
+			bool _offline = false;
+
+			// audio thread stats, and last callback start time (in microseconds, 0 = no callback yet)
+			Stats _stats;
+			uint64_t _lastCallbackTime = 0;
+
+			// incremented when audio thread starts and ends mixing to device (odd = audio thread is mixing)
+			std::atomic<uint64_t> _mixEpoch{ 0 };
+
+		public:
+
+			/**
+			 * Initialize mixer.
+			 *
+			 * \param frequency Samples frequency.
+			 * \param format Samples format (SDL audio format).
+			 * \param channels Output channels count.
+			 * \param voicesCount How many voices to create.
+			 * \param blockFrames Max frames to mix at once.
+			 * \param offline If true, mixer will only render when calling 'RenderOffline()'.
+			 */
+			void Initialize(int frequency, uint16_t format, int channels, int voicesCount, int blockFrames, bool offline);
+
+			/**
+			 * Start playing a sound on a free voice.
+			 *
+			 * \param data Source samples, in mixer format.
+			 * \param bytes Source size in bytes.
+			 * \param bus Bus to mix into.
+			 * \param volume Voice volume (0-1).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \param pitch Starting pitch.
+			 * \param fadeInTime Fade in time, in seconds.
+			 * \param startVirtual If true, voice will start as virtual voice.
+			 * \param stream If set, voice will play from this stream and 'data' will only be used to identify the sound. Mixer releases the stream when voice ends.
+			 * \return Voice index, or -1 if there are no free voices.
+			 */
+			int StartVoice(const void* data, uint32_t bytes, SoundBus bus, float volume, int loops, float pitch, float fadeInTime, bool startVirtual = false, SoundStream* stream = nullptr);
+
+			/**
+			 * Stop a voice, with a short fade out to avoid clicks.
+			 */
+			void StopVoice(int voice);
+
+			/**
+			 * Stop a voice immediately, without reading its samples again.
+			 * Use when samples are about to be freed (and call 'WaitForAudioThread()' before freeing them).
+			 */
+			void StopVoiceNow(int voice);
+
+			/**
+			 * Fade out voice and stop it.
+			 */
+			void FadeOutVoice(int voice, float fadeOutTime);
+
+			/**
+			 * Set voice volume (0-1).
+			 */
+			void SetVolume(int voice, float volume);
+
+			/**
+			 * Get voice volume.
+			 */
+			float GetVolume(int voice) const;
+
+			/**
+			 * Get voice final gain, including distance, panning and bus volume.
+			 * Used to tell how audible a voice is.
+			 */
+			float GetAudibleGain(int voice) const;
+
+			/**
+			 * Set if voice is virtual (keeps its position without being mixed).
+			 */
+			void SetVirtual(int voice, bool isVirtual);
+
+			/**
+			 * Get if voice is virtual.
+			 */
+			bool IsVirtual(int voice) const;
+
+			/**
+			 * Set voice panning (0-1 per side).
+			 */
+			void SetPanning(int voice, float panLeft, float panRight);
+
+			/**
+			 * Set voice distance from listener (0-1, affects volume).
+			 */
+			void SetDistance(int voice, float distance);
+
+			/**
+			 * Set panning and distance of many voices at once.
+			 *
+			 * \param voices Voice indices.
+			 * \param pansLeft Pan left value per voice.
+			 * \param pansRight Pan right value per voice.
+			 * \param distances Distance per voice.
+			 * \param count Voices count.
+			 */
+			void SetSpatial(const int* voices, const float* pansLeft, const float* pansRight, const float* distances, int count);
+
+			/**
+			 * Set voice pitch.
+			 */
+			void SetPitch(int voice, float pitch);
+
+			/**
+			 * Get voice pitch.
+			 */
+			float GetPitch(int voice) const;
+
+			/**
+			 * Get if a voice is playing.
+			 *
+			 * \param voice Voice index.
+			 * \param data If not null, will also check if voice plays these samples.
+			 */
+			bool IsPlaying(int voice, const void* data = nullptr) const;
+
+			/**
+			 * Wait until the audio thread is done with any mixing that started before this call.
+			 * After stopping voices, call this before freeing their samples: mixing that starts later will only free the stopped voices without reading them.
+			 */
+			void WaitForAudioThread() const;
+
+			/**
+			 * Stop voices still playing any of the given samples right away, and wait for audio thread once for all of them.
+			 * After this call its safe to free the samples.
+			 *
+			 * \param data Source samples to release.
+			 */
+			void ReleaseSamples(const std::vector<const void*>& data);
+
+			/**
+			 * Get voices count.
+			 */
+			inline int VoicesCount() const { return (int)_voices.size(); }
+
+			/**
+			 * Set bus volume (0-1).
+			 */
+			void SetBusVolume(SoundBus bus, float volume);
+
+			/**
+			 * Get bus volume.
+			 */
+			float GetBusVolume(SoundBus bus) const;
+
+			/**
+			 * Add DSP insert to bus.
+			 */
+			void AddInsert(SoundBus bus, SoundDsp dsp);
+
+			/**
+			 * Remove DSP insert from bus.
+			 */
+			void RemoveInsert(SoundBus bus, SoundDsp dsp);
+
+			/**
+			 * Get DSP insert average and max processing time per block, in microseconds.
+			 * Returns false if DSP is not inserted on bus.
+			 */
+			bool GetInsertCost(SoundBus bus, SoundDsp dsp, double& averageTime, double& maxTime);
+
+			/**
+			 * Get audio thread stats.
+			 */
+			inline Stats& GetStats() { return _stats; }
+
+			/**
+			 * Write buses DSP inserts cost to log.
+			 */
+			void LogInsertsCost();
+
+			/**
+			 * Set resampling quality.
+			 */
+			inline void SetQuality(ResampleQuality quality) { _quality = quality; }
+
+			/**
+			 * Get resampling quality.
+			 */
+			inline ResampleQuality GetQuality() const { return _quality; }
+
+			/**
+			 * Get if mixer renders offline.
+			 */
+			inline bool IsOffline() const { return _offline; }
+
+			/**
+			 * Get samples frequency.
+			 */
+			inline int Frequency() const { return _frequency; }
+
+			/**
+			 * Get output channels count.
+			 */
+			inline int Channels() const { return _channels; }
+
+			/**
+			 * Mix into audio device stream.
+			 * Stream content on input is used as music bus source (music is decoded by SDL_mixer).
+			 * Called from the audio thread.
+			 *
+			 * \param stream Audio stream, in mixer format.
+			 * \param bytes Stream length in bytes.
+			 */
+			void MixToDevice(void* stream, int bytes);
+
+			/**
+			 * Render mixer output to float buffer.
+			 *
+			 * \param out Output interleaved float frames.
+			 * \param frames Frames to render.
+			 */
+			void Render(float* out, int frames);
+
+		private:
+
+			/**
+			 * Mix a single block into output, up to block frames.
+			 *
+			 * \param out Output interleaved float frames.
+			 * \param frames Frames to mix.
+			 * \param haveMusic If true, music bus buffer was already filled with music samples.
+			 */
+			void MixBlock(float* out, int frames, bool haveMusic);
+
+			/**
+			 * Render a voice into voice buffer, return how many frames were written.
+			 */
+			int RenderVoice(Voice& voice, int frames, ResampleQuality quality);
+
+			/**
+			 * Advance a virtual voice position without rendering it, return how many frames were skipped.
+			 */
+			int SkipVoice(Voice& voice, int frames);
+
+			/**
+			 * Render a voice that plays from a stream into voice buffer, return how many frames were written.
+			 * If stream is not ready yet, writes silence.
+			 */
+			int RenderStream(Voice& voice, int frames, ResampleQuality quality);
+
+			/**
+			 * Advance a virtual voice that plays from a stream, return how many frames were skipped.
+			 */
+			int SkipStream(Voice& voice, int frames);
+
+			/**
+			 * Publish a new inserts snapshot to the audio thread, and free the previous one once audio thread no longer uses it.
+			 * Must be called under inserts mutex.
+			 */
+			void PublishInserts(std::unique_ptr<InsertsSnapshot> inserts);
+
+			/**
+			 * Free a voice and release its stream.
+			 */
+			void FreeVoice(Voice& voice);
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*****************************************************************//**
+ * \file   SfxResampler.h
+ * \brief  Resample and convert sound samples.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <Sfx/Defs.h>
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Resample sound samples to change their playback speed and pitch, and convert samples between audio formats and floats.
+		 * Playback position is tracked in fixed point frames, so pitch can change while a sound is playing without drifting.
+		 * Uses SSE kernels for S16 and F32 samples, and AVX kernels for windowed sinc when supported by CPU.
+		 */
+		class SfxResampler
+		{
+		public:
+
+			/**
+			 * Fraction bits of playback position.
+			 */
+			static const int FractionBits = 32;
+
+			/**
+			 * Min and max supported pitch.
+			 */
+			static constexpr float MinPitch = 0.01f;
+			static constexpr float MaxPitch = 16.0f;
+
+		private:
+
+			// use AVX kernels
+			static bool _useAvx;
+
+		public:
+
+			/**
+			 * Initialize resampler and detect CPU features.
+			 */
+			static void Initialize();
+
+			/**
+			 * Get if audio format is supported (native endian formats only).
+			 *
+			 * \param format SDL audio format.
+			 */
+			static bool IsFormatSupported(uint16_t format);
+
+			/**
+			 * Get pitch as fixed point position step.
+			 */
+			static uint64_t PitchToStep(float pitch);
+
+			/**
+			 * Resample interleaved source frames to float output frames, until output is full or source ends.
+			 *
+			 * \param format Source SDL audio format.
+			 * \param src Source frames.
+			 * \param srcFrames Source frames count.
+			 * \param channels Channels count.
+			 * \param loop If true, will wrap around source edges when reading neighbour samples.
+			 * \param position Playback position, in fixed point frames. Will be advanced.
+			 * \param step Position step per output frame, in fixed point frames.
+			 * \param out Output frames.
+			 * \param outFrames Max frames to write.
+			 * \param quality Resampling quality.
+			 * \return How many frames were written. If less than 'outFrames', source reached its end.
+			 */
+			static int Resample(uint16_t format, const void* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality);
+
+			/**
+			 * Resample int16 interleaved source frames to float output frames.
+			 * Same as the generic version, for S16 samples.
+			 */
+			static int Resample(const int16_t* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality);
+
+			/**
+			 * Resample float interleaved source frames to float output frames.
+			 * Same as the generic version, for F32 samples.
+			 */
+			static int Resample(const float* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality);
+
+			/**
+			 * Convert samples in audio format to floats.
+			 *
+			 * \param format Source SDL audio format.
+			 * \param src Source samples.
+			 * \param out Output floats.
+			 * \param count Samples count.
+			 */
+			static void ToFloat(uint16_t format, const void* src, float* out, size_t count);
+
+			/**
+			 * Convert floats to samples in audio format, with clipping.
+			 *
+			 * \param format Output SDL audio format.
+			 * \param src Source floats, or nullptr to write silence.
+			 * \param out Output samples.
+			 * \param count Samples count.
+			 */
+			static void FromFloat(uint16_t format, const float* src, void* out, size_t count);
+		};
+	}
+}
\ No newline at end of file
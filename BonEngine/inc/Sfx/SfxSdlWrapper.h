@@ -13,6 +13,10 @@
 #include <Framework/Rectangle.h>
 #include <Framework/Color.h>
 #include <Sfx/Defs.h>
+#include <Sfx/SfxMixer.h>
+#include <Sfx/SfxVoiceManager.h>
+#include <Sfx/SfxSpatial.h>
+#include <Sfx/SfxSoundStream.h>
 
  // forward declare some SDL stuff
 struct SDL_Window;
@@ -33,6 +37,36 @@ namespace bon
 			// was audio init?
 			bool _wasInit = false;
 
+			// engine mixer, plays sounds and mixes them with music
+			SfxMixer _mixer;
+
+			// decide which sounds get mixer voices
+			SfxVoiceManager _voiceManager;
+
+			// positional audio
+			SfxSpatial _spatial;
+
+			// decodes compressed sounds while they play
+			SfxStreamDecoder _streamDecoder;
+
+			// underruns count we already logged, and when we last logged them
+			uint64_t _loggedUnderruns = 0;
+			uint32_t _lastUnderrunsLogTime = 0;
+
+			// sound track disposed while voices playing it fade out
+			struct PendingRelease
+			{
+				void* Track;
+				const void* Samples;
+				bool Compressed;
+				uint32_t Time;
+				bool Ready;
+			};
+
+			// sound tracks to free once their voices are done, and temp list of samples we free
+			std::vector<PendingRelease> _pendingReleases;
+			std::vector<const void*> _releasedSamples;
+
 		public:
 
 			/**
@@ -51,6 +85,39 @@ namespace bon
 			 */
 			inline bool IsInit() const { return _wasInit; }
 
+			/**
+			 * Get engine mixer.
+			 */
+			inline SfxMixer& Mixer() { return _mixer; }
+			inline const SfxMixer& Mixer() const { return _mixer; }
+
+			/**
+			 * Get voice manager.
+			 */
+			inline SfxVoiceManager& VoiceManager() { return _voiceManager; }
+			inline const SfxVoiceManager& VoiceManager() const { return _voiceManager; }
+
+			/**
+			 * Get positional audio.
+			 */
+			inline SfxSpatial& Spatial() { return _spatial; }
+			inline const SfxSpatial& Spatial() const { return _spatial; }
+
+			/**
+			 * Get compressed sounds decoder.
+			 */
+			inline SfxStreamDecoder& StreamDecoder() { return _streamDecoder; }
+
+			/**
+			 * Update positional audio and voices, and collect audio thread stats. Called every frame.
+			 */
+			void Update();
+
+			/**
+			 * Write audio thread stats to log.
+			 */
+			void LogAudioStats();
+
 			/**
 			 * Play a music track.
 			 * 
@@ -78,14 +145,27 @@ namespace bon
 			 * Play a sound effect.
 			 *
 			 * \param sound Sound track to play.
-			 * \param volume Playing sound volume (1-100 is recommanded range).
+			 * \param volume Playing sound volume (1-100 is recommanded range, 128 is max).
 			 * \param loops How many times to repeat the sound track (-1 = endless loop).
 			 * \param pitch Apply pitch effect on sound effect (1 = no pitch).
 			 * \param fadeInTime If not 0, will fade sound in over this time period (in seconds).
-			 * \return channel id to enable control over this sound play.
+			 * \return channel id to enable control over this sound play (mixer voice index).
 			 */
 			SoundChannelId PlaySound(assets::SoundAsset sound, int volume = 100, int loops = 0, float pitch = 1.0f, float fadeInTime = 0);
 
+			/**
+			 * Play a sound effect on a sound emitter.
+			 *
+			 * \param emitter Emitter to play sound on.
+			 * \param sound Sound track to play.
+			 * \param volume Playing sound volume (1-100 is recommanded range, 128 is max).
+			 * \param loops How many times to repeat the sound track (-1 = endless loop).
+			 * \param pitch Apply pitch effect on sound effect (1 = no pitch).
+			 * \param fadeInTime If not 0, will fade sound in over this time period (in seconds).
+			 * \return channel id to enable control over this sound play (mixer voice index).
+			 */
+			SoundChannelId PlaySoundAt(SoundEmitterId emitter, assets::SoundAsset sound, int volume = 100, int loops = 0, float pitch = 1.0f, float fadeInTime = 0);
+
 			/**
 			* Test if a given sound is currently playing on a channel.
 			*
@@ -96,17 +176,30 @@ namespace bon
 			bool IsPlaying(assets::SoundAsset sound, SoundChannelId channel = -1) const;
 
 			/**
-			 * Set the volume of a currently playing sound channel, or stop it if volume is 0.
+			 * Set the volume of a currently playing sound channel.
 			 * 
-			 * \param channel Channel id to set.
+			 * \param channel Channel id to set (or AllChannels for all channels).
 			 * \param volume Volume to set, values should range from 1 to 100, or 0 to stop sound.
 			 */
 			void SetVolume(SoundChannelId channel, int volume);
 
+			/**
+			 * Set the pitch of a currently playing sound channel.
+			 *
+			 * \param channel Channel id to set (or AllChannels for all channels).
+			 * \param pitch Pitch to set (1 = no pitch).
+			 */
+			void SetChannelPitch(SoundChannelId channel, float pitch);
+
+			/**
+			 * Get the pitch of a sound channel.
+			 */
+			float GetChannelPitch(SoundChannelId channel) const;
+
 			/**
 			 * Stop playing a channel.
 			 * 
-			 * \param channel Channel id to stop.
+			 * \param channel Channel id to stop (or AllChannels for all channels).
 			 */
 			void StopChannel(SoundChannelId channel);
 
@@ -134,7 +227,7 @@ namespace bon
 			/**
 			 * Set channel panning.
 			 *
-			 * \param channel Channel id to set
+			 * \param channel Channel id to set (or AllChannels for all channels).
 			 * \param panLeft Pan left side value (0.0 - 1.0)
 			 * \param panRight Pan right side value (0.0 - 1.0)
 			 */
@@ -148,10 +241,34 @@ namespace bon
 			 */
 			void SetChannelDistance(SoundChannelId channel, float distance);
 
+			/**
+			 * Free a sound track once voices playing it finished fading out (or right away if audio doesn't play).
+			 * Called when a sound handle is destroyed, after stopping its voices.
+			 *
+			 * \param track Sound track (SDL_mixer chunk or compressed sound).
+			 * \param samples Pointer that identifies track samples on mixer voices.
+			 * \param compressed Is this a compressed sound.
+			 */
+			void ReleaseTrack(void* track, const void* samples, bool compressed);
+
 			/**
 			 * Dispose sfx implementation.
 			 */
 			void Dispose();
+
+		private:
+
+			/**
+			 * Free pending sound tracks that are no longer playing or waited long enough, stopping their voices and waiting for audio thread once for all of them.
+			 *
+			 * \param all If true, will free all pending tracks without waiting for them to fade out.
+			 */
+			void FreePendingTracks(bool all);
+
+			/**
+			 * Collect audio thread stats into diagnostics counters and histograms, and log new underruns.
+			 */
+			void CollectStats();
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,284 @@
+/*****************************************************************//**
+ * \file   SfxSoundStream.h
+ * \brief  Sounds kept compressed in memory, and decoded while playing.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <cstdint>
+
+// forward declare SDL audio stream
+struct _SDL_AudioStream;
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Sound data kept in memory in its source format (ogg vorbis file, or wav PCM samples).
+		 * Immutable after loading, so it can be read from the decoder thread.
+		 */
+		class CompressedSound
+		{
+		public:
+
+			/**
+			 * Supported codecs.
+			 */
+			enum Codecs
+			{
+				// raw PCM samples from a wav file
+				Pcm = 0,
+
+				// ogg vorbis file
+				Vorbis = 1,
+			};
+
+			// sound codec
+			Codecs Codec = Pcm;
+
+			// source data (ogg file bytes, or PCM samples)
+			std::vector<uint8_t> Data;
+
+			// source format (SDL audio format, after vorbis decoding for ogg files)
+			uint16_t Format = 0;
+			int Channels = 0;
+			int Frequency = 0;
+
+			// total frames count
+			uint64_t Frames = 0;
+
+			/**
+			 * Load sound file into memory, without decoding it.
+			 *
+			 * \param path Sound file path.
+			 * \return Loaded sound, or nullptr if format is not supported (supported formats are wav, and ogg if vorbis library is available).
+			 */
+			static CompressedSound* Load(const char* path);
+
+			/**
+			 * Get sound length, in seconds.
+			 */
+			inline float Length() const { return Frequency > 0 ? (float)((double)Frames / (double)Frequency) : 0.0f; }
+		};
+
+		/**
+		 * A compressed sound being decoded into a ring buffer of float frames, in mixer format.
+		 * The decoder thread writes into the ring and the audio thread reads from it, without locks.
+		 */
+		class SoundStream
+		{
+		public:
+
+			/**
+			 * Ring buffer size, in frames (must be power of 2).
+			 */
+			static const int RingFrames = 8192;
+
+			/**
+			 * Frames of history the mixer keeps between blocks, for resampling filters.
+			 */
+			static const int HistoryFrames = 4;
+
+		private:
+
+			// ring buffer and read / write positions, in frames
+			std::vector<float> _ring;
+			std::atomic<uint64_t> _readPosition{ 0 };
+			std::atomic<uint64_t> _writePosition{ 0 };
+
+		public:
+
+			// set by decoder thread when there's nothing more to decode
+			std::atomic<bool> EndOfStream{ false };
+
+			// set by the mixer when voice no longer needs the stream, so decoder thread can reuse it
+			std::atomic<bool> Released{ true };
+
+			// channels count
+			int Channels = 2;
+
+			// last frames the mixer read, used by the audio thread only
+			std::vector<float> History;
+
+			// is stream taken (stays taken until mixer releases it, even if source was closed). used by the decoder, under its mutex
+			bool InUse = false;
+
+			// following fields are only used by the decoder, under stream decode mutex (decoder thread decodes streams without holding the decoder mutex).
+			std::mutex DecodeMutex;
+
+			// sound we decode (nullptr if closed), and loops left to decode (-1 = endless)
+			const CompressedSound* Source = nullptr;
+			int LoopsLeft = 0;
+
+			// converts source samples to mixer format, and the source format it was created for
+			_SDL_AudioStream* Converter = nullptr;
+			uint16_t ConverterFormat = 0;
+			int ConverterChannels = 0;
+			int ConverterFrequency = 0;
+			bool Flushed = false;
+
+			// position in source data (for PCM), and vorbis decoder state
+			size_t SourceOffset = 0;
+			alignas(16) uint8_t VorbisFile[2048];
+			bool VorbisOpen = false;
+
+			// temp buffers for decoding
+			std::vector<uint8_t> SourceBuffer;
+			std::vector<float> FloatBuffer;
+
+			/**
+			 * Create the stream.
+			 */
+			SoundStream(int channels);
+
+			/**
+			 * Get how many frames are ready to read.
+			 */
+			inline int Available() const { return (int)(_writePosition.load(std::memory_order_acquire) - _readPosition.load(std::memory_order_relaxed)); }
+
+			/**
+			 * Copy frames from ring without consuming them. Called from the audio thread.
+			 */
+			void Peek(float* out, int frames) const;
+
+			/**
+			 * Consume frames from ring. Called from the audio thread.
+			 */
+			void Pop(int frames);
+
+			/**
+			 * Get how many frames can be written.
+			 */
+			inline int FreeSpace() const { return RingFrames - (int)(_writePosition.load(std::memory_order_relaxed) - _readPosition.load(std::memory_order_acquire)); }
+
+			/**
+			 * Write frames into ring. Called from the decoder.
+			 */
+			void Push(const float* frames, int count);
+
+			/**
+			 * Reset ring and flags, before reusing the stream.
+			 */
+			void Reset();
+		};
+
+		/**
+		 * Decode compressed sounds into streams, on a worker thread.
+		 * Streams and their converters are pooled and reused between plays.
+		 */
+		class SfxStreamDecoder
+		{
+		public:
+
+			/**
+			 * Frames to decode at once.
+			 */
+			static const int DecodeFrames = 1024;
+
+			/**
+			 * Frames to decode when acquiring a stream, so it can start playing before decoder thread catches up.
+			 * Kept small since its decoded on the calling (main) thread.
+			 */
+			static const int PrefillFrames = 1024;
+
+			/**
+			 * How long decoder thread sleeps between passes, in milliseconds.
+			 */
+			static const int SleepTime = 5;
+
+		private:
+
+			// all streams, and streams currently decoding
+			std::vector<std::unique_ptr<SoundStream>> _streams;
+			std::vector<SoundStream*> _active;
+
+			// protect streams lists (held only briefly, streams are decoded without it)
+			std::mutex _mutex;
+
+			// copy of active streams list, decoded by decoder thread after releasing the mutex
+			std::vector<SoundStream*> _decoding;
+
+			// decoder thread
+			std::thread _thread;
+			std::atomic<bool> _running{ false };
+
+			// mixer format
+			int _frequency = 44100;
+			int _channels = 2;
+
+		public:
+
+			/**
+			 * Stop decoder on destruction.
+			 */
+			~SfxStreamDecoder();
+
+			/**
+			 * Start decoder thread.
+			 *
+			 * \param frequency Mixer samples frequency.
+			 * \param channels Mixer channels count.
+			 */
+			void Start(int frequency, int channels);
+
+			/**
+			 * Stop decoder thread and close all streams.
+			 */
+			void Stop();
+
+			/**
+			 * Get a stream to play a compressed sound on, and decode a short block of its beginning right away (decoder thread fills the rest).
+			 * Stream is returned to pool when the mixer sets its 'Released' flag.
+			 *
+			 * \param source Sound to play.
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \return Stream, or nullptr if sound failed to open.
+			 */
+			SoundStream* Acquire(const CompressedSound* source, int loops);
+
+			/**
+			 * Close all streams decoding the given sound. Must be called before deleting a compressed sound,
+			 * after the voices playing it were stopped.
+			 */
+			void ReleaseSource(const CompressedSound* source);
+
+		private:
+
+			/**
+			 * Decoder thread main loop.
+			 */
+			void Run();
+
+			/**
+			 * Open stream to decode its source from start.
+			 */
+			bool Open(SoundStream& stream);
+
+			/**
+			 * Close stream decoder.
+			 */
+			void Close(SoundStream& stream);
+
+			/**
+			 * Decode into stream until ring is full, sound ends, or decoded enough frames.
+			 *
+			 * \param stream Stream to decode into.
+			 * \param maxFrames Max frames to write into stream ring.
+			 */
+			void Fill(SoundStream& stream, int maxFrames = SoundStream::RingFrames);
+
+			/**
+			 * Decode next chunk of source samples and feed them to stream converter.
+			 * Returns false if reached source end.
+			 */
+			bool DecodeChunk(SoundStream& stream);
+		};
+	}
+}
\ No newline at end of file
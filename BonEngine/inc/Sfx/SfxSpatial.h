@@ -0,0 +1,176 @@
+/*****************************************************************//**
+ * \file   SfxSpatial.h
+ * \brief  2D positional audio: listener and sound emitters.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <Framework/PointF.h>
+#include <Sfx/Defs.h>
+#include <Sfx/SfxMixer.h>
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Positional audio for 2D games.
+		 * Emitters are stored as arrays of values, and once per frame gain and panning of all emitters are calculated in a single vectorized pass,
+		 * and pushed to all voices bound to emitters at once.
+		 * Used only from the main thread.
+		 */
+		class SfxSpatial
+		{
+		private:
+
+			// voice bound to an emitter
+			struct Binding
+			{
+				// voice index
+				int Voice;
+
+				// emitter id
+				SoundEmitterId Emitter;
+
+				// samples voice plays, to know when voice is no longer playing this sound
+				const void* Samples;
+			};
+
+			// mixer to update
+			SfxMixer* _mixer = nullptr;
+
+			// listener transform
+			framework::PointF _listenerPosition;
+			float _listenerRotation = 0.0f;
+
+			// distance at which sounds are panned completely to one side
+			float _panDistance = 500.0f;
+
+			// emitters data (size is always multiple of 4, unused emitters have negative max distance)
+			std::vector<float> _positionsX;
+			std::vector<float> _positionsY;
+			std::vector<float> _minDistances;
+			std::vector<float> _maxDistances;
+			std::vector<float> _rolloffs;
+
+			// emitters calculated gain and panning
+			std::vector<float> _gains;
+			std::vector<float> _pansLeft;
+			std::vector<float> _pansRight;
+
+			// free emitter ids
+			std::vector<SoundEmitterId> _freeEmitters;
+
+			// voices bound to emitters
+			std::vector<Binding> _bindings;
+
+			// batch buffers to push to mixer
+			std::vector<int> _batchVoices;
+			std::vector<float> _batchPansLeft;
+			std::vector<float> _batchPansRight;
+			std::vector<float> _batchDistances;
+
+		public:
+
+			/**
+			 * Initialize spatial audio.
+			 *
+			 * \param mixer Mixer to update voices on.
+			 */
+			void Initialize(SfxMixer* mixer);
+
+			/**
+			 * Set listener transform.
+			 *
+			 * \param position Listener position.
+			 * \param rotation Listener rotation, in degrees.
+			 */
+			void SetListener(const framework::PointF& position, float rotation);
+
+			/**
+			 * Get listener position.
+			 */
+			inline const framework::PointF& ListenerPosition() const { return _listenerPosition; }
+
+			/**
+			 * Get listener rotation.
+			 */
+			inline float ListenerRotation() const { return _listenerRotation; }
+
+			/**
+			 * Set distance at which sounds are panned completely to one side.
+			 */
+			inline void SetPanDistance(float distance) { _panDistance = distance > 0.0f ? distance : 1.0f; }
+
+			/**
+			 * Get distance at which sounds are panned completely to one side.
+			 */
+			inline float PanDistance() const { return _panDistance; }
+
+			/**
+			 * Create a new emitter.
+			 *
+			 * \param position Emitter position.
+			 * \param minDistance Distance up to which emitter plays at full volume.
+			 * \param maxDistance Distance beyond which emitter is silent.
+			 * \param rolloff How volume drops between min and max distance.
+			 * \return Emitter id.
+			 */
+			SoundEmitterId CreateEmitter(const framework::PointF& position, float minDistance, float maxDistance, SoundRolloff rolloff);
+
+			/**
+			 * Destroy an emitter. Voices bound to it will keep playing with their last gain and panning.
+			 */
+			void DestroyEmitter(SoundEmitterId emitter);
+
+			/**
+			 * Get if emitter id is valid.
+			 */
+			bool IsValid(SoundEmitterId emitter) const;
+
+			/**
+			 * Set emitter position.
+			 */
+			void SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position);
+
+			/**
+			 * Get emitter position.
+			 */
+			framework::PointF GetEmitterPosition(SoundEmitterId emitter) const;
+
+			/**
+			 * Set emitter rolloff.
+			 */
+			void SetEmitterRolloff(SoundEmitterId emitter, float minDistance, float maxDistance, SoundRolloff rolloff);
+
+			/**
+			 * Bind a playing voice to emitter, and set its gain and panning immediately.
+			 *
+			 * \param voice Voice index.
+			 * \param emitter Emitter id.
+			 * \param samples Samples voice plays.
+			 */
+			void Bind(int voice, SoundEmitterId emitter, const void* samples);
+
+			/**
+			 * Calculate all emitters gain and panning, and push them to voices. Called every frame.
+			 */
+			void Update();
+
+		private:
+
+			/**
+			 * Calculate gain and panning of all emitters.
+			 */
+			void CalculateEmitters();
+
+			/**
+			 * Calculate gain and panning of a single emitter.
+			 */
+			void CalculateEmitter(int index);
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+/*****************************************************************//**
+ * \file   SfxVoiceManager.h
+ * \brief  Decide which sounds get mixer voices.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <Assets/Types/Sound.h>
+#include <Sfx/Defs.h>
+#include <Sfx/SfxMixer.h>
+#include <Sfx/SfxSoundStream.h>
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * Manage mixer voices: limit sound instances, steal voices by priority, coalesce identical one-shots played in the same frame,
+		 * and turn inaudible or lowest priority sounds into virtual voices, that keep their position without being mixed.
+		 * Used only from the main thread.
+		 */
+		class SfxVoiceManager
+		{
+		public:
+
+			/**
+			 * Extra mixer voices reserved for stolen voices that are still fading out.
+			 */
+			static const int SpareVoices = 16;
+
+			/**
+			 * Fade out time of stolen voices, in seconds.
+			 */
+			static constexpr float StealFadeOutTime = 0.01f;
+
+			/**
+			 * Voices with gain below this value are inaudible, and become virtual.
+			 */
+			static constexpr float AudibleGainThreshold = 0.001f;
+
+		private:
+
+			// info about a voice we started
+			struct VoiceInfo
+			{
+				// samples playing on this voice (nullptr if voice is not managed)
+				const void* Samples = nullptr;
+
+				// sound priority
+				int Priority = 0;
+
+				// to tell which voice started first
+				uint64_t StartOrder = 0;
+			};
+
+			// mixer to play on
+			SfxMixer* _mixer = nullptr;
+
+			// voices info, per mixer voice
+			std::vector<VoiceInfo> _infos;
+
+			// playing voices per sound samples
+			std::unordered_map<const void*, std::vector<int>> _instances;
+
+			// one-shot sounds played during this frame, to coalesce identical sounds
+			std::vector<std::pair<const void*, int>> _frameOneShots;
+
+			// temp buffers to sort voices
+			std::vector<int> _sortedVoices;
+			std::vector<float> _gains;
+
+			// voices limits
+			int _maxRealVoices = 0;
+			int _maxVoices = 0;
+
+			// current active and real voices count
+			int _activeVoices = 0;
+			int _realVoices = 0;
+
+			// counter to set voices start order
+			uint64_t _startCounter = 0;
+
+		public:
+
+			/**
+			 * Get how many mixer voices are needed.
+			 *
+			 * \param realVoices Max voices to mix at the same time.
+			 * \param virtualVoices Max extra voices to play as virtual voices.
+			 */
+			static inline int MixerVoicesCount(int realVoices, int virtualVoices) { return realVoices + virtualVoices + SpareVoices; }
+
+			/**
+			 * Initialize voice manager, after mixer was initialized.
+			 *
+			 * \param mixer Mixer to play sounds on.
+			 * \param realVoices Max voices to mix at the same time.
+			 * \param virtualVoices Max extra voices to play as virtual voices.
+			 */
+			void Initialize(SfxMixer* mixer, int realVoices, int virtualVoices);
+
+			/**
+			 * Play a sound, stealing a voice if needed.
+			 *
+			 * \param sound Sound to play, to get its voice settings.
+			 * \param samples Sound samples, in mixer format (or compressed sound, if decoder is set).
+			 * \param bytes Sound samples size in bytes.
+			 * \param volume Voice volume (0-1).
+			 * \param loops How many times to repeat the sound (-1 = endless loop).
+			 * \param pitch Starting pitch.
+			 * \param fadeInTime Fade in time, in seconds.
+			 * \param decoder If set, samples is a compressed sound, and voice will play from a stream of this decoder.
+			 * \return Voice index, or -1 if sound was not played.
+			 */
+			int Play(const assets::_Sound& sound, const void* samples, uint32_t bytes, float volume, int loops, float pitch, float fadeInTime, SfxStreamDecoder* decoder = nullptr);
+
+			/**
+			 * Get if any voice plays the given sound samples.
+			 */
+			bool IsPlaying(const void* samples) const;
+
+			/**
+			 * Stop all voices playing the given sound samples.
+			 */
+			void StopSound(const void* samples);
+
+			/**
+			 * Update real and virtual voices and diagnostics counters. Called every frame.
+			 */
+			void Update();
+
+		private:
+
+			/**
+			 * Pick a voice to steal out of candidates, or -1 if there are no candidates.
+			 * Prefer lowest priority voices, and then by policy.
+			 */
+			int PickVictim(const std::vector<int>& candidates, VoiceStealPolicy policy) const;
+
+			/**
+			 * Steal a voice (fade it out quickly and stop tracking it).
+			 */
+			void Steal(int voice);
+
+			/**
+			 * Remove finished voices from sound instances list.
+			 */
+			void PurgeInstances(const void* samples, std::vector<int>& instances);
+		};
+	}
+}
\ No newline at end of file
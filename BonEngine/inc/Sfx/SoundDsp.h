@@ -0,0 +1,46 @@
+/*****************************************************************//**
+ * \file   SoundDsp.h
+ * \brief  Define interface for DSP effects inserted on mix buses.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include <memory>
+
+namespace bon
+{
+	namespace sfx
+	{
+		/**
+		 * A DSP effect that can be inserted on a mix bus, to process the bus samples before they are mixed into the final output.
+		 * For example: filters, reverb, compressor, ducking, etc.
+		 */
+		class BON_DLLEXPORT ISoundDsp
+		{
+		public:
+
+			/**
+			 * Virtual destructor.
+			 */
+			virtual ~ISoundDsp() {}
+
+			/**
+			 * Process bus samples in place.
+			 * Called from the audio thread, so must be fast, and must not block or allocate memory.
+			 *
+			 * \param frames Interleaved float samples, in range -1 to 1.
+			 * \param framesCount Frames count.
+			 * \param channels Channels count.
+			 * \param frequency Samples frequency.
+			 */
+			virtual void Process(float* frames, int framesCount, int channels, int frequency) = 0;
+		};
+
+		/**
+		 * DSP effect pointer.
+		 */
+		typedef BON_DLLEXPORT std::shared_ptr<ISoundDsp> SoundDsp;
+	}
+}
\ No newline at end of file
@@ -76,6 +76,24 @@ namespace bon
 		// for backward competability after changing Alignment enum
 		#define UITextAlignment UIAlignment
 
+		/**
+		 * How to arrange children of an element with 'AutoArrangeChildren'.
+		 */
+		enum class BON_DLLEXPORT UIArrangeMode
+		{
+			// Stack children vertically, one below the other.
+			Stack = 0,
+
+			// Stack children horizontally, one after the other.
+			HorizontalStack = 1,
+
+			// Place children in a grid with fixed columns count, every row height is its tallest child.
+			Grid = 2,
+
+			// Place children in lines and wrap when line is full. Free space in every line is divided between children with 'FlexGrow'.
+			Flex = 3,
+		};
+
 		/**
 		 * UI Size unit types.
 		 */
@@ -194,6 +212,12 @@ namespace bon
 				Right = (int)rect.Width;
 				Bottom = (int)rect.Height;
 			}
+
+			/**
+			 * Implement equality operators.
+			 */
+			bool operator==(const UISides& other) const { return Left == other.Left && Right == other.Right && Top == other.Top && Bottom == other.Bottom; }
+			bool operator!=(const UISides& other) const { return !(*this == other); }
 		};
 
 		/**
@@ -233,6 +257,12 @@ namespace bon
 			{
 			}
 
+			/**
+			 * Implement equality operators.
+			 */
+			bool operator==(const UISize& other) const { return Width == other.Width && Height == other.Height && WidthType == other.WidthType && HeightType == other.HeightType; }
+			bool operator!=(const UISize& other) const { return !(*this == other); }
+
 			/**
 			 * Load from strings.
 			 * Every string value should be number + unit, where unit can be p for pixels or % for percent of parent. 
@@ -120,6 +120,11 @@ namespace bon
 			// is the dropdown currently opened / visible
 			bool _isOpened = false;
 
+			/**
+			 * Dropdown overrides DoInputUpdates() to close list and skip hidden parts.
+			 */
+			virtual bool HasCustomInputRouting() const override { return true; }
+
 			/**
 			 * Implement just the updating of this element
 			 *
@@ -14,7 +14,9 @@
 #include "../../Framework/Color.h"
 #include "../../Assets/Types/Config.h"
 #include "../../Assets/Defs.h"
+#include "../UIStyle.h"
 #include <list>
+#include <vector>
 
 
 #pragma warning ( push )
@@ -24,14 +26,21 @@ namespace bon
 {
 	namespace ui
 	{
+		class UIInputRouter;
+		class UIArena;
+		class UI;
+
 		/**
 		 * Base UI element class.
 		 */
 		class BON_DLLEXPORT _UIElement
 		{
+			friend class UIInputRouter;
+			friend class UI;
+
 		private:
-			// stylesheet folder, if loaded from stylesheet file
-			std::string _stylesheetFolder;
+			// compiled style, if loaded from stylesheet file
+			UIStyle _style;
 
 			// element offset from its anchor position.
 			framework::PointI _offset;
@@ -51,11 +60,31 @@ namespace bon
 			// do we need to recalculate dest rect?
 			bool _isDestDirty = true;
 
-			// every time we recalculate dest rect this increases by 1.
-			unsigned long _destCalcId = 0;
+			// does this element or any of its children need a layout pass?
+			bool _isLayoutDirty = true;
+
+			// do we need to re-arrange children (columns and auto arrange)?
+			bool _isArrangeDirty = true;
+
+			// extra width given to this element by parent flex arrangement
+			int _arrangedExtraWidth = 0;
+
+			// padding children were last laid out with
+			UISides _layoutPadding;
 
-			// last known parent dest id. if changes, we need to update ourselves as well
-			unsigned long _parentLastDestCalcId = (unsigned long)-1; 
+			// layout related public fields, as they were in last layout pass (used to detect changes)
+			struct LayoutProperties
+			{
+				framework::PointF Origin;
+				UISides Marging;
+				float FlexGrow = 0.0f;
+				bool ExemptFromAutoArrange = false;
+				bool AutoArrangeChildren = false;
+				UIArrangeMode ArrangeMode = UIArrangeMode::Stack;
+				int ArrangeColumns = 0;
+				bool ClipChildren = false;
+			};
+			LayoutProperties _layoutProperties;
 
 			// start dragging offset, if element is being dragged
 			framework::PointI _startDragOffsetInElement;
@@ -63,8 +92,15 @@ namespace bon
 			// if true, will ignore parent padding
 			bool _ignoreParentPadding = false;
 
-			// child elements.
-			std::list<UIElement> _children;
+			// child elements (owning pointers)
+			std::vector<UIElement> _children;
+
+			// same child elements as raw pointers, in the same order.
+			// used to traverse the tree, so draw, update, layout and input passes only walk a plain array of pointers
+			std::vector<_UIElement*> _childNodes;
+
+			// arena this element was allocated from, used to allocate its children (null if not allocated from arena)
+			std::shared_ptr<UIArena> _arena;
 
 			// store column data
 			struct ColumnData
@@ -75,6 +111,28 @@ namespace bon
 
 			// columns under this element
 			std::list<ColumnData> _columns;
+
+			// cached texture of this element and its children, when 'CacheAsTexture' is set
+			assets::ImageAsset _cacheTexture;
+
+			// region the cached texture covers, in screen coordinates
+			framework::RectangleI _cacheRect;
+
+			// do we need to render cached texture again?
+			bool _isCacheDirty = true;
+
+			// are we currently rendering into the cached texture?
+			bool _isRenderingCache = false;
+
+			// last known visibility and layer, to notify layout and cache when they change
+			bool _lastVisible = true;
+			bool _lastDrawAsTopLayer = false;
+
+			// incremented every time a layout pass runs on this element as root
+			unsigned int _layoutVersion = 0;
+
+			// routes input and draws top layer when this element is used as root
+			std::shared_ptr<UIInputRouter> _inputRouter;
 		
 		protected:
 
@@ -100,7 +158,7 @@ namespace bon
 			/**
 			 * Get all children's list.
 			 */
-			inline const std::list<UIElement>& GetChildren() { return _children; }
+			inline const std::vector<UIElement>& GetChildren() { return _children; }
 
 			/**
 			 * Get element type.
@@ -113,10 +171,27 @@ namespace bon
 			virtual void _Init() {}
 
 			/**
-			 * If true, will automatically arrange children every frame based on their actual dest rect.
+			 * If true, will automatically arrange children based on their actual dest rect, using 'ArrangeMode'.
+			 * Children are only re-arranged when they change.
 			 */
 			bool AutoArrangeChildren = false;
 
+			/**
+			 * How to arrange children when 'AutoArrangeChildren' is true.
+			 */
+			UIArrangeMode ArrangeMode = UIArrangeMode::Stack;
+
+			/**
+			 * Columns count when arranging children in grid mode.
+			 */
+			int ArrangeColumns = 2;
+
+			/**
+			 * When parent arranges children in flex mode, how much of the free space in line this element takes, relative to other elements in line.
+			 * 0 will keep element width.
+			 */
+			float FlexGrow = 0.0f;
+
 			/**
 			 * If parent `AutoArrangeChildren` is true but this flag is also true, will skip this element when auto arranging.
 			 */
@@ -191,6 +266,27 @@ namespace bon
 			 */
 			void* UserData = nullptr;
 
+			/**
+			 * If true, will render this element and its children once into a texture, and draw them as a single image until something in them changes.
+			 * Use this for static UI parts that are made of many elements, like HUD panels.
+			 * Changes in layout, text, visibility and state invalidate the cache automatically. If you change other properties directly (colors, images..) call InvalidateCache().
+			 * Note: top layer elements are not cached, and children should use alpha blending to look the same when cached.
+			 */
+			bool CacheAsTexture = false;
+
+			/**
+			 * Mark cached texture of this element and its parents as outdated, so they will be rendered again.
+			 */
+			void InvalidateCache();
+
+			/**
+			 * If true, children will only be drawn inside this element's region.
+			 * Children that are entirely outside this element's region are culled - they are not drawn, updated or receive input.
+			 * Use this for containers with scrolled or overflowing content, like lists and windows.
+			 * Note: top layer children are culled when outside the region, but are not clipped when drawn.
+			 */
+			bool ClipChildren = false;
+
 			/**
 			 * Can the user drag this element around?
 			 */
@@ -239,6 +335,7 @@ namespace bon
 			 *				*		- origin = Element origin (x,y).
 			 *				*		- anchor = Element anchor - its position relative to parent bounding box (x,y).
 			 *				*		- ignore_padding = If true, will ignore parent's padding (true / false).
+			 *				*		- flex_grow = How much of the free space to take when parent arranges children in flex mode.
 			 *				*
 			 *				*	[behavior]
 			 *				*		- interactive = Is this element interactive? (true / false).
@@ -247,10 +344,19 @@ namespace bon
 			 *				*		- draggable = If true, users can drag this element (true / false). 
 			 *				*		- limit_drag_to_parent = If true, will limit dragging to parent's region (true / false). 
 			 *				*		- auto_arrange_children = If true, will auto-arrange children based on actual dest rects (true / false). 
+			 *				*		- arrange_mode = How to auto-arrange children (stack / horizontal_stack / grid / flex). 
+			 *				*		- arrange_columns = Columns count when arranging children in grid mode. 
 			 *				*		- exempt_auto_arrange = If true, will ignore parent's auto arrange (true / false). 
+			 *				*		- cache_as_texture = If true, will render element and children to a texture and redraw it until they change (true / false). 
+			 *				* Stylesheets are compiled once and shared, see UI().GetStyle().
 			 */
 			virtual void LoadStyleFrom(const assets::ConfigAsset& config);
 
+			/**
+			 * Get compiled style this element was loaded from, or null if wasn't loaded from a stylesheet.
+			 */
+			inline const UIStyle& GetStyle() const { return _style; }
+
 			/**
 			 * If true, this element will remain "stuck" in active state, as if user is constantly pressing it.
 			 */
@@ -282,9 +388,20 @@ namespace bon
 			bool DrawAsTopLayer = false;
 
 			/**
-			 * Mark dest rect as dirty.
+			 * Mark dest rect as dirty, so it will be recalculated in next layout pass (along with its children and parent arrangement).
+			 */
+			void MarkAsDirty();
+
+			/**
+			 * Get if this element or any of its children need a layout pass.
 			 */
-			inline void MarkAsDirty() { _isDestDirty = true; }
+			inline bool IsLayoutDirty() const { return _isLayoutDirty; }
+
+			/**
+			 * Run layout pass: recalculate dest rects and arrange children, but only for elements that changed since last pass.
+			 * Called automatically by Update().
+			 */
+			void UpdateLayout();
 
 			/**
 			 * Set element offset from its anchor position.
@@ -300,7 +417,7 @@ namespace bon
 			 * Set element anchor.
 			 * Anchor position the element relative to its parent bounding box.
 			 */
-			inline void SetAnchor(const framework::PointF& anchor) { _anchor = anchor; MarkAsDirty(); }
+			inline void SetAnchor(const framework::PointF& anchor) { if (_anchor != anchor) { _anchor = anchor; MarkAsDirty(); } }
 
 			/**
 			 * Get element anchor.
@@ -311,17 +428,17 @@ namespace bon
 			/**
 			 * Set element size.
 			 */
-			inline void SetSize(const UISize& size) { _size = size; MarkAsDirty(); }
+			inline void SetSize(const UISize& size) { if (_size != size) { _size = size; MarkAsDirty(); } }
 
 			/**
 			 * Set element width to be 100% of its parent.
 			 */
-			inline void SetWidthToMax() { _size.Width = 100; _size.WidthType = UISizeType::PercentOfParent; MarkAsDirty(); }
+			inline void SetWidthToMax() { SetSize(UISize(100, UISizeType::PercentOfParent, _size.Height, _size.HeightType)); }
 
 			/**
 			 * Set element height to be 100% of its parent.
 			 */
-			inline void SetHeightToMax() { _size.Height = 100; _size.HeightType = UISizeType::PercentOfParent; MarkAsDirty(); }
+			inline void SetHeightToMax() { SetSize(UISize(_size.Width, _size.WidthType, 100, UISizeType::PercentOfParent)); }
 
 			/**
 			 * Set element size as pixels.
@@ -341,7 +458,7 @@ namespace bon
 			/**
 			 * Set internal padding.
 			 */
-			inline void SetPadding(UISides padding) { _padding = padding; MarkAsDirty(); }
+			inline void SetPadding(UISides padding) { if (_padding != padding) { _padding = padding; MarkAsDirty(); } }
 
 			/**
 			 * Get internal padding.
@@ -414,7 +531,7 @@ namespace bon
 
 			/**
 			 * Get the last dest rect we calculated.
-			 * Note: may be outdated if actions were done without calling CalcDestRect() or Update().
+			 * Note: may be outdated if actions were done without calling UpdateLayout() or Update().
 			 * Sometimes you need to Update() parent too.
 			 */
 			inline framework::RectangleI GetCalculatedDestRect() const { return _destRect.CloneWithOffset(_ExtraPixelsOffset); }
@@ -467,6 +584,18 @@ namespace bon
 			 */
 			void CalcDestRect();
 
+			/**
+			 * Called during layout pass, after dest rect was recalculated.
+			 * Override to update cached layout data, like measuring text.
+			 */
+			virtual void CalcLayoutSelf() {}
+
+			/**
+			 * Return true if this element overrides DoInputUpdates() to route input to its children.
+			 * Such elements are always updated with their entire subtree, instead of using the UI input router spatial index.
+			 */
+			virtual bool HasCustomInputRouting() const { return false; }
+
 			/**
 			 * Calculate and return coords based on parent, return absolute value in pixels.
 			 */
@@ -497,6 +626,57 @@ namespace bon
 			 * Update columns under this element.
 			 */
 			void UpdateColumns();
+
+		private:
+
+			/**
+			 * Mark that this element and its parents need a layout pass.
+			 */
+			void MarkLayoutDirty();
+
+			/**
+			 * Mark element dirty without notifying parent, used when parent itself changes element during layout.
+			 */
+			inline void MarkDirtyByParent() { _isDestDirty = _isLayoutDirty = true; }
+
+			/**
+			 * Check if layout related public fields changed since last layout pass, and if so mark as dirty.
+			 */
+			void CheckLayoutProperties();
+
+			/**
+			 * Arrange children based on 'ArrangeMode'.
+			 */
+			void ArrangeChildren();
+
+			/**
+			 * Draw from cached texture, rendering it first if needed.
+			 */
+			void DrawCached();
+
+			/**
+			 * Add region this element and its visible children cover to bounds (left, top, right, bottom).
+			 */
+			void CalcCachedRegion(int& left, int& top, int& right, int& bottom) const;
+
+			/**
+			 * Get if a child is culled because it's entirely outside this element's clipping region.
+			 */
+			bool IsChildCulled(const _UIElement* child) const;
+
+			/**
+			 * Get the intersection of a rectangle with a clipping rectangle (width or height will be 0 if they don't overlap).
+			 */
+			static framework::RectangleI IntersectRects(const framework::RectangleI& rect, const framework::RectangleI& clip);
+
+			/**
+			 * Set position from parent auto arrange.
+			 * 
+			 * \param x Offset X to set, or nullptr to keep X.
+			 * \param y Offset Y to set, or nullptr to keep Y.
+			 * \param extraWidth Extra width from flex arrangement.
+			 */
+			void SetArrangedPosition(const int* x, const int* y, int extraWidth);
 		};
 	}
 }
@@ -11,7 +11,8 @@
 #include "UIImage.h"
 #include "UIVerticalScrollbar.h"
 #include "../../Assets/Types/Config.h"
-#include <list>
+#include <vector>
+#include <string>
 
 namespace bon
 {
@@ -23,21 +24,26 @@ namespace bon
 
 		/**
 		 * A UI list with background window and text items.
+		 * The list is virtualized: items are stored as strings, and only a small pool of row elements is created, to show the visible items.
+		 * When scrolling, rows are rebound to the items they now show.
 		 */
 		class BON_DLLEXPORT _UIList : public _UIElement
 		{
 		protected:
 
-			// the struct that holds a single item in list.
-			struct ListItem
+			// a row element in list, that shows the item at its bound index.
+			struct ListRow
 			{
-				int Index = 0;
+				int Index = -1;
 				UIText Text = nullptr;
 				UIImage Background = nullptr;
 			};
 
 			// items in list
-			std::list<ListItem> _items;
+			std::vector<std::string> _items;
+
+			// rows pool, to show visible items
+			std::vector<ListRow> _rows;
 
 			// list scrollbar
 			UIVerticalScrollbar _scrollbar;
@@ -48,7 +54,7 @@ namespace bon
 			// stylesheet for items background
 			assets::ConfigAsset _itemsBackgroundSheet;
 
-			// mark that list is dirty and we need to rearrange items in it
+			// mark that list is dirty and we need to rearrange rows in it
 			bool _listDirty = true;
 
 			// height, in pixels, of a single line in list.
@@ -100,7 +106,20 @@ namespace bon
 			/**
 			 * Get list items list.
 			 */
-			std::vector<std::string> Items() const;
+			inline const std::vector<std::string>& Items() const { return _items; }
+
+			/**
+			 * Get items count.
+			 */
+			inline int ItemsCount() const { return (int)_items.size(); }
+
+			/**
+			 * Get item by index.
+			 * 
+			 * \param index Item index.
+			 * \return Item text, or nullptr if index is out of range.
+			 */
+			inline const char* GetItem(int index) const { return (index >= 0 && index < (int)_items.size()) ? _items[index].c_str() : nullptr; }
 
 			/**
 			 * Set if to draw as top layer this element and all its children, recursively.
@@ -140,6 +159,38 @@ namespace bon
 			 * \param item Item text to add.
 			 */
 			void AddItem(const char* item);
+
+			/**
+			 * Add items to list.
+			 *
+			 * \param items Items texts to add.
+			 * \param count How many items to add.
+			 */
+			inline void AddItems(const char** items, int count) { InsertItems((int)_items.size(), items, count); }
+
+			/**
+			 * Add items to list.
+			 *
+			 * \param items Items texts to add.
+			 */
+			void AddItems(const std::vector<std::string>& items);
+
+			/**
+			 * Insert item to list.
+			 *
+			 * \param index Index to insert item at (0 to items count).
+			 * \param item Item text to insert.
+			 */
+			inline void InsertItem(int index, const char* item) { InsertItems(index, &item, 1); }
+
+			/**
+			 * Insert items to list.
+			 *
+			 * \param index Index to insert items at (0 to items count).
+			 * \param items Items texts to insert.
+			 * \param count How many items to insert.
+			 */
+			void InsertItems(int index, const char** items, int count);
 			
 			/**
 			 * Remove item from list.
@@ -156,6 +207,14 @@ namespace bon
 			 */
 			void RemoveItem(int index);
 
+			/**
+			 * Remove a range of items from list.
+			 *
+			 * \param index First item index to remove.
+			 * \param count How many items to remove.
+			 */
+			void RemoveItems(int index, int count);
+
 			/**
 			 * Clear list.
 			 */
@@ -209,7 +268,7 @@ namespace bon
 		protected:
 
 			/**
-			 * Update list items.
+			 * Update rows position and size.
 			 */
 			void RebuildListItems();
 			
@@ -217,6 +276,21 @@ namespace bon
 			 * Update scrollbar min, max and offset.
 			 */
 			void UpdateScrollbarMinMax();
+
+			/**
+			 * Bind rows to the visible items, creating rows if needed.
+			 */
+			void BindRows();
+
+			/**
+			 * Remove all rows, so they will be created again with current style.
+			 */
+			void ClearRows();
+
+			/**
+			 * Update selection after removing a range of items.
+			 */
+			void OnItemsRemoved(int index, int count);
 		};
 	}
 }
\ No newline at end of file
@@ -79,6 +79,20 @@ namespace bon
 			 */
 			virtual void DoInputUpdatesSelf(const framework::PointI& mousePosition, UIUpdateInputState& updateState) override;
 
+			/**
+			 * Implement just the updating of this element
+			 *
+			 * \param deltaTime Update frame delta time.
+			 */
+			virtual void UpdateSelf(double deltaTime) override;
+
+		private:
+
+			/**
+			 * Update handle position and active part overlay based on current value.
+			 */
+			void UpdateHandle();
+
 		};
 	}
 }
\ No newline at end of file
@@ -34,6 +34,16 @@ namespace bon
 			// actual calculated bounding box of the ui text.
 			framework::RectangleI _actualDestRect;
 
+			// do we need to measure text again?
+			bool _textDirty = true;
+
+			// properties text was last measured with
+			const void* _measuredFont = nullptr;
+			int _measuredFontSize = 0;
+			bool _measuredWordWrap = true;
+			UITextAlignment _measuredAlignment = UITextAlignment::Left;
+			framework::RectangleI _measuredDestRect;
+
 		public:
 
 			/**
@@ -109,6 +119,7 @@ namespace bon
 
 			/**
 			 * Get the actual destination rect as calculated by the Update() method.
+			 * Text is only measured again when text, font or size changes.
 			 * This would usually be the same as GetCalculatedDestRect(), but might be different for some UI elements.
 			 */
 			virtual framework::RectangleI GetActualDestRect() const override { return _actualDestRect.CloneWithOffset(_ExtraPixelsOffset); }
@@ -168,6 +179,11 @@ namespace bon
 			 * Implement just the drawing of this element
 			 */
 			virtual void DrawSelf() override;
+
+			/**
+			 * Measure text during layout pass.
+			 */
+			virtual void CalcLayoutSelf() override;
 		};
 	}
 }
\ No newline at end of file
@@ -28,6 +28,8 @@
 #include "Elements/UITextInput.h"
 #include "Elements/UIRectangle.h"
 #include "Elements/UIVerticalScrollbar.h"
+#include "UIStyle.h"
+#include <vector>
 
 namespace bon
 {
@@ -217,6 +219,40 @@ namespace bon
 			 */
 			virtual UIRectangle CreateRectangle(const char* stylesheet = nullptr, UIElement parent = nullptr) = 0;
 
+			/**
+			 * Create many elements of the same type and stylesheet.
+			 * Faster than creating them one by one, since stylesheet is loaded and compiled only once.
+			 *
+			 * \param type Type of elements to create.
+			 * \param stylesheet Optional stylesheet path to load.
+			 * \param parent Optional parent to set.
+			 * \param count How many elements to create.
+			 * \return Newly created elements.
+			 */
+			virtual std::vector<UIElement> CreateElements(UIElementType type, const char* stylesheet, UIElement parent, int count) = 0;
+
+			/**
+			 * Get compiled style of a stylesheet, compiling it if needed.
+			 * Compiled styles are cached and shared between all elements that use the same stylesheet, as long as something holds them.
+			 *
+			 * \param stylesheet Stylesheet to get compiled style for.
+			 * \return Compiled style.
+			 */
+			virtual UIStyle GetStyle(const assets::ConfigAsset& stylesheet) = 0;
+
+			/**
+			 * Load a stylesheet and get its compiled style.
+			 *
+			 * \param stylesheetPath Stylesheet path to load.
+			 * \return Compiled style.
+			 */
+			virtual UIStyle LoadStyle(const char* stylesheetPath) = 0;
+
+			/**
+			 * Clear compiled styles cache.
+			 * Call this if you change stylesheets values at runtime, so new elements will compile them again.
+			 */
+			virtual void ClearStylesCache() = 0;
 
 			/**
 			 * Override cursor position with a given point.
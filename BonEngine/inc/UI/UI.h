@@ -8,6 +8,9 @@
 #pragma once
 #include "../dllimport.h"
 #include "IUI.h"
+#include "UIInputRouter.h"
+#include "UIArena.h"
+#include <unordered_map>
 
 
 namespace bon
@@ -23,6 +26,25 @@ namespace bon
 			// cursor sprite to draw
 			UIImage _cursor;
 
+			// cached compiled style, and the stylesheet it was compiled from
+			struct CachedStyle
+			{
+				std::weak_ptr<assets::_Config> Stylesheet;
+				std::weak_ptr<const _UIStyle> Style;
+			};
+
+			// compiled styles, by stylesheet.
+			// cache holds weak pointers, so styles (and the stylesheets, images and fonts they use) are freed when no element uses them anymore
+			std::unordered_map<const assets::_Config*, CachedStyle> _styles;
+
+			// arena for elements created without parent
+			std::shared_ptr<UIArena> _arena;
+
+			/**
+			 * Get input router of a root element, creating it if needed.
+			 */
+			UIInputRouter& GetInputRouter(const UIElement& root);
+
 		public:
 
 			/**
@@ -198,6 +220,41 @@ namespace bon
 			 */
 			virtual UIRectangle CreateRectangle(const char* stylesheet = nullptr, UIElement parent = nullptr) override;
 
+			/**
+			 * Create many elements of the same type and stylesheet.
+			 * Faster than creating them one by one, since stylesheet is loaded and compiled only once.
+			 *
+			 * \param type Type of elements to create.
+			 * \param stylesheet Optional stylesheet path to load.
+			 * \param parent Optional parent to set.
+			 * \param count How many elements to create.
+			 * \return Newly created elements.
+			 */
+			virtual std::vector<UIElement> CreateElements(UIElementType type, const char* stylesheet, UIElement parent, int count) override;
+
+			/**
+			 * Get compiled style of a stylesheet, compiling it if needed.
+			 * Compiled styles are cached and shared between all elements that use the same stylesheet, as long as something holds them.
+			 *
+			 * \param stylesheet Stylesheet to get compiled style for.
+			 * \return Compiled style.
+			 */
+			virtual UIStyle GetStyle(const assets::ConfigAsset& stylesheet) override;
+
+			/**
+			 * Load a stylesheet and get its compiled style.
+			 *
+			 * \param stylesheetPath Stylesheet path to load.
+			 * \return Compiled style.
+			 */
+			virtual UIStyle LoadStyle(const char* stylesheetPath) override;
+
+			/**
+			 * Clear compiled styles cache.
+			 * Call this if you change stylesheets values at runtime, so new elements will compile them again.
+			 */
+			virtual void ClearStylesCache() override;
+
 			/**
 			 * Override cursor position with a given point.
 			 * 
@@ -210,8 +267,37 @@ namespace bon
 			 */
 			virtual PointI _GetRelativeCursorPos() const override;
 
+		protected:
+
+			/**
+			 * Free compiled styles and shared arena.
+			 */
+			virtual void _Dispose() override;
+
 		private:
 
+			/**
+			 * Create a new element by type, without initializing it.
+			 */
+			UIElement CreateByType(UIElementType type, const UIElement& parent);
+
+			/**
+			 * Get arena to allocate new elements from, based on their parent (null if arenas are disabled).
+			 */
+			std::shared_ptr<UIArena> GetArena(const UIElement& parent);
+
+			/**
+			 * Allocate a new element from parent arena (or from heap, if arenas are disabled).
+			 */
+			template <typename T>
+			std::shared_ptr<T> NewElement(const UIElement& parent) { return NewElementInArena<T>(GetArena(parent)); }
+
+			/**
+			 * Allocate a new element from arena (or from heap, if arena is null).
+			 */
+			template <typename T>
+			std::shared_ptr<T> NewElementInArena(const std::shared_ptr<UIArena>& arena);
+
 			/**
 			 * Init a newly created UI element.
 			 */
@@ -0,0 +1,141 @@
+/*****************************************************************//**
+ * \file   UIArena.h
+ * \brief  Memory arena to allocate UI elements trees from.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace bon
+{
+	namespace ui
+	{
+		/**
+		 * Memory arena for UI elements.
+		 * Allocates blocks from big chunks, and keeps freed blocks in free lists by size, so creating and destroying many elements
+		 * doesn't go through the heap, and elements of the same tree are stored close to each other.
+		 * Chunks are freed when the arena is destroyed, which happens after all elements allocated from it are destroyed.
+		 * Not thread safe: elements should be created and destroyed on the main thread.
+		 */
+		class UIArena
+		{
+		public:
+
+			/**
+			 * Size of memory chunks to allocate blocks from.
+			 */
+			static const size_t ChunkSize = 64 * 1024;
+
+			/**
+			 * Blocks alignment (and size granularity).
+			 */
+			static const size_t Alignment = 16;
+
+			/**
+			 * Max block size to allocate from chunks. Bigger blocks are allocated from heap.
+			 */
+			static const size_t MaxBlockSize = 4096;
+
+		private:
+
+			// free blocks by size class (size / Alignment - 1)
+			void* _freeLists[MaxBlockSize / Alignment] = {};
+
+			// allocated chunks
+			std::vector<char*> _chunks;
+
+			// position and bytes left in current chunk
+			char* _current = nullptr;
+			size_t _currentLeft = 0;
+
+			// how many blocks are currently in use
+			size_t _liveBlocks = 0;
+
+		public:
+
+			/**
+			 * Free all chunks.
+			 */
+			~UIArena();
+
+			/**
+			 * Allocate a block.
+			 *
+			 * \param bytes Block size.
+			 * \return Block pointer, aligned to 'Alignment'.
+			 */
+			void* Allocate(size_t bytes);
+
+			/**
+			 * Free a block allocated with Allocate().
+			 *
+			 * \param ptr Block to free.
+			 * \param bytes Block size, as given to Allocate().
+			 */
+			void Free(void* ptr, size_t bytes);
+
+			/**
+			 * Get how many blocks are currently in use.
+			 */
+			inline size_t LiveBlocks() const { return _liveBlocks; }
+
+			/**
+			 * Get how many chunks arena allocated.
+			 */
+			inline size_t ChunksCount() const { return _chunks.size(); }
+		};
+
+		/**
+		 * Standard allocator that allocates from a UI arena.
+		 * Used with std::allocate_shared(), so elements and their shared pointer control blocks are stored in the arena,
+		 * and the arena is kept alive as long as any of its elements exist.
+		 */
+		template <typename T>
+		class UIArenaAllocator
+		{
+		public:
+			typedef T value_type;
+
+			// arena to allocate from
+			std::shared_ptr<UIArena> Arena;
+
+			/**
+			 * Create allocator for arena.
+			 */
+			UIArenaAllocator(const std::shared_ptr<UIArena>& arena) : Arena(arena) {}
+
+			/**
+			 * Create allocator from allocator of a different type.
+			 */
+			template <typename U>
+			UIArenaAllocator(const UIArenaAllocator<U>& other) : Arena(other.Arena) {}
+
+			/**
+			 * Allocate objects.
+			 */
+			T* allocate(size_t n)
+			{
+				static_assert(alignof(T) <= UIArena::Alignment, "Type alignment is too big for UI arena!");
+				return (T*)Arena->Allocate(n * sizeof(T));
+			}
+
+			/**
+			 * Free objects.
+			 */
+			void deallocate(T* ptr, size_t n)
+			{
+				Arena->Free(ptr, n * sizeof(T));
+			}
+
+			template <typename U>
+			bool operator==(const UIArenaAllocator<U>& other) const { return Arena == other.Arena; }
+
+			template <typename U>
+			bool operator!=(const UIArenaAllocator<U>& other) const { return Arena != other.Arena; }
+		};
+	}
+}
@@ -0,0 +1,143 @@
+/*****************************************************************//**
+ * \file   UIInputRouter.h
+ * \brief  Route pointer input to UI elements using a spatial index, and keep top layer draw list.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "Elements/Defs.h"
+#include "../Framework/Point.h"
+#include "../Framework/Rectangle.h"
+#include <vector>
+#include <cstdint>
+
+namespace bon
+{
+	namespace ui
+	{
+		/**
+		 * Index a UI tree by elements regions, so pointer input only reaches elements under the cursor.
+		 * Built from a root element and rebuilt whenever the tree layout changes. Also keeps the list of top layer elements to draw,
+		 * so drawing top layer doesn't need to traverse the whole tree again.
+		 * Elements are processed in the same order and with the same rules as _UIElement::DoInputUpdates().
+		 */
+		class UIInputRouter
+		{
+		public:
+
+			/**
+			 * Default spatial index cell size, in pixels.
+			 */
+			static const int CellSize = 64;
+
+			/**
+			 * Max cells in spatial index. If tree region is bigger, cells size will grow.
+			 */
+			static const int MaxCells = 4096;
+
+		private:
+
+			// an element in index
+			struct Entry
+			{
+				// element to update
+				_UIElement* Element;
+
+				// region element may respond to input in
+				framework::RectangleI Rect;
+
+				// should we call element DoInputUpdates() with its subtree, instead of just updating self?
+				bool Subtree;
+
+				// layer to update subtree in
+				bool TopLayer;
+			};
+
+			// all entries, in input priority order (top layer first)
+			std::vector<Entry> _entries;
+
+			// spatial index origin, size in cells, and cells size
+			framework::PointI _gridOrigin;
+			framework::PointI _gridSize;
+			int _cellSize = CellSize;
+
+			// entries in every cell: cell i entries are _cellEntries[_cellStart[i].._cellStart[i + 1]]
+			std::vector<uint32_t> _cellStart;
+			std::vector<uint32_t> _cellEntries;
+
+			// entries to update every frame, regardless of pointer position
+			std::vector<uint32_t> _alwaysUpdate;
+
+			// entries that were not idle after last update, and need an update to leave their state
+			std::vector<uint32_t> _active;
+
+			// entries to update this frame (reused to avoid allocations)
+			std::vector<uint32_t> _candidates;
+
+			// top layer elements that have no top layer parent, in drawing order
+			std::vector<_UIElement*> _topLayerRoots;
+
+			// root and layout version index was built for
+			const _UIElement* _root = nullptr;
+			unsigned int _layoutVersion = 0;
+
+		public:
+
+			/**
+			 * Get if index is up to date with given root element, and safe to use.
+			 */
+			bool IsValidFor(const _UIElement* root) const;
+
+			/**
+			 * Rebuild index from root element.
+			 */
+			void Rebuild(_UIElement* root);
+
+			/**
+			 * Do input updates of both top layer and regular elements, rebuilding index if needed.
+			 *
+			 * \param root Root element to update.
+			 * \param mousePosition Mouse position to test.
+			 * \param updateState Contains temporary state about UI input updates.
+			 */
+			void DoInputUpdates(_UIElement* root, const framework::PointI& mousePosition, UIUpdateInputState& updateState);
+
+			/**
+			 * Draw top layer elements.
+			 * If index is outdated, will draw the entire tree top layer instead.
+			 *
+			 * \param root Root element to draw.
+			 */
+			void DrawTopLayer(_UIElement* root);
+
+			/**
+			 * Get how many elements are indexed.
+			 */
+			inline size_t EntriesCount() const { return _entries.size(); }
+
+		private:
+
+			/**
+			 * Add element and its subtree entries, in the order _UIElement::DoInputUpdates() would update them.
+			 * Regular layer entries are clipped to 'clip', if not null.
+			 */
+			void AddEntries(_UIElement* element, std::vector<Entry>& topLayer, std::vector<Entry>& regular, const framework::RectangleI* clip);
+
+			/**
+			 * Add top layer elements that have no top layer parent, in drawing order.
+			 */
+			void AddTopLayerRoots(_UIElement* element);
+
+			/**
+			 * Build spatial index from entries.
+			 */
+			void BuildGrid();
+
+			/**
+			 * Copy element state to children with 'CopyParentState' mode, recursively.
+			 */
+			static void CopyStateToChildren(_UIElement* element);
+		};
+	}
+}
@@ -0,0 +1,154 @@
+/*****************************************************************//**
+ * \file   UIStyle.h
+ * \brief  A compiled UI stylesheet, parsed once and shared between elements.
+ *
+ * \author Ronen Ness
+ * \date   October 2026
+ *********************************************************************/
+#pragma once
+#include "../dllimport.h"
+#include "Elements/Defs.h"
+#include "../Assets/Defs.h"
+#include "../Framework/Point.h"
+#include "../Framework/Rectangle.h"
+#include "../Framework/Color.h"
+#include "../Gfx/Defs.h"
+#include <string>
+#include <memory>
+
+#pragma warning ( push )
+#pragma warning ( disable: 4251 ) // "..needs to have dll-interface to be used by clients..." it's ok in this case because its private.
+
+namespace bon
+{
+	namespace ui
+	{
+		/**
+		 * Compiled [style] and [behavior] sections, used by all elements.
+		 */
+		struct BON_DLLEXPORT UIElementStyle
+		{
+			framework::PointF Origin;
+			framework::PointF Anchor;
+			UISides Padding;
+			bool IgnoreParentPadding = false;
+			UISides Marging;
+			UISize Size;
+			float FlexGrow = 0.0f;
+			bool Interactive = true;
+			bool CaptureInput = true;
+			bool CopyParentState = false;
+			bool Draggable = false;
+			bool LimitDragToParentArea = true;
+			bool AutoArrangeChildren = false;
+			bool ExemptFromAutoArrange = false;
+			bool CacheAsTexture = false;
+			bool ClipChildren = false;
+			UIArrangeMode ArrangeMode = UIArrangeMode::Stack;
+			int ArrangeColumns = 2;
+		};
+
+		/**
+		 * Compiled [image] section, used by image elements.
+		 */
+		struct BON_DLLEXPORT UIImageStyle
+		{
+			// null if stylesheet doesn't set image
+			assets::ImageAsset Image;
+			UISides SlicedImageSides;
+			framework::Color Color;
+			framework::Color ColorHighlight;
+			framework::Color ColorPressed;
+			framework::RectangleI SourceRect;
+			framework::RectangleI SourceRectHighlight;
+			framework::RectangleI SourceRectPressed;
+			gfx::BlendModes BlendMode = gfx::BlendModes::AlphaBlend;
+			UIImageTypes ImageType = UIImageTypes::Stretch;
+			float TextureScale = 1.0f;
+		};
+
+		/**
+		 * Compiled [text] section, used by text elements.
+		 */
+		struct BON_DLLEXPORT UITextStyle
+		{
+			// null if stylesheet doesn't set font
+			assets::FontAsset Font;
+			int FontSize = 24;
+			UITextAlignment Alignment = UITextAlignment::Left;
+			framework::Color Color;
+			framework::Color ColorHighlight;
+			framework::Color ColorPressed;
+			framework::Color OutlineColor;
+			framework::Color OutlineColorHighlight;
+			framework::Color OutlineColorPressed;
+			int OutlineWidth = 1;
+			int OutlineWidthHighlight = 1;
+			int OutlineWidthPressed = 1;
+		};
+
+		/**
+		 * A compiled UI stylesheet.
+		 * Parses all the common sections once, so elements can apply them with plain copies instead of parsing ini values.
+		 * Compiled styles are immutable and shared between all elements that use the same stylesheet, get them with UI().GetStyle().
+		 * Element specific sections that are not compiled can still be read from Config().
+		 */
+		class BON_DLLEXPORT _UIStyle
+		{
+		private:
+			// source stylesheet
+			assets::ConfigAsset _config;
+
+			// folder stylesheet was loaded from
+			std::string _folder;
+
+		public:
+
+			/**
+			 * Compile style from stylesheet.
+			 *
+			 * \param config Stylesheet to compile.
+			 */
+			_UIStyle(const assets::ConfigAsset& config);
+
+			/**
+			 * Compiled [style] and [behavior] sections.
+			 */
+			UIElementStyle Element;
+
+			/**
+			 * Compiled [image] section.
+			 */
+			UIImageStyle Image;
+
+			/**
+			 * Compiled [text] section.
+			 */
+			UITextStyle Text;
+
+			/**
+			 * Get source stylesheet.
+			 */
+			inline const assets::ConfigAsset& Config() const { return _config; }
+
+			/**
+			 * Get the folder stylesheet was loaded from, used to resolve relative paths.
+			 */
+			inline const std::string& Folder() const { return _folder; }
+
+		private:
+
+			/**
+			 * Convert path to be relative to stylesheet folder.
+			 */
+			std::string ToRelativePath(const char* path) const;
+		};
+
+		/**
+		 * Compiled UI style pointer.
+		 */
+		typedef BON_DLLEXPORT std::shared_ptr<const _UIStyle> UIStyle;
+	}
+}
+
+#pragma warning (pop)
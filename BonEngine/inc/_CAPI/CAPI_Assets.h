@@ -16,228 +16,378 @@ extern "C" {
 	/**
 	* Check if an asset is valid.
 	*/
-	BON_DLLEXPORT bool BON_Asset_IsValid(bon::AssetPtr* asset);
+	BON_DLLEXPORT bool BON_Asset_IsValid(bon::AssetHandle asset);
 
 	/**
 	 * Get asset's path.
 	 */
-	BON_DLLEXPORT const char* BON_Asset_Path(bon::AssetPtr* asset);
+	BON_DLLEXPORT const char* BON_Asset_Path(bon::AssetHandle asset);
 
 	/**
 	 * Get image filtering mode.
 	 */
-	BON_DLLEXPORT BON_ImageFilterMode BON_Image_FilteringMode(bon::ImageAsset* image);
+	BON_DLLEXPORT BON_ImageFilterMode BON_Image_FilteringMode(bon::AssetHandle image);
 
 	/**
 	 * Get image width.
 	 */
-	BON_DLLEXPORT int BON_Image_Width(bon::ImageAsset* image);
+	BON_DLLEXPORT int BON_Image_Width(bon::AssetHandle image);
 
 	/**
 	 * Get image height.
 	 */
-	BON_DLLEXPORT int BON_Image_Height(bon::ImageAsset* image);
+	BON_DLLEXPORT int BON_Image_Height(bon::AssetHandle image);
 
 	/**
 	 * Get if image have alpha channels.
 	 */
-	BON_DLLEXPORT bool BON_Image_HaveAlphaChannel(bon::ImageAsset* image);
+	BON_DLLEXPORT bool BON_Image_HaveAlphaChannel(bon::AssetHandle image);
 
 	/**
 	 * Save image to file.
 	 */
-	BON_DLLEXPORT void BON_Image_SaveToFile(bon::ImageAsset* image, const char* filename);
+	BON_DLLEXPORT void BON_Image_SaveToFile(bon::AssetHandle image, const char* filename);
 	
 	/**
 	 * Prepare image for reading pixels from it.
 	 */
-	BON_DLLEXPORT void BON_Image_PrepareReadingBuffer(bon::ImageAsset* image, int x, int y, int w, int h);
+	BON_DLLEXPORT void BON_Image_PrepareReadingBuffer(bon::AssetHandle image, int x, int y, int w, int h);
 
 	/**
 	 * Free reading buffer after PrepareReadingBuffer() was called.
 	 * Happens automatically anyway when asset is destroyed.
 	 */
-	BON_DLLEXPORT void BON_Image_FreeReadingBuffer(bon::ImageAsset* image);
+	BON_DLLEXPORT void BON_Image_FreeReadingBuffer(bon::AssetHandle image);
 
 	/**
 	 * Get pixel from image. Must call PrepareReadingBuffer() before calling this.
 	 */
-	BON_DLLEXPORT void BON_Image_GetPixel(bon::ImageAsset* image, int x, int y, float* r, float* g, float* b, float* a);
+	BON_DLLEXPORT void BON_Image_GetPixel(bon::AssetHandle image, int x, int y, float* r, float* g, float* b, float* a);
 
 	/**
 	 * Clear image to transparent pixels.
 	 */
-	BON_DLLEXPORT void BON_Image_Clear(bon::ImageAsset* image);
+	BON_DLLEXPORT void BON_Image_Clear(bon::AssetHandle image);
 
 	/**
 	* Get string value from config.
 	*/
-	BON_DLLEXPORT const char* BON_Config_GetStr(bon::ConfigAsset* config, const char* section, const char* name, const char* defaultVal);
+	BON_DLLEXPORT const char* BON_Config_GetStr(bon::AssetHandle config, const char* section, const char* name, const char* defaultVal);
 
 	/**
 	* Get bool value from config.
 	*/
-	BON_DLLEXPORT bool BON_Config_GetBool(bon::ConfigAsset* config, const char* section, const char* name, bool defaultVal);
+	BON_DLLEXPORT bool BON_Config_GetBool(bon::AssetHandle config, const char* section, const char* name, bool defaultVal);
 
 	/**
 	* Get integer value from config.
 	*/
-	BON_DLLEXPORT long BON_Config_GetInt(bon::ConfigAsset* config, const char* section, const char* name, int defaultVal);
+	BON_DLLEXPORT long BON_Config_GetInt(bon::AssetHandle config, const char* section, const char* name, int defaultVal);
 
 	/**
 	* Get float value from config.
 	*/
-	BON_DLLEXPORT float BON_Config_GetFloat(bon::ConfigAsset* config, const char* section, const char* name, float defaultVal);
+	BON_DLLEXPORT float BON_Config_GetFloat(bon::AssetHandle config, const char* section, const char* name, float defaultVal);
 
 	/**
 	* Get PointF value from config.
 	*/
-	BON_DLLEXPORT void BON_Config_GetPointF(bon::ConfigAsset* config, const char* section, const char* name, float defaultValX, float defaultValY, float* outX, float* outY);
+	BON_DLLEXPORT void BON_Config_GetPointF(bon::AssetHandle config, const char* section, const char* name, float defaultValX, float defaultValY, float* outX, float* outY);
 	
 	/**
 	* Get RectangleF value from config.
 	*/
-	BON_DLLEXPORT void BON_Config_GetRectangleF(bon::ConfigAsset* config, const char* section, const char* name, float defaultValX, float defaultValY, float defaultValW, float defaultValH, float* outX, float* outY, float* outW, float* outH);
+	BON_DLLEXPORT void BON_Config_GetRectangleF(bon::AssetHandle config, const char* section, const char* name, float defaultValX, float defaultValY, float defaultValW, float defaultValH, float* outX, float* outY, float* outW, float* outH);
 	
 	/**
 	* Get Color value from config.
 	*/
-	BON_DLLEXPORT void BON_Config_GetColor(bon::ConfigAsset* config, const char* section, const char* name, float defaultR, float defaultG, float defaultB, float defaultA, float* outR, float* outG, float* outB, float* outA);
+	BON_DLLEXPORT void BON_Config_GetColor(bon::AssetHandle config, const char* section, const char* name, float defaultR, float defaultG, float defaultB, float defaultA, float* outR, float* outG, float* outB, float* outA);
 
 	/**
 	* Get option index from config.
 	*/
-	BON_DLLEXPORT int BON_Config_GetOption(bon::ConfigAsset* config, const char* section, const char* name, const char** options, int optionsCount, int defaultVal);
+	BON_DLLEXPORT int BON_Config_GetOption(bon::AssetHandle config, const char* section, const char* name, const char** options, int optionsCount, int defaultVal);
+
+	/**
+	* Get handle for config section and key, to read values without strings.
+	*/
+	BON_DLLEXPORT bon::ConfigKey BON_Config_GetKeyHandle(const char* section, const char* name);
+
+	/**
+	* Get string value from config by key handle.
+	*/
+	BON_DLLEXPORT const char* BON_Config_GetStrByKey(bon::AssetHandle config, bon::ConfigKey key, const char* defaultVal);
+
+	/**
+	* Get bool value from config by key handle.
+	*/
+	BON_DLLEXPORT bool BON_Config_GetBoolByKey(bon::AssetHandle config, bon::ConfigKey key, bool defaultVal);
+
+	/**
+	* Get integer value from config by key handle.
+	*/
+	BON_DLLEXPORT long BON_Config_GetIntByKey(bon::AssetHandle config, bon::ConfigKey key, int defaultVal);
+
+	/**
+	* Get float value from config by key handle.
+	*/
+	BON_DLLEXPORT float BON_Config_GetFloatByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultVal);
+
+	/**
+	* Get PointF value from config by key handle.
+	*/
+	BON_DLLEXPORT void BON_Config_GetPointFByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultValX, float defaultValY, float* outX, float* outY);
+
+	/**
+	* Get RectangleF value from config by key handle.
+	*/
+	BON_DLLEXPORT void BON_Config_GetRectangleFByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultValX, float defaultValY, float defaultValW, float defaultValH, float* outX, float* outY, float* outW, float* outH);
+
+	/**
+	* Get Color value from config by key handle.
+	*/
+	BON_DLLEXPORT void BON_Config_GetColorByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultR, float defaultG, float defaultB, float defaultA, float* outR, float* outG, float* outB, float* outA);
 
 	/**
 	* Get section name by index.
 	*/
-	BON_DLLEXPORT const char* BON_Config_Section(bon::ConfigAsset* config, int index);
+	BON_DLLEXPORT const char* BON_Config_Section(bon::AssetHandle config, int index);
 
 	/**
 	 * Get config sections count.
 	 */
-	BON_DLLEXPORT int BON_Config_SectionsCount(bon::ConfigAsset* config);
+	BON_DLLEXPORT int BON_Config_SectionsCount(bon::AssetHandle config);
 
 	/**
 	* Get a key name by index.
 	*/
-	BON_DLLEXPORT const char* BON_Config_Key(bon::ConfigAsset* config, const char* section, int index);
+	BON_DLLEXPORT const char* BON_Config_Key(bon::AssetHandle config, const char* section, int index);
 
 	/**
 	* Get config keys count.
 	*/
-	BON_DLLEXPORT int BON_Config_KeysCount(bon::ConfigAsset* config, const char* section);
+	BON_DLLEXPORT int BON_Config_KeysCount(bon::AssetHandle config, const char* section);
 
 	/**
 	* Set a value.
 	*/
-	BON_DLLEXPORT void BON_Config_SetValue(bon::ConfigAsset* config, const char* section, const char* key, const char* value);
+	BON_DLLEXPORT void BON_Config_SetValue(bon::AssetHandle config, const char* section, const char* key, const char* value);
 
 	/**
 	* Removes a key.
 	*/
-	BON_DLLEXPORT void BON_Config_RemoveKey(bon::ConfigAsset* config, const char* section, const char* key);
+	BON_DLLEXPORT void BON_Config_RemoveKey(bon::AssetHandle config, const char* section, const char* key);
 
 	/**
 	* Checks if a section exists.
 	*/
-	BON_DLLEXPORT bool BON_Config_SectionExists(bon::ConfigAsset* config, const char* section);
+	BON_DLLEXPORT bool BON_Config_SectionExists(bon::AssetHandle config, const char* section);
 
 	/**
 	* Checks if a key exists.
 	*/
-	BON_DLLEXPORT bool BON_Config_KeyExists(bon::ConfigAsset* config, const char* section, const char* key);
+	BON_DLLEXPORT bool BON_Config_KeyExists(bon::AssetHandle config, const char* section, const char* key);
 
 	/**
 	* Get music track length.
 	*/
-	BON_DLLEXPORT float BON_Music_Length(bon::MusicAsset* music);
+	BON_DLLEXPORT float BON_Music_Length(bon::AssetHandle music);
 
 	/**
 	* Get sound track length.
 	*/
-	BON_DLLEXPORT float BON_Sound_Length(bon::SoundAsset* sound);
+	BON_DLLEXPORT float BON_Sound_Length(bon::AssetHandle sound);
 
 	/**
 	 * Get if a sound is playing.
 	 */
-	BON_DLLEXPORT bool BON_Sound_IsPlaying(bon::SoundAsset* sound);
+	BON_DLLEXPORT bool BON_Sound_IsPlaying(bon::AssetHandle sound);
+
+	/**
+	 * Set the mix bus to play sound on.
+	 */
+	BON_DLLEXPORT void BON_Sound_SetBus(bon::AssetHandle sound, BON_SoundBus bus);
+
+	/**
+	 * Get the mix bus sound plays on.
+	 */
+	BON_DLLEXPORT BON_SoundBus BON_Sound_GetBus(bon::AssetHandle sound);
+
+	/**
+	 * Set sound priority.
+	 */
+	BON_DLLEXPORT void BON_Sound_SetPriority(bon::AssetHandle sound, int priority);
+
+	/**
+	 * Get sound priority.
+	 */
+	BON_DLLEXPORT int BON_Sound_GetPriority(bon::AssetHandle sound);
+
+	/**
+	 * Set how many instances of sound can play at the same time (0 = no limit).
+	 */
+	BON_DLLEXPORT void BON_Sound_SetMaxInstances(bon::AssetHandle sound, int maxInstances);
+
+	/**
+	 * Get how many instances of sound can play at the same time.
+	 */
+	BON_DLLEXPORT int BON_Sound_GetMaxInstances(bon::AssetHandle sound);
+
+	/**
+	 * Set sound voice stealing policy.
+	 */
+	BON_DLLEXPORT void BON_Sound_SetStealPolicy(bon::AssetHandle sound, BON_VoiceStealPolicy policy);
+
+	/**
+	 * Get sound voice stealing policy.
+	 */
+	BON_DLLEXPORT BON_VoiceStealPolicy BON_Sound_GetStealPolicy(bon::AssetHandle sound);
 
 	/**
 	 * Get font asset native size.
 	 */
-	BON_DLLEXPORT int BON_Font_Size(bon::FontAsset* font);
+	BON_DLLEXPORT int BON_Font_Size(bon::AssetHandle font);
 
 	/**
 	 * Get if effect is valid
 	 */
-	BON_DLLEXPORT bool BON_Effect_IsValid(bon::EffectAsset* effect);
+	BON_DLLEXPORT bool BON_Effect_IsValid(bon::AssetHandle effect);
 
 	/**
 	 * Return if this effect uses textures.
 	 */
-	BON_DLLEXPORT bool BON_Effect_UseTextures(bon::EffectAsset* effect);
+	BON_DLLEXPORT bool BON_Effect_UseTextures(bon::AssetHandle effect);
 
 	/**
 	 * Return if this effect uses vertex color.
 	 */
-	BON_DLLEXPORT bool BON_Effect_UseVertexColor(bon::EffectAsset* effect);
+	BON_DLLEXPORT bool BON_Effect_UseVertexColor(bon::AssetHandle effect);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformFloat(bon::EffectAsset* effect, const char* name, float val);
+	BON_DLLEXPORT void BON_Effect_SetUniformFloat(bon::AssetHandle effect, const char* name, float val);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformVector2(bon::EffectAsset* effect, const char* name, float x, float y);
+	BON_DLLEXPORT void BON_Effect_SetUniformVector2(bon::AssetHandle effect, const char* name, float x, float y);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformVector3(bon::EffectAsset* effect, const char* name, float x, float y, float z);
+	BON_DLLEXPORT void BON_Effect_SetUniformVector3(bon::AssetHandle effect, const char* name, float x, float y, float z);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformVector4(bon::EffectAsset* effect, const char* name, float x, float y, float z, float w);
+	BON_DLLEXPORT void BON_Effect_SetUniformVector4(bon::AssetHandle effect, const char* name, float x, float y, float z, float w);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformInt(bon::EffectAsset* effect, const char* name, int val);
+	BON_DLLEXPORT void BON_Effect_SetUniformInt(bon::AssetHandle effect, const char* name, int val);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformVector2i(bon::EffectAsset* effect, const char* name, int x, int y);
+	BON_DLLEXPORT void BON_Effect_SetUniformVector2i(bon::AssetHandle effect, const char* name, int x, int y);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformVector3i(bon::EffectAsset* effect, const char* name, int x, int y, int z);
+	BON_DLLEXPORT void BON_Effect_SetUniformVector3i(bon::AssetHandle effect, const char* name, int x, int y, int z);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformVector4i(bon::EffectAsset* effect, const char* name, int x, int y, int z, int w);
+	BON_DLLEXPORT void BON_Effect_SetUniformVector4i(bon::AssetHandle effect, const char* name, int x, int y, int z, int w);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformMatrix2(bon::EffectAsset* effect, const char* name, int count, bool transpose, const float* values);
+	BON_DLLEXPORT void BON_Effect_SetUniformMatrix2(bon::AssetHandle effect, const char* name, int count, bool transpose, const float* values);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformMatrix3(bon::EffectAsset* effect, const char* name, int count, bool transpose, const float* values);
+	BON_DLLEXPORT void BON_Effect_SetUniformMatrix3(bon::AssetHandle effect, const char* name, int count, bool transpose, const float* values);
 
 	/**
 	 * Set effect uniform.
 	 */
-	BON_DLLEXPORT void BON_Effect_SetUniformMatrix4(bon::EffectAsset* effect, const char* name, int count, bool transpose, const float* values);
+	BON_DLLEXPORT void BON_Effect_SetUniformMatrix4(bon::AssetHandle effect, const char* name, int count, bool transpose, const float* values);
+
+	/**
+	 * Get effect uniform handle, to set uniform values without name lookups.
+	 */
+	BON_DLLEXPORT int BON_Effect_GetUniformHandle(bon::AssetHandle effect, const char* name);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformFloatH(bon::AssetHandle effect, int uniform, float val);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformVector2H(bon::AssetHandle effect, int uniform, float x, float y);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformVector3H(bon::AssetHandle effect, int uniform, float x, float y, float z);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformVector4H(bon::AssetHandle effect, int uniform, float x, float y, float z, float w);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformIntH(bon::AssetHandle effect, int uniform, int val);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformVector2iH(bon::AssetHandle effect, int uniform, int x, int y);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformVector3iH(bon::AssetHandle effect, int uniform, int x, int y, int z);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformVector4iH(bon::AssetHandle effect, int uniform, int x, int y, int z, int w);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformMatrix2H(bon::AssetHandle effect, int uniform, int count, bool transpose, const float* values);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformMatrix3H(bon::AssetHandle effect, int uniform, int count, bool transpose, const float* values);
+
+	/**
+	 * Set effect uniform by handle.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformMatrix4H(bon::AssetHandle effect, int uniform, int count, bool transpose, const float* values);
+
+	/**
+	 * Get effect uniform block handle.
+	 */
+	BON_DLLEXPORT int BON_Effect_GetUniformBlockHandle(bon::AssetHandle effect, const char* name);
+
+	/**
+	 * Set effect uniform block data.
+	 */
+	BON_DLLEXPORT void BON_Effect_SetUniformBlockData(bon::AssetHandle effect, int block, const void* data, int size);
 
 #ifdef __cplusplus
 }
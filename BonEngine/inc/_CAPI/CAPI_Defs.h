@@ -97,10 +97,37 @@ extern "C" {
 		BON_Counters_DrawCalls = bon::DiagnosticsCounters::DrawCalls,
 		BON_Counters_PlaySoundCalls = bon::DiagnosticsCounters::PlaySoundCalls,
 		BON_Counters_LoadedAssets = bon::DiagnosticsCounters::LoadedAssets,
+		BON_Counters_CapturedFrames = bon::DiagnosticsCounters::CapturedFrames,
+		BON_Counters_DroppedCaptureFrames = bon::DiagnosticsCounters::DroppedCaptureFrames,
+		BON_Counters_ThrottledCaptureFrames = bon::DiagnosticsCounters::ThrottledCaptureFrames,
+		BON_Counters_RealVoices = bon::DiagnosticsCounters::RealVoices,
+		BON_Counters_VirtualVoices = bon::DiagnosticsCounters::VirtualVoices,
+		BON_Counters_StolenVoices = bon::DiagnosticsCounters::StolenVoices,
+		BON_Counters_AudioCallbacks = bon::DiagnosticsCounters::AudioCallbacks,
+		BON_Counters_AudioUnderruns = bon::DiagnosticsCounters::AudioUnderruns,
+		BON_Counters_AudioStreamUnderruns = bon::DiagnosticsCounters::AudioStreamUnderruns,
+		BON_Counters_AudioCallbackLoad = bon::DiagnosticsCounters::AudioCallbackLoad,
+		BON_Counters_AudioDspTime = bon::DiagnosticsCounters::AudioDspTime,
+		BON_Counters_CachedAssets = bon::DiagnosticsCounters::CachedAssets,
+		BON_Counters_CachedAssetsRamKB = bon::DiagnosticsCounters::CachedAssetsRamKB,
+		BON_Counters_CachedAssetsVramKB = bon::DiagnosticsCounters::CachedAssetsVramKB,
+		BON_Counters_EvictedAssets = bon::DiagnosticsCounters::EvictedAssets,
+		BON_Counters_ClippedUIElements = bon::DiagnosticsCounters::ClippedUIElements,
+		BON_Counters_CulledUIElements = bon::DiagnosticsCounters::CulledUIElements,
 		BON_Counters__BuiltInCounterCount = bon::DiagnosticsCounters::_BuiltInCounterCount,
 		BON_Counters__MaxCounters = bon::DiagnosticsCounters::_MaxCounters,
 	};
 
+	/**
+	 * CAPI export of diagnostic histograms.
+	 */
+	BON_DLLEXPORT enum BON_DiagnosticHistograms
+	{
+		BON_Histograms_AudioCallbackLoad = bon::DiagnosticsHistograms::AudioCallbackLoad,
+		BON_Histograms__BuiltInHistogramCount = bon::DiagnosticsHistograms::_BuiltInHistogramCount,
+		BON_Histograms__MaxHistograms = bon::DiagnosticsHistograms::_MaxHistograms,
+	};
+
 	/**
 	 * CAPI export of diagnostic counters.
 	 */
@@ -117,6 +144,7 @@ extern "C" {
 		BON_BlendModes_Lighten = bon::BlendModes::Lighten,
 		BON_BlendModes_Mod = bon::BlendModes::Mod,
 		BON_BlendModes_Subtract = bon::BlendModes::Subtract,
+		BON_BlendModes_Premultiplied = bon::BlendModes::Premultiplied,
 		BON_BlendModes__Count = bon::BlendModes::_Count,
 	};
 
@@ -156,6 +184,79 @@ extern "C" {
 		BON_AudioFormats_U8 = bon::AudioFormats::U8,
 	};
 
+	/**
+	 * CAPI export of resample quality.
+	 */
+	BON_DLLEXPORT enum BON_ResampleQuality
+	{
+		BON_ResampleQuality_Linear = bon::ResampleQuality::Linear,
+		BON_ResampleQuality_Cubic = bon::ResampleQuality::Cubic,
+		BON_ResampleQuality_Sinc = bon::ResampleQuality::Sinc,
+	};
+
+	/**
+	 * CAPI export of sound mix buses.
+	 */
+	BON_DLLEXPORT enum BON_SoundBus
+	{
+		BON_SoundBus_Sfx = bon::SoundBus::Sfx,
+		BON_SoundBus_Music = bon::SoundBus::Music,
+		BON_SoundBus_UI = bon::SoundBus::UI,
+		BON_SoundBus_Voice = bon::SoundBus::Voice,
+	};
+
+	/**
+	 * CAPI export of voice stealing policies.
+	 */
+	BON_DLLEXPORT enum BON_VoiceStealPolicy
+	{
+		BON_VoiceStealPolicy_Oldest = bon::VoiceStealPolicy::Oldest,
+		BON_VoiceStealPolicy_Quietest = bon::VoiceStealPolicy::Quietest,
+		BON_VoiceStealPolicy_None = bon::VoiceStealPolicy::None,
+	};
+
+	/**
+	 * CAPI export of sound rolloff curves.
+	 */
+	BON_DLLEXPORT enum BON_SoundRolloff
+	{
+		BON_SoundRolloff_Linear = bon::SoundRolloff::Linear,
+		BON_SoundRolloff_Inverse = bon::SoundRolloff::Inverse,
+		BON_SoundRolloff_InverseSquare = bon::SoundRolloff::InverseSquare,
+	};
+
+	/**
+	 * CAPI export of asset types.
+	 */
+	BON_DLLEXPORT enum BON_AssetTypes
+	{
+		BON_AssetTypes_Image = bon::AssetTypes::Image,
+		BON_AssetTypes_Sound = bon::AssetTypes::Sound,
+		BON_AssetTypes_Music = bon::AssetTypes::Music,
+		BON_AssetTypes_Config = bon::AssetTypes::Config,
+		BON_AssetTypes_Font = bon::AssetTypes::Font,
+		BON_AssetTypes_Effect = bon::AssetTypes::Effect,
+	};
+
+	/**
+	 * CAPI export of sound storage modes.
+	 */
+	BON_DLLEXPORT enum BON_SoundStorage
+	{
+		BON_SoundStorage_Auto = bon::SoundStorage::Auto,
+		BON_SoundStorage_Decoded = bon::SoundStorage::Decoded,
+		BON_SoundStorage_Compressed = bon::SoundStorage::Compressed,
+	};
+
+	/**
+	 * CAPI export of image streaming modes.
+	 */
+	BON_DLLEXPORT enum BON_ImageStreaming
+	{
+		BON_ImageStreaming_Disabled = bon::ImageStreaming::Disabled,
+		BON_ImageStreaming_Progressive = bon::ImageStreaming::Progressive,
+	};
+
 	/**
 	 * CAPI export of ui element types.
 	 */
@@ -184,6 +285,17 @@ extern "C" {
 		BON_UISizeType_PercentOfParent = bon::UISizeType::PercentOfParent,
 	};
 
+	/**
+	 * CAPI export of ui children arrange modes.
+	 */
+	BON_DLLEXPORT enum BON_UIArrangeMode
+	{
+		BON_UIArrangeMode_Stack = bon::UIArrangeMode::Stack,
+		BON_UIArrangeMode_HorizontalStack = bon::UIArrangeMode::HorizontalStack,
+		BON_UIArrangeMode_Grid = bon::UIArrangeMode::Grid,
+		BON_UIArrangeMode_Flex = bon::UIArrangeMode::Flex,
+	};
+
 	/**
 	 * CAPI export of UI image types.
 	 */
@@ -104,6 +104,26 @@ extern "C" {
 	 */
 	BON_DLLEXPORT void BON_Engine_SetFixedUpdatesInterval(double value);
 
+	/**
+	 * Start recording input to file.
+	 */
+	BON_DLLEXPORT void BON_Engine_StartInputRecording(const char* path);
+
+	/**
+	 * Stop recording input.
+	 */
+	BON_DLLEXPORT void BON_Engine_StopInputRecording();
+
+	/**
+	 * Get if currently recording input.
+	 */
+	BON_DLLEXPORT bool BON_Engine_IsRecordingInput();
+
+	/**
+	 * Get if currently replaying recorded input.
+	 */
+	BON_DLLEXPORT bool BON_Engine_IsReplayingInput();
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
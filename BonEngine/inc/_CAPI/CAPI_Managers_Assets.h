@@ -15,50 +15,68 @@
 extern "C" {
 #endif
 
+	// note: all asset handles returned by this API hold a reference to their asset, and must be released with BON_Assets_ReleaseHandle().
+
 	/**
 	* Load and return an Image asset.
 	*/
-	BON_DLLEXPORT bon::ImageAsset* BON_Assets_LoadImage(const char* filename, BON_ImageFilterMode filter, bool useCache);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadImage(const char* filename, BON_ImageFilterMode filter, bool useCache);
+
+	/**
+	* Load and return an Image asset, with streaming mode (load whole image or stream it progressively).
+	*/
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadImageEx(const char* filename, BON_ImageFilterMode filter, bool useCache, BON_ImageStreaming streaming);
 
 	/**
 	* Creates and return an empty image asset.
 	*/
-	BON_DLLEXPORT bon::ImageAsset* BON_Assets_CreateEmptyImage(int x, int y, BON_ImageFilterMode filter);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_CreateEmptyImage(int x, int y, BON_ImageFilterMode filter);
 
 	/**
 	* Load and return a music asset.
 	*/
-	BON_DLLEXPORT bon::MusicAsset* BON_Assets_LoadMusic(const char* filename, bool useCache);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadMusic(const char* filename, bool useCache);
 
 	/**
 	* Load and return a sound effect asset.
 	*/
-	BON_DLLEXPORT bon::SoundAsset* BON_Assets_LoadSound(const char* filename, bool useCache);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadSound(const char* filename, bool useCache);
+
+	/**
+	* Load and return a sound effect asset, with storage mode (decode on load or keep compressed).
+	*/
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadSoundEx(const char* filename, bool useCache, BON_SoundStorage storage);
 
 	/**
 	* Load and return a font asset.
 	*/
-	BON_DLLEXPORT bon::FontAsset* BON_Assets_LoadFont(const char* filename, int fontSize, bool useCache);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadFont(const char* filename, int fontSize, bool useCache);
 
 	/**
 	* Load and return a configuration asset.
 	*/
-	BON_DLLEXPORT bon::ConfigAsset* BON_Assets_LoadConfig(const char* filename, bool useCache);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadConfig(const char* filename, bool useCache);
 
 	/**
 	* Create and return an empty configuration file.
 	*/
-	BON_DLLEXPORT bon::ConfigAsset* BON_Assets_CreateEmptyConfig();
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_CreateEmptyConfig();
+
+	/**
+	* Release an asset handle returned by one of the load / create / getter methods.
+	* If deferred is true, handle remains valid until next assets update.
+	*/
+	BON_DLLEXPORT void BON_Assets_ReleaseHandle(bon::AssetHandle asset, bool deferred);
 
 	/**
-	* Release an asset pointer, created by one of the getter methods.
+	* Check if an asset handle is valid (was not released).
 	*/
-	BON_DLLEXPORT void BON_Assets_FreeAssetPointer(bon::AssetPtr* asset);
+	BON_DLLEXPORT bool BON_Assets_IsHandleValid(bon::AssetHandle asset);
 
 	/**
 	* Save configuration file.
 	*/
-	BON_DLLEXPORT bool BON_Assets_SaveConfig(bon::ConfigAsset* config, const char* filename);
+	BON_DLLEXPORT bool BON_Assets_SaveConfig(bon::AssetHandle config, const char* filename);
 
 	/**
 	* Clear all assets from cache.
@@ -68,7 +86,17 @@ extern "C" {
 	/**
 	* Load and return an effect asset.
 	*/
-	BON_DLLEXPORT bon::EffectAsset* BON_Assets_LoadEffect(const char* filename, bool useCache);
+	BON_DLLEXPORT bon::AssetHandle BON_Assets_LoadEffect(const char* filename, bool useCache);
+
+	/**
+	* Set memory budgets for cached assets of a given type (0 = unlimited).
+	*/
+	BON_DLLEXPORT void BON_Assets_SetCacheBudget(BON_AssetTypes type, size_t ramBytes, size_t vramBytes);
+
+	/**
+	* Get cache residency stats for a given asset type.
+	*/
+	BON_DLLEXPORT void BON_Assets_GetCacheStats(BON_AssetTypes type, size_t* outCachedAssets, size_t* outWeakAssets, size_t* outRamBytes, size_t* outVramBytes, size_t* outEvictions);
 
 #ifdef __cplusplus
 }
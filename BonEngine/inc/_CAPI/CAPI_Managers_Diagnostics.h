@@ -33,6 +33,36 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Diagnostics_FpsCounter();
 
+	/**
+	* Get how many values a histogram bucket has.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetHistogramBucket(int id, int bucket);
+
+	/**
+	* Get histogram buckets count.
+	*/
+	BON_DLLEXPORT int BON_Diagnostics_GetHistogramBucketsCount();
+
+	/**
+	* Get histogram bucket size.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetHistogramBucketSize(int id);
+
+	/**
+	* Get histogram total values count.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetHistogramCount(int id);
+
+	/**
+	* Get histogram biggest value.
+	*/
+	BON_DLLEXPORT int64_t BON_Diagnostics_GetHistogramMax(int id);
+
+	/**
+	* Reset histogram values.
+	*/
+	BON_DLLEXPORT void BON_Diagnostics_ResetHistogram(int id);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -16,22 +16,22 @@ extern "C" {
 	/**
 	* Draw an image on screen.
 	*/
-	BON_DLLEXPORT void BON_Gfx_DrawImage(const bon::assets::ImageAsset* image, float x, float y, int width, int height, BON_BlendModes blend);
+	BON_DLLEXPORT void BON_Gfx_DrawImage(bon::AssetHandle image, float x, float y, int width, int height, BON_BlendModes blend);
 
 	/**
 	* Draw an image on screen.
 	*/
-	BON_DLLEXPORT void BON_Gfx_DrawImageEx(const bon::assets::ImageAsset* image, float x, float y, int width, int height, BON_BlendModes blend, int sx, int sy, int swidth, int sheight, float originX, float originY, float rotation, float r, float g, float b, float a);
+	BON_DLLEXPORT void BON_Gfx_DrawImageEx(bon::AssetHandle image, float x, float y, int width, int height, BON_BlendModes blend, int sx, int sy, int swidth, int sheight, float originX, float originY, float rotation, float r, float g, float b, float a);
 
 	/**
 	* Draw text on screen.
 	*/
-	BON_DLLEXPORT void BON_Gfx_DrawText(const bon::assets::FontAsset* font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation);
+	BON_DLLEXPORT void BON_Gfx_DrawText(bon::AssetHandle font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation);
 
 	/**
 	* Draw text with outline on screen.
 	*/
-	BON_DLLEXPORT void BON_Gfx_DrawTextWithOutline(const bon::assets::FontAsset* font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation, int outlineWidth, float outlineR, float outlineG, float outlineB, float outlineA);
+	BON_DLLEXPORT void BON_Gfx_DrawTextWithOutline(bon::AssetHandle font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation, int outlineWidth, float outlineR, float outlineG, float outlineB, float outlineA);
 	
 	/**
 	* Draws a line.
@@ -76,22 +76,22 @@ extern "C" {
 	/**
 	* Set the target we render to.
 	*/
-	BON_DLLEXPORT void BON_Gfx_SetRenderTarget(const bon::assets::ImageAsset* target);
+	BON_DLLEXPORT void BON_Gfx_SetRenderTarget(bon::AssetHandle target);
 	
 	/**
-	 * Get render target or null.
+	 * Get render target handle or 0. Handle is borrowed (don't release it), and is the handle the render target was set with.
 	 */
-	BON_DLLEXPORT bon::assets::ImageAsset* BON_Gfx_GetRenderTarget();
+	BON_DLLEXPORT bon::AssetHandle BON_Gfx_GetRenderTarget();
 	
 	/**
 	 * Create image asset from screen.
 	 */
-	BON_DLLEXPORT bon::assets::ImageAsset* BON_Gfx_CreateImageFromScreen();
+	BON_DLLEXPORT bon::AssetHandle BON_Gfx_CreateImageFromScreen();
 
 	/**
 	 * Set effect to use.
 	 */
-	BON_DLLEXPORT void BON_Gfx_UseEffect(const bon::assets::EffectAsset* effect);
+	BON_DLLEXPORT void BON_Gfx_UseEffect(bon::AssetHandle effect);
 
 	/**
 	 * Focus on window.
@@ -129,10 +129,90 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Gfx_SetViewport(int x, int y, int w, int h);
 
+	/**
+	* Set clipping rect, or 0,0,0,0 to disable clipping.
+	*/
+	BON_DLLEXPORT void BON_Gfx_SetClipRect(int x, int y, int w, int h);
+
+	/**
+	* Get clipping rect. Returns false if clipping is disabled.
+	*/
+	BON_DLLEXPORT bool BON_Gfx_GetClipRect(int* x, int* y, int* w, int* h);
+
+	/**
+	* Set offset to add to all drawing positions.
+	*/
+	BON_DLLEXPORT void BON_Gfx_SetDrawOffset(int x, int y);
+
+	/**
+	* Get offset we add to all drawing positions.
+	*/
+	BON_DLLEXPORT void BON_Gfx_GetDrawOffset(int* x, int* y);
+
 	/**
 	 * Get the estimated bounding box of a text drawing.
 	 */
-	BON_DLLEXPORT void BON_Gfx_GetTextBoundingBox(const bon::assets::FontAsset* font, const char* text, float x, float y, int fontSize, int maxWidth, float originX, float originY, float rotation, int* outX, int* outY, int* outWidth, int* outHeight);
+	BON_DLLEXPORT void BON_Gfx_GetTextBoundingBox(bon::AssetHandle font, const char* text, float x, float y, int fontSize, int maxWidth, float originX, float originY, float rotation, int* outX, int* outY, int* outWidth, int* outHeight);
+
+	/**
+	 * Compile effects waiting for lazy compilation. Return how many effects are left to compile.
+	 */
+	BON_DLLEXPORT int BON_Gfx_WarmUpEffects(double maxTime);
+
+	/**
+	 * Read pixels from image or screen (if image is null) without waiting for the GPU. Must be freed with BON_PixelsReadback_Free().
+	 */
+	BON_DLLEXPORT bon::gfx::PixelsReadback* BON_Gfx_ReadPixelsAsync(bon::AssetHandle image, int x, int y, int w, int h, const char* saveToFile);
+
+	/**
+	 * Get if async pixels readback is ready.
+	 */
+	BON_DLLEXPORT bool BON_PixelsReadback_IsReady(const bon::gfx::PixelsReadback* readback);
+
+	/**
+	 * Get if async pixels readback failed.
+	 */
+	BON_DLLEXPORT bool BON_PixelsReadback_Failed(const bon::gfx::PixelsReadback* readback);
+
+	/**
+	 * Get async pixels readback raw RGBA data, or null if not ready.
+	 */
+	BON_DLLEXPORT const unsigned char* BON_PixelsReadback_Pixels(const bon::gfx::PixelsReadback* readback);
+
+	/**
+	 * Get pixel from async pixels readback.
+	 */
+	BON_DLLEXPORT void BON_PixelsReadback_GetPixel(const bon::gfx::PixelsReadback* readback, int x, int y, float* r, float* g, float* b, float* a);
+
+	/**
+	 * Save async pixels readback to file.
+	 */
+	BON_DLLEXPORT bool BON_PixelsReadback_SaveToFile(const bon::gfx::PixelsReadback* readback, const char* filename);
+
+	/**
+	 * Free async pixels readback pointer.
+	 */
+	BON_DLLEXPORT void BON_PixelsReadback_Free(bon::gfx::PixelsReadback* readback);
+
+	/**
+	 * Start capturing frames to disk. Format: 0 = png sequence, 1 = y4m. Overflow: 0 = drop frames, 1 = throttle.
+	 */
+	BON_DLLEXPORT void BON_Gfx_StartFrameCapture(int format, const char* outputPath, int captureEveryNFrames, int maxQueuedFrames, int workerThreads, int overflow, int frameRate, int maxFrames);
+
+	/**
+	 * Start capturing frames to disk, with settings from config.
+	 */
+	BON_DLLEXPORT void BON_Gfx_StartFrameCaptureFromConfig(bon::AssetHandle config);
+
+	/**
+	 * Stop capturing frames.
+	 */
+	BON_DLLEXPORT void BON_Gfx_StopFrameCapture();
+
+	/**
+	 * Get if currently capturing frames.
+	 */
+	BON_DLLEXPORT bool BON_Gfx_IsCapturingFrames();
 
 #ifdef __cplusplus
 }
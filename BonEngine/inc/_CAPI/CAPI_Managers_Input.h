@@ -28,6 +28,26 @@ extern "C" {
 	*/
 	BON_DLLEXPORT bool BON_Input_PressedNow(const char* actionId);
 
+	/**
+	* Register an action id and get its handle.
+	*/
+	BON_DLLEXPORT int BON_Input_RegisterAction(const char* actionId);
+
+	/**
+	* Get if a given game action handle is down.
+	*/
+	BON_DLLEXPORT bool BON_Input_ActionDown(int action);
+
+	/**
+	* Get if a given game action handle was released this frame
+	*/
+	BON_DLLEXPORT bool BON_Input_ActionReleasedNow(int action);
+
+	/**
+	* Get if a given game action handle was pressed this frame
+	*/
+	BON_DLLEXPORT bool BON_Input_ActionPressedNow(int action);
+
 	/**
 	* Get if a key code is down.
 	*/
@@ -88,6 +108,11 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Input_SetKeyBind(BON_KeyCodes keyCode, const char* actionId);
 
+	/**
+	* Bind a key to an additional action id, without removing previous binds.
+	*/
+	BON_DLLEXPORT void BON_Input_AddKeyBind(BON_KeyCodes keyCode, const char* actionId);
+
 	/**
 	* Get list of key codes assigned to given action id.
 	*/
@@ -111,7 +136,7 @@ extern "C" {
 	/**
 	* Load key binds from config asset.
 	*/
-	BON_DLLEXPORT void BON_Input_LoadControlsFromConfig(bon::ConfigAsset* config, bool replaceExisting);
+	BON_DLLEXPORT void BON_Input_LoadControlsFromConfig(bon::AssetHandle config, bool replaceExisting);
 
 #ifdef __cplusplus
 }
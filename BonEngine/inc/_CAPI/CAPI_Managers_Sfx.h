@@ -21,7 +21,7 @@ extern "C" {
 	/**
 	* Play a music track.
 	*/
-	BON_DLLEXPORT void BON_Sfx_PlayMusic(bon::assets::MusicAsset* music, int volume, int loops, float fadeInTime);
+	BON_DLLEXPORT void BON_Sfx_PlayMusic(bon::AssetHandle music, int volume, int loops, float fadeInTime);
 
 	/**
 	* Pause / resume currently played track.
@@ -41,12 +41,12 @@ extern "C" {
 	/**
 	* Play a sound effect.
 	*/
-	BON_DLLEXPORT int BON_Sfx_PlaySound(bon::assets::SoundAsset* sound, int volume, int loops, float pitch, float fadeInTime);
+	BON_DLLEXPORT int BON_Sfx_PlaySound(bon::AssetHandle sound, int volume, int loops, float pitch, float fadeInTime);
 
 	/**
 	* Play a sound effect.
 	*/
-	BON_DLLEXPORT int BON_Sfx_PlaySoundEx(bon::assets::SoundAsset* sound, int volume, int loops, float pitch, float panLeft, float panRight, float distance, float fadeInTime);
+	BON_DLLEXPORT int BON_Sfx_PlaySoundEx(bon::AssetHandle sound, int volume, int loops, float pitch, float panLeft, float panRight, float distance, float fadeInTime);
 
 	/**
 	* Set channel distance from listener (affect volume).
@@ -68,6 +68,96 @@ extern "C" {
 	*/
 	BON_DLLEXPORT void BON_Sfx_SetChannelVolume(int channel, int volume);
 
+	/**
+	* Set the pitch of a currently playing sound channel.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetChannelPitch(int channel, float pitch);
+
+	/**
+	* Get the pitch of a sound channel.
+	*/
+	BON_DLLEXPORT float BON_Sfx_GetChannelPitch(int channel);
+
+	/**
+	* Set resampling quality for pitched sounds.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetResampleQuality(BON_ResampleQuality quality);
+
+	/**
+	* Get resampling quality for pitched sounds.
+	*/
+	BON_DLLEXPORT BON_ResampleQuality BON_Sfx_GetResampleQuality();
+
+	/**
+	* Set the volume of a mix bus.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetBusVolume(BON_SoundBus bus, float volume);
+
+	/**
+	* Get the volume of a mix bus.
+	*/
+	BON_DLLEXPORT float BON_Sfx_GetBusVolume(BON_SoundBus bus);
+
+	/**
+	* Get if audio is rendered offline.
+	*/
+	BON_DLLEXPORT bool BON_Sfx_IsOfflineAudio();
+
+	/**
+	* Render mixer output into buffer, when audio is rendered offline.
+	*/
+	BON_DLLEXPORT int BON_Sfx_RenderOffline(float* buffer, int frames);
+
+	/**
+	* Write audio thread stats to log.
+	*/
+	BON_DLLEXPORT void BON_Sfx_LogAudioStats();
+
+	/**
+	* Set the listener transform for positional audio.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetListener(float x, float y, float rotation);
+
+	/**
+	* Get the listener position.
+	*/
+	BON_DLLEXPORT void BON_Sfx_GetListenerPosition(float* outX, float* outY);
+
+	/**
+	* Set the distance from listener at which sounds are panned completely to one side.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetSpatialPanDistance(float distance);
+
+	/**
+	* Create a sound emitter for positional audio.
+	*/
+	BON_DLLEXPORT int BON_Sfx_CreateEmitter(float x, float y, float minDistance, float maxDistance, BON_SoundRolloff rolloff);
+
+	/**
+	* Destroy a sound emitter.
+	*/
+	BON_DLLEXPORT void BON_Sfx_DestroyEmitter(int emitter);
+
+	/**
+	* Set sound emitter position.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetEmitterPosition(int emitter, float x, float y);
+
+	/**
+	* Get sound emitter position.
+	*/
+	BON_DLLEXPORT void BON_Sfx_GetEmitterPosition(int emitter, float* outX, float* outY);
+
+	/**
+	* Set sound emitter distances and rolloff curve.
+	*/
+	BON_DLLEXPORT void BON_Sfx_SetEmitterRolloff(int emitter, float minDistance, float maxDistance, BON_SoundRolloff rolloff);
+
+	/**
+	* Play a sound effect on a sound emitter.
+	*/
+	BON_DLLEXPORT int BON_Sfx_PlaySoundAt(int emitter, bon::AssetHandle sound, int volume, int loops, float pitch, float fadeInTime);
+
 	/**
 	* Set channel panning.
 	*/
@@ -25,7 +25,7 @@ extern "C" {
 	/**
 	* Set cursor to render.
 	*/
-	BON_DLLEXPORT void BON_UI_SetCursorEx(const bon::assets::ImageAsset* image, int width, int height, int offsetX, int offsetY);
+	BON_DLLEXPORT void BON_UI_SetCursorEx(bon::AssetHandle image, int width, int height, int offsetX, int offsetY);
 
 	/**
 	* Set cursor to render from image element.
@@ -117,6 +117,17 @@ extern "C" {
 	*/
 	BON_DLLEXPORT bon::UIVerticalScrollbar* BON_UI_CreateVerticalScrollbar(const char* stylesheet, bon::UIElement* parent);
 
+	/**
+	* Create many elements of the same type and stylesheet.
+	* 'outElements' must have room for 'count' pointers, every element should be released with BON_UI_ReleaseElement().
+	*/
+	BON_DLLEXPORT void BON_UI_CreateElements(BON_UIElementType type, const char* stylesheet, bon::UIElement* parent, int count, bon::UIElement** outElements);
+
+	/**
+	* Clear compiled styles cache.
+	*/
+	BON_DLLEXPORT void BON_UI_ClearStylesCache();
+
 	/**
 	* Override cursor position just for the input manager.
 	*/
@@ -140,7 +140,7 @@ extern "C" {
 	/**
 	 * Load element stylesheet from config asset.
 	 */
-	BON_DLLEXPORT void BON_UIElement_LoadStyleFrom(bon::UIElement* element, bon::ConfigAsset* config);
+	BON_DLLEXPORT void BON_UIElement_LoadStyleFrom(bon::UIElement* element, bon::AssetHandle config);
 
 	/**
 	 * Set element Force Active State mode.
@@ -322,6 +322,61 @@ extern "C" {
 	 */
 	BON_DLLEXPORT void BON_UIElement_SetAutoArrangeChildren(bon::UIElement* element, bool val);
 
+	/**
+	 * Get element ArrangeMode.
+	 */
+	BON_DLLEXPORT BON_UIArrangeMode BON_UIElement_GetArrangeMode(bon::UIElement* element);
+
+	/**
+	 * Set element ArrangeMode.
+	 */
+	BON_DLLEXPORT void BON_UIElement_SetArrangeMode(bon::UIElement* element, BON_UIArrangeMode val);
+
+	/**
+	 * Get element ArrangeColumns.
+	 */
+	BON_DLLEXPORT int BON_UIElement_GetArrangeColumns(bon::UIElement* element);
+
+	/**
+	 * Set element ArrangeColumns.
+	 */
+	BON_DLLEXPORT void BON_UIElement_SetArrangeColumns(bon::UIElement* element, int val);
+
+	/**
+	 * Get element FlexGrow.
+	 */
+	BON_DLLEXPORT float BON_UIElement_GetFlexGrow(bon::UIElement* element);
+
+	/**
+	 * Set element FlexGrow.
+	 */
+	BON_DLLEXPORT void BON_UIElement_SetFlexGrow(bon::UIElement* element, float val);
+
+	/**
+	 * Get element CacheAsTexture.
+	 */
+	BON_DLLEXPORT bool BON_UIElement_GetCacheAsTexture(bon::UIElement* element);
+
+	/**
+	 * Set element CacheAsTexture.
+	 */
+	BON_DLLEXPORT void BON_UIElement_SetCacheAsTexture(bon::UIElement* element, bool val);
+
+	/**
+	 * Mark element cached texture (and its parents cached textures) as outdated.
+	 */
+	BON_DLLEXPORT void BON_UIElement_InvalidateCache(bon::UIElement* element);
+
+	/**
+	 * Get element ClipChildren.
+	 */
+	BON_DLLEXPORT bool BON_UIElement_GetClipChildren(bon::UIElement* element);
+
+	/**
+	 * Set element ClipChildren.
+	 */
+	BON_DLLEXPORT void BON_UIElement_SetClipChildren(bon::UIElement* element, bool val);
+
 	/**
 	 * Get element ExemptFromAutoArrange.
 	 */
@@ -383,14 +438,14 @@ extern "C" {
 	BON_DLLEXPORT void BON_UIRadio_Toggle(bon::UIRadioButton* element);
 
 	/**
-	 * Get ui image image.
+	 * Get ui image image handle or 0. Handle is borrowed (don't release it), and is 0 if image has no handle (for example, loaded by a stylesheet and never acquired).
 	 */
-	BON_DLLEXPORT bon::ImageAsset* BON_UIImage_GetImage(bon::UIImage* element);
+	BON_DLLEXPORT bon::AssetHandle BON_UIImage_GetImage(bon::UIImage* element);
 
 	/**
 	 * Set ui image image.
 	 */
-	BON_DLLEXPORT void BON_UIImage_SetImage(bon::UIImage* element, bon::ImageAsset* image);
+	BON_DLLEXPORT void BON_UIImage_SetImage(bon::UIImage* element, bon::AssetHandle image);
 
 	/**
 	 * Set ui image source rect.
@@ -502,6 +557,36 @@ extern "C" {
 	 */
 	BON_DLLEXPORT void BON_UIList_RemoveItemByIndex(bon::UIList* element, int index);
 
+	/**
+	 * Add items to list.
+	 */
+	BON_DLLEXPORT void BON_UIList_AddItems(bon::UIList* element, const char** items, int count);
+
+	/**
+	 * Insert item to list at index.
+	 */
+	BON_DLLEXPORT void BON_UIList_InsertItem(bon::UIList* element, int index, const char* item);
+
+	/**
+	 * Insert items to list at index.
+	 */
+	BON_DLLEXPORT void BON_UIList_InsertItems(bon::UIList* element, int index, const char** items, int count);
+
+	/**
+	 * Remove range of items from list.
+	 */
+	BON_DLLEXPORT void BON_UIList_RemoveItems(bon::UIList* element, int index, int count);
+
+	/**
+	 * Get list items count.
+	 */
+	BON_DLLEXPORT int BON_UIList_ItemsCount(bon::UIList* element);
+
+	/**
+	 * Get list item by index.
+	 */
+	BON_DLLEXPORT const char* BON_UIList_GetItem(bon::UIList* element, int index);
+
 	/**
 	 * Remove item from list.
 	 */
@@ -578,14 +663,14 @@ extern "C" {
 	BON_DLLEXPORT int BON_UISlider_GetValue(bon::UISlider* element);
 
 	/**
-	 * Get text font.
+	 * Get text font handle or 0. Handle is borrowed (don't release it), and is 0 if font has no handle (for example, loaded by a stylesheet and never acquired).
 	 */
-	BON_DLLEXPORT bon::FontAsset* BON_UIText_GetFont(bon::UIText* element);
+	BON_DLLEXPORT bon::AssetHandle BON_UIText_GetFont(bon::UIText* element);
 
 	/**
 	 * Set text font.
 	 */
-	BON_DLLEXPORT void BON_UIText_SetFont(bon::UIText* element, bon::FontAsset* font);
+	BON_DLLEXPORT void BON_UIText_SetFont(bon::UIText* element, bon::AssetHandle font);
 
 	/**
 	 * Get text outline.
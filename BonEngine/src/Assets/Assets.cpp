@@ -25,6 +25,10 @@ namespace bon
 		// its important to dispose assets during 'update' and not on the actual moment they release, to prevent crashes in SDL.
 		std::vector<IAsset*> _deleteQueue;
 
+		// assets taken from delete queue to dispose this frame.
+		// disposed without holding the delete queue mutex, since disposing takes the cache mutex and loading assets takes them in the opposite order.
+		std::vector<IAsset*> _disposeList;
+
 		/**
 		 * Internal helper class that implements generic loading code.
 		 */
@@ -108,12 +112,34 @@ namespace bon
 		// do updates
 		void Assets::_Update(double deltaTime)
 		{
-			// clear assets on delete list
-			std::lock_guard<std::mutex> guard(g_delete_queue_mutex);
-			if (!_deleteQueue.empty())
+			// release deferred handles (before locking delete queue, as releasing may add assets to it)
+			_registry.FlushDeferred();
+
+			// evict cached assets over budget. evicted assets are released after unlocking cache, so they're added to delete queue and disposed below
+			{
+				std::lock_guard<std::mutex> guard(g_cache_mutex);
+				_cache.Evict(_releasedFromCache);
+			}
+			if (!_releasedFromCache.empty())
 			{
-				BON_DLOG("Got %d assets to destroy. Begin disposing..", _deleteQueue.size());
-				for (auto asset : _deleteQueue)
+				BON_DLOG("Evicted %d assets from cache to stay within memory budget.", (int)_releasedFromCache.size());
+				_releasedFromCache.clear();
+			}
+
+			// update cache diagnostics
+			UpdateCacheDiagnostics();
+
+			// take assets on delete list (assets released while disposing will be added to queue and deleted next frame)
+			{
+				std::lock_guard<std::mutex> guard(g_delete_queue_mutex);
+				_disposeList.swap(_deleteQueue);
+			}
+
+			// dispose and delete them
+			if (!_disposeList.empty())
+			{
+				BON_DLOG("Got %d assets to destroy. Begin disposing..", (int)_disposeList.size());
+				for (auto asset : _disposeList)
 				{
 					if (asset->IsValid())
 					{
@@ -121,12 +147,12 @@ namespace bon
 					}
 				}
 				BON_DLOG("Now delete disposed assets.");
-				for (int i = 0; i < (int)_deleteQueue.size(); ++i)
+				for (int i = 0; i < (int)_disposeList.size(); ++i)
 				{
-					delete _deleteQueue[i];
+					delete _disposeList[i];
 				}
 				BON_DLOG("Done deleting assets.");
-				_deleteQueue.clear();
+				_disposeList.clear();
 			}
 		}
 
@@ -136,13 +162,14 @@ namespace bon
 		}
 
 		// load an image asset
-		ImageAsset Assets::LoadImage(const char* filename, ImageFilterMode filter, bool useCache)
+		ImageAsset Assets::LoadImage(const char* filename, ImageFilterMode filter, bool useCache, ImageStreaming streaming)
 		{
 			auto createImageLambda = [filename, filter]() { return new _Image(filename, filter); };
 			std::string tempStringForCache;
 			if (useCache) { tempStringForCache = (std::string(filename) + std::to_string((int)filter)); }
+			if (useCache && streaming != ImageStreaming::Disabled) { tempStringForCache += "#" + std::to_string((int)streaming); }
 			const char* cacheKey = useCache ? tempStringForCache.c_str() : nullptr;
-			return AssetsLoaderCode::LoadAssetT<_Image>(this, filename, cacheKey, useCache, nullptr, createImageLambda);
+			return AssetsLoaderCode::LoadAssetT<_Image>(this, filename, cacheKey, useCache, &streaming, createImageLambda);
 		}
 
 		// load a music asset
@@ -152,9 +179,12 @@ namespace bon
 		}
 		
 		// load a sound effect asset
-		SoundAsset Assets::LoadSound(const char* filename, bool useCache)
+		SoundAsset Assets::LoadSound(const char* filename, bool useCache, SoundStorage storage)
 		{
-			return AssetsLoaderCode::LoadAssetT<_Sound>(this, filename, filename, useCache);
+			std::string tempStringForCache;
+			if (useCache && storage != SoundStorage::Auto) { tempStringForCache = (std::string(filename) + "#" + std::to_string((int)storage)); }
+			const char* cacheKey = (useCache && storage != SoundStorage::Auto) ? tempStringForCache.c_str() : filename;
+			return AssetsLoaderCode::LoadAssetT<_Sound>(this, filename, cacheKey, useCache, &storage);
 		}
 
 		// load a config asset
@@ -223,21 +253,104 @@ namespace bon
 		{
 			BON_DLOG("Add asset '%s' to cache (key = '%s').", asset->Path(), key);
 			std::lock_guard<std::mutex> guard(g_cache_mutex);
-			(_cache)[std::move(key)] = asset;
+			_cache.Put(asset, key);
 		}
 
 		// get from cache
 		AssetPtr Assets::GetFromCache(const char* cacheId)
 		{
-			return (_cache)[std::move(cacheId)];
+			return _cache.Get(cacheId);
 		}
 
 		// clear cache
 		void Assets::ClearCache()
 		{
 			BON_DLOG("Clear assets cache.");
+			std::vector<AssetPtr> released;
+			{
+				std::lock_guard<std::mutex> guard(g_cache_mutex);
+				_cache.Clear(released);
+			}
+		}
+
+		// set cache budgets
+		void Assets::SetCacheBudget(AssetTypes type, size_t ramBytes, size_t vramBytes)
+		{
 			std::lock_guard<std::mutex> guard(g_cache_mutex);
-			_cache.clear();
+			_cache.SetBudget(type, ramBytes, vramBytes);
+		}
+
+		// get cache stats
+		AssetsCacheStats Assets::GetCacheStats(AssetTypes type) const
+		{
+			std::lock_guard<std::mutex> guard(g_cache_mutex);
+			return _cache.Stats(type);
+		}
+
+		// update cache diagnostics counters
+		void Assets::UpdateCacheDiagnostics()
+		{
+			// sum all types
+			AssetsCacheStats total;
+			{
+				std::lock_guard<std::mutex> guard(g_cache_mutex);
+				for (int i = 0; i < (int)AssetTypes::_Count; ++i)
+				{
+					const AssetsCacheStats& stats = _cache.Stats((AssetTypes)i);
+					total.CachedAssets += stats.CachedAssets;
+					total.RamBytes += stats.RamBytes;
+					total.VramBytes += stats.VramBytes;
+					total.Evictions += stats.Evictions;
+				}
+			}
+
+			// set counters
+			auto& diagnostics = _GetEngine().Diagnostics();
+			diagnostics.ResetCounter(DiagnosticsCounters::CachedAssets);
+			diagnostics.IncreaseCounter(DiagnosticsCounters::CachedAssets, (int)total.CachedAssets);
+			diagnostics.ResetCounter(DiagnosticsCounters::CachedAssetsRamKB);
+			diagnostics.IncreaseCounter(DiagnosticsCounters::CachedAssetsRamKB, (int)(total.RamBytes / 1024));
+			diagnostics.ResetCounter(DiagnosticsCounters::CachedAssetsVramKB);
+			diagnostics.IncreaseCounter(DiagnosticsCounters::CachedAssetsVramKB, (int)(total.VramBytes / 1024));
+			diagnostics.ResetCounter(DiagnosticsCounters::EvictedAssets);
+			diagnostics.IncreaseCounter(DiagnosticsCounters::EvictedAssets, (int)total.Evictions);
+		}
+
+		// get handle for asset
+		AssetHandle Assets::AcquireHandle(const AssetPtr& asset)
+		{
+			return _registry.Acquire(asset);
+		}
+
+		// release asset handle
+		void Assets::ReleaseHandle(AssetHandle handle, bool deferred)
+		{
+			if (deferred)
+			{
+				_registry.ReleaseDeferred(handle);
+			}
+			else
+			{
+				_registry.Release(handle);
+			}
+		}
+
+		// find existing asset handle
+		AssetHandle Assets::FindHandle(const AssetPtr& asset) const
+		{
+			return asset ? _registry.Find(asset.get()) : InvalidAssetHandle;
+		}
+
+		// check if asset handle is valid
+		bool Assets::IsHandleValid(AssetHandle handle) const
+		{
+			return _registry.IsValid(handle);
+		}
+
+		// get untyped asset by handle
+		IAsset* Assets::ResolveHandle(AssetHandle handle) const
+		{
+			return _registry.Resolve(handle);
 		}
 
 		// register initializer to handle asset type
@@ -332,16 +445,12 @@ namespace bon
 
 			// clear handle
 			asset->_SetHandle(nullptr);
-			// sanity - if asset is somehow in cache, remove it
-			for (auto it = _cache.begin(); it != _cache.end(); )
+
+			// remove asset's cache entry (weak entries are left in cache until their asset is disposed)
+			std::lock_guard<std::mutex> guard(g_cache_mutex);
+			if (_cache.Remove(asset))
 			{
-				if (it->second.get() == asset) 
-				{ 
-					std::lock_guard<std::mutex> guard(g_cache_mutex);
-					BON_ELOG("Warning! Disposed asset while its still in cache! Path: '%s', Address: %x.", asset->Path(), asset);
-					_cache.erase(it++); 
-				}
-				else { ++it; }
+				BON_ELOG("Warning! Disposed asset while its still in cache! Path: '%s', Address: %x.", asset->Path(), asset);
 			}
 		}
 	}
@@ -0,0 +1,162 @@
+#include <Assets/AssetsRegistry.h>
+#include <Assets/IAssets.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+
+namespace bon
+{
+	namespace assets
+	{
+		// get handle for asset
+		AssetHandle AssetsRegistry::Acquire(const AssetPtr& asset)
+		{
+			// null asset?
+			if (asset == nullptr) { return InvalidAssetHandle; }
+
+			// already registered? add reference
+			auto existing = _handles.find(asset.get());
+			if (existing != _handles.end())
+			{
+				AssetHandle handle = existing->second;
+				uint32_t index = Index(handle);
+				uint32_t generation = Generation(handle);
+				switch (Type(handle))
+				{
+				case AssetTypes::Image: _images.GetSlot(index, generation)->References++; break;
+				case AssetTypes::Sound: _sounds.GetSlot(index, generation)->References++; break;
+				case AssetTypes::Music: _music.GetSlot(index, generation)->References++; break;
+				case AssetTypes::Config: _configs.GetSlot(index, generation)->References++; break;
+				case AssetTypes::Font: _fonts.GetSlot(index, generation)->References++; break;
+				case AssetTypes::Effect: _effects.GetSlot(index, generation)->References++; break;
+				default: break;
+				}
+				return handle;
+			}
+
+			// put in a new slot
+			AssetTypes type = asset->AssetType();
+			uint32_t generation = 0;
+			int index = -1;
+			switch (type)
+			{
+			case AssetTypes::Image: index = _images.Add(std::static_pointer_cast<_Image>(asset), MaxSlots, generation); break;
+			case AssetTypes::Sound: index = _sounds.Add(std::static_pointer_cast<_Sound>(asset), MaxSlots, generation); break;
+			case AssetTypes::Music: index = _music.Add(std::static_pointer_cast<_Music>(asset), MaxSlots, generation); break;
+			case AssetTypes::Config: index = _configs.Add(std::static_pointer_cast<_Config>(asset), MaxSlots, generation); break;
+			case AssetTypes::Font: index = _fonts.Add(std::static_pointer_cast<_Font>(asset), MaxSlots, generation); break;
+			case AssetTypes::Effect: index = _effects.Add(std::static_pointer_cast<_Effect>(asset), MaxSlots, generation); break;
+			default: break;
+			}
+
+			// no free slots?
+			if (index < 0)
+			{
+				BON_ELOG("Failed to register asset '%s': no free asset handles left.", asset->Path());
+				return InvalidAssetHandle;
+			}
+
+			// register and return handle
+			AssetHandle handle = MakeHandle((uint32_t)index, type, generation);
+			_handles[asset.get()] = handle;
+			return handle;
+		}
+
+		// release a handle reference
+		void AssetsRegistry::Release(AssetHandle handle)
+		{
+			// get asset and remove reference
+			IAsset* asset = Resolve(handle);
+			if (asset == nullptr) { return; }
+			uint32_t index = Index(handle);
+			uint32_t generation = Generation(handle);
+
+			// free slot on last reference. the asset itself is released when 'last' goes out of scope, after registry is updated
+			AssetPtr last;
+			switch (Type(handle))
+			{
+			case AssetTypes::Image: if (--_images.GetSlot(index, generation)->References == 0) { last = _images.Free(index, GenerationMask); } break;
+			case AssetTypes::Sound: if (--_sounds.GetSlot(index, generation)->References == 0) { last = _sounds.Free(index, GenerationMask); } break;
+			case AssetTypes::Music: if (--_music.GetSlot(index, generation)->References == 0) { last = _music.Free(index, GenerationMask); } break;
+			case AssetTypes::Config: if (--_configs.GetSlot(index, generation)->References == 0) { last = _configs.Free(index, GenerationMask); } break;
+			case AssetTypes::Font: if (--_fonts.GetSlot(index, generation)->References == 0) { last = _fonts.Free(index, GenerationMask); } break;
+			case AssetTypes::Effect: if (--_effects.GetSlot(index, generation)->References == 0) { last = _effects.Free(index, GenerationMask); } break;
+			default: break;
+			}
+			if (last != nullptr)
+			{
+				_handles.erase(asset);
+			}
+		}
+
+		// release handle on next flush
+		void AssetsRegistry::ReleaseDeferred(AssetHandle handle)
+		{
+			if (IsValid(handle))
+			{
+				_deferred.push_back(handle);
+			}
+		}
+
+		// release deferred handles
+		void AssetsRegistry::FlushDeferred()
+		{
+			if (_deferred.empty()) { return; }
+			std::vector<AssetHandle> toRelease;
+			toRelease.swap(_deferred);
+			for (AssetHandle handle : toRelease)
+			{
+				Release(handle);
+			}
+		}
+
+		// release all handles
+		void AssetsRegistry::Clear()
+		{
+			_deferred.clear();
+			std::vector<AssetHandle> handles;
+			handles.reserve(_handles.size());
+			for (auto& entry : _handles)
+			{
+				handles.push_back(entry.second);
+			}
+			for (AssetHandle handle : handles)
+			{
+				while (IsValid(handle)) { Release(handle); }
+			}
+		}
+
+		// find existing asset handle
+		AssetHandle AssetsRegistry::Find(const IAsset* asset) const
+		{
+			auto existing = _handles.find(asset);
+			return existing != _handles.end() ? existing->second : InvalidAssetHandle;
+		}
+
+		// check if handle is valid
+		bool AssetsRegistry::IsValid(AssetHandle handle) const
+		{
+			return Resolve(handle) != nullptr;
+		}
+
+		// get untyped asset by handle
+		IAsset* AssetsRegistry::Resolve(AssetHandle handle) const
+		{
+			switch (Type(handle))
+			{
+			case AssetTypes::Image: return GetImage(handle).get();
+			case AssetTypes::Sound: return GetSound(handle).get();
+			case AssetTypes::Music: return GetMusic(handle).get();
+			case AssetTypes::Config: return GetConfig(handle).get();
+			case AssetTypes::Font: return GetFont(handle).get();
+			case AssetTypes::Effect: return GetEffect(handle).get();
+			default: return nullptr;
+			}
+		}
+
+		// get registered handles count
+		size_t AssetsRegistry::Count() const
+		{
+			return _handles.size();
+		}
+	}
+}
\ No newline at end of file
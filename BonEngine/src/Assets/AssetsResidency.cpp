@@ -0,0 +1,181 @@
+#include <Assets/AssetsResidency.h>
+#include <Assets/Types/IAsset.h>
+
+namespace bon
+{
+	namespace assets
+	{
+		// get from cache
+		AssetPtr AssetsResidency::Get(const char* key)
+		{
+			// not in cache?
+			auto found = _byKey.find(key);
+			if (found == _byKey.end()) { return nullptr; }
+			auto entry = found->second;
+
+			// weak entry? promote back to strong if asset is still alive
+			if (entry->Strong == nullptr)
+			{
+				AssetPtr alive = entry->Weak.lock();
+				if (alive == nullptr)
+				{
+					Erase(entry);
+					return nullptr;
+				}
+				AssetsCacheStats& stats = _stats[(int)entry->Type];
+				stats.WeakAssets--;
+				stats.CachedAssets++;
+				stats.RamBytes += entry->RamBytes;
+				stats.VramBytes += entry->VramBytes;
+				entry->Strong = alive;
+			}
+
+			// mark as recently used
+			_entries.splice(_entries.begin(), _entries, entry);
+			return entry->Strong;
+		}
+
+		// put in cache
+		void AssetsResidency::Put(const AssetPtr& asset, const char* key)
+		{
+			// replace previous entry with same key or asset
+			auto sameKey = _byKey.find(key);
+			if (sameKey != _byKey.end()) { Erase(sameKey->second); }
+			auto sameAsset = _byAsset.find(asset.get());
+			if (sameAsset != _byAsset.end()) { Erase(sameAsset->second); }
+
+			// add entry as most recently used
+			Entry entry;
+			entry.Key = key;
+			entry.Type = asset->AssetType();
+			entry.Strong = asset;
+			entry.Weak = asset;
+			entry.Asset = asset.get();
+			entry.RamBytes = asset->MemoryUsage(false);
+			entry.VramBytes = asset->MemoryUsage(true);
+			_entries.push_front(std::move(entry));
+			_byKey[key] = _entries.begin();
+			_byAsset[asset.get()] = _entries.begin();
+
+			// update stats
+			AssetsCacheStats& stats = _stats[(int)_entries.front().Type];
+			stats.CachedAssets++;
+			stats.RamBytes += _entries.front().RamBytes;
+			stats.VramBytes += _entries.front().VramBytes;
+		}
+
+		// remove disposed asset
+		bool AssetsResidency::Remove(const IAsset* asset)
+		{
+			auto found = _byAsset.find(asset);
+			if (found == _byAsset.end()) { return false; }
+			bool wasStrong = found->second->Strong != nullptr;
+			Erase(found->second);
+			return wasStrong;
+		}
+
+		// evict assets to stay within budgets
+		void AssetsResidency::Evict(std::vector<AssetPtr>& outReleased)
+		{
+			// make sure budgets are checked against current memory usage
+			RefreshMemoryUsage();
+
+			// check which types are over budget
+			bool anyOverBudget = false;
+			bool overBudget[(int)AssetTypes::_Count];
+			for (int i = 0; i < (int)AssetTypes::_Count; ++i)
+			{
+				overBudget[i] = OverBudget((AssetTypes)i);
+				anyOverBudget |= overBudget[i];
+			}
+			if (!anyOverBudget) { return; }
+
+			// go from least recently used, and evict assets only the cache holds
+			for (auto it = _entries.end(); it != _entries.begin();)
+			{
+				--it;
+				int type = (int)it->Type;
+				if (!overBudget[type] || it->Strong == nullptr || it->Strong.use_count() > 1) { continue; }
+
+				// evict (asset will be disposed once caller releases it, so drop the entry too)
+				Demote(*it, outReleased);
+				_stats[type].Evictions++;
+				it = Erase(it);
+				overBudget[type] = OverBudget((AssetTypes)type);
+			}
+		}
+
+		// release all strong references
+		void AssetsResidency::Clear(std::vector<AssetPtr>& outReleased)
+		{
+			for (auto& entry : _entries)
+			{
+				if (entry.Strong != nullptr)
+				{
+					Demote(entry, outReleased);
+				}
+			}
+		}
+
+		// set type budgets
+		void AssetsResidency::SetBudget(AssetTypes type, size_t ramBytes, size_t vramBytes)
+		{
+			_stats[(int)type].RamBudget = ramBytes;
+			_stats[(int)type].VramBudget = vramBytes;
+		}
+
+		// refresh entries memory usage
+		void AssetsResidency::RefreshMemoryUsage()
+		{
+			for (auto& entry : _entries)
+			{
+				if (entry.Strong == nullptr) { continue; }
+				size_t ramBytes = entry.Strong->MemoryUsage(false);
+				size_t vramBytes = entry.Strong->MemoryUsage(true);
+				AssetsCacheStats& stats = _stats[(int)entry.Type];
+				stats.RamBytes = stats.RamBytes - entry.RamBytes + ramBytes;
+				stats.VramBytes = stats.VramBytes - entry.VramBytes + vramBytes;
+				entry.RamBytes = ramBytes;
+				entry.VramBytes = vramBytes;
+			}
+		}
+
+		// check if type is over budget
+		bool AssetsResidency::OverBudget(AssetTypes type) const
+		{
+			const AssetsCacheStats& stats = _stats[(int)type];
+			return (stats.RamBudget > 0 && stats.RamBytes > stats.RamBudget) || (stats.VramBudget > 0 && stats.VramBytes > stats.VramBudget);
+		}
+
+		// turn entry weak
+		void AssetsResidency::Demote(Entry& entry, std::vector<AssetPtr>& outReleased)
+		{
+			AssetsCacheStats& stats = _stats[(int)entry.Type];
+			stats.CachedAssets--;
+			stats.WeakAssets++;
+			stats.RamBytes -= entry.RamBytes;
+			stats.VramBytes -= entry.VramBytes;
+			outReleased.push_back(std::move(entry.Strong));
+			entry.Strong = nullptr;
+		}
+
+		// remove entry
+		std::list<AssetsResidency::Entry>::iterator AssetsResidency::Erase(std::list<Entry>::iterator entry)
+		{
+			AssetsCacheStats& stats = _stats[(int)entry->Type];
+			if (entry->Strong != nullptr)
+			{
+				stats.CachedAssets--;
+				stats.RamBytes -= entry->RamBytes;
+				stats.VramBytes -= entry->VramBytes;
+			}
+			else
+			{
+				stats.WeakAssets--;
+			}
+			_byKey.erase(entry->Key);
+			_byAsset.erase(entry->Asset);
+			return _entries.erase(entry);
+		}
+	}
+}
\ No newline at end of file
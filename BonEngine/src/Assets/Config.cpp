@@ -38,9 +38,67 @@ namespace bon
 			outList.push_back(s.substr(last));
 		}
 
+		// parse color from string in format of "r,g,b,a"
+		framework::Color ParseColorStr(const char* str)
+		{
+			std::list<std::string> parts;
+			SplitString(str, ',', parts);
+			Color ret;
+			auto iter = parts.begin();
+			ret.R = (float)std::stoi(*iter) / 255.0f; iter++;
+			ret.G = (float)std::stoi(*iter) / 255.0f; iter++;
+			ret.B = (float)std::stoi(*iter) / 255.0f; iter++;
+			if (iter != parts.end()) { ret.A = (float)std::stoi(*iter) / 255.0f; }
+			return ret;
+		}
+
+		// parse rectangle from string in format of "x,y,w,h"
+		framework::RectangleF ParseRectangleStr(const char* str)
+		{
+			std::list<std::string> parts;
+			SplitString(str, ',', parts);
+			framework::RectangleF ret;
+			auto iter = parts.begin();
+			ret.X = (float)std::stoi(*iter); iter++;
+			ret.Y = (float)std::stoi(*iter); iter++;
+			ret.Width = (float)std::stoi(*iter); iter++;
+			ret.Height = (float)std::stoi(*iter); 
+			return ret;
+		}
+
+		// get point from compiled value
+		framework::PointF CompiledPointF(const ConfigValue* value, const framework::PointF& defaultVal)
+		{
+			if (value == nullptr) { return defaultVal; }
+			if (value->Is(ConfigValuePoint)) { return value->Point; }
+
+			// invalid format - parse string to raise the same error as reading by name
+			PointF ret;
+			SplitPointStr(value->Str, ret.X, ret.Y);
+			return ret;
+		}
+
+		// get color from compiled value
+		framework::Color CompiledColor(const ConfigValue* value, const framework::Color& defaultVal)
+		{
+			if (value == nullptr) { return defaultVal; }
+			return value->Is(ConfigValueColor) ? value->Color : ParseColorStr(value->Str.c_str());
+		}
+
+		// get rectangle from compiled value
+		framework::RectangleF CompiledRectangleF(const ConfigValue* value, const framework::RectangleF& defaultVal)
+		{
+			if (value == nullptr) { return defaultVal; }
+			return value->Is(ConfigValueRect) ? value->Rect : ParseRectangleStr(value->Str.c_str());
+		}
+
 		// get pointf from config
 		framework::PointF _Config::GetPointF(const char* section, const char* name, const framework::PointF& defaultVal) const
 		{
+			// use compiled value if possible
+			if (Handle()->HaveCompiledValues()) { return CompiledPointF(Handle()->GetValue(section, name), defaultVal); }
+
+			// parse from string
 			PointF ret;
 			const char* asStr = GetStr(section, name, nullptr);
 			if (asStr == nullptr) { return defaultVal; }
@@ -51,39 +109,78 @@ namespace bon
 		// get color from config
 		framework::Color _Config::GetColor(const char* section, const char* name, const framework::Color& defaultVal) const
 		{
+			// use compiled value if possible
+			if (Handle()->HaveCompiledValues()) { return CompiledColor(Handle()->GetValue(section, name), defaultVal); }
+
 			// get string and return default if not set
 			const char* asStr = GetStr(section, name, nullptr);
 			if (asStr == nullptr) { return defaultVal; }
-
-			// break and parse
-			std::list<std::string> parts;
-			SplitString(asStr, ',', parts);
-			Color ret;
-			auto iter = parts.begin();
-			ret.R = (float)std::stoi(*iter) / 255.0f; iter++;
-			ret.G = (float)std::stoi(*iter) / 255.0f; iter++;
-			ret.B = (float)std::stoi(*iter) / 255.0f; iter++;
-			if (iter != parts.end()) { ret.A = (float)std::stoi(*iter) / 255.0f; }
-			return ret;
+			return ParseColorStr(asStr);
 		}
 
 		// get rect from config
 		framework::RectangleF _Config::GetRectangleF(const char* section, const char* name, const framework::RectangleF& defaultVal) const
 		{
+			// use compiled value if possible
+			if (Handle()->HaveCompiledValues()) { return CompiledRectangleF(Handle()->GetValue(section, name), defaultVal); }
+
 			// get string and return default if not set
 			const char* asStr = GetStr(section, name, nullptr);
 			if (asStr == nullptr) { return defaultVal; }
+			return ParseRectangleStr(asStr);
+		}
 
-			// break and parse
-			std::list<std::string> parts;
-			SplitString(asStr, ',', parts);
-			framework::RectangleF ret;
-			auto iter = parts.begin();
-			ret.X = (float)std::stoi(*iter); iter++;
-			ret.Y = (float)std::stoi(*iter); iter++;
-			ret.Width = (float)std::stoi(*iter); iter++;
-			ret.Height = (float)std::stoi(*iter); 
-			return ret;
+		// get string by key handle
+		const char* _Config::GetStr(ConfigKey key, const char* defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetStr(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			const ConfigValue* value = Handle()->GetValue(key);
+			return value ? value->Str.c_str() : defaultVal;
+		}
+
+		// get bool by key handle
+		bool _Config::GetBool(ConfigKey key, bool defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetBool(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			const ConfigValue* value = Handle()->GetValue(key);
+			return (value && value->Is(ConfigValueBool)) ? value->Bool : defaultVal;
+		}
+
+		// get int by key handle
+		long _Config::GetInt(ConfigKey key, int defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetInt(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			const ConfigValue* value = Handle()->GetValue(key);
+			return (value && value->Is(ConfigValueInt)) ? value->Int : defaultVal;
+		}
+
+		// get float by key handle
+		float _Config::GetFloat(ConfigKey key, float defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetFloat(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			const ConfigValue* value = Handle()->GetValue(key);
+			return (value && value->Is(ConfigValueFloat)) ? value->Float : defaultVal;
+		}
+
+		// get point by key handle
+		framework::PointF _Config::GetPointF(ConfigKey key, const framework::PointF& defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetPointF(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			return CompiledPointF(Handle()->GetValue(key), defaultVal);
+		}
+
+		// get color by key handle
+		framework::Color _Config::GetColor(ConfigKey key, const framework::Color& defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetColor(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			return CompiledColor(Handle()->GetValue(key), defaultVal);
+		}
+
+		// get rectangle by key handle
+		framework::RectangleF _Config::GetRectangleF(ConfigKey key, const framework::RectangleF& defaultVal) const
+		{
+			if (!Handle()->HaveCompiledValues()) { return GetRectangleF(ConfigKeys::Section(key), ConfigKeys::Name(key), defaultVal); }
+			return CompiledRectangleF(Handle()->GetValue(key), defaultVal);
 		}
 
 		// get option index from config
@@ -0,0 +1,482 @@
+#include <Assets/ConfigTable.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <deque>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+
+namespace fs = std::filesystem;
+
+namespace bon
+{
+	namespace assets
+	{
+		// magic value for compiled config files ('BCFG') and current version
+		const uint32_t _compiledConfigMagic = 0x47464342;
+		const uint32_t _compiledConfigVersion = 1;
+
+		/**
+		 * Interned config keys storage.
+		 */
+		struct ConfigKeysStorage
+		{
+			// protect storage (shared for lookups, exclusive when adding keys)
+			std::shared_mutex Mutex;
+
+			// key handle by lower case "section=name"
+			std::unordered_map<std::string, ConfigKey> Handles;
+
+			// lower case section and name by key handle - 1
+			std::deque<std::pair<std::string, std::string>> Names;
+		};
+
+		/**
+		 * Get keys storage (created on first use, so it's ready for configs loaded during static init).
+		 */
+		ConfigKeysStorage& configKeysStorage()
+		{
+			static ConfigKeysStorage storage;
+			return storage;
+		}
+
+		/**
+		 * Build lower case "section=name" lookup key, reusing a per-thread buffer.
+		 */
+		const std::string& makeConfigLookupKey(const char* section, const char* name)
+		{
+			thread_local std::string key;
+			key.assign(section);
+			key += '=';
+			key += name;
+			std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+			return key;
+		}
+
+		// get or create key handle
+		ConfigKey ConfigKeys::Get(const char* section, const char* name)
+		{
+			const std::string& lookup = makeConfigLookupKey(section, name);
+			ConfigKeysStorage& storage = configKeysStorage();
+			{
+				std::shared_lock<std::shared_mutex> lock(storage.Mutex);
+				auto found = storage.Handles.find(lookup);
+				if (found != storage.Handles.end()) { return found->second; }
+			}
+
+			// create new handle (unless another thread just did)
+			std::unique_lock<std::shared_mutex> lock(storage.Mutex);
+			auto found = storage.Handles.find(lookup);
+			if (found != storage.Handles.end()) { return found->second; }
+			size_t separator = strlen(section);
+			storage.Names.emplace_back(lookup.substr(0, separator), lookup.substr(separator + 1));
+			ConfigKey ret = (ConfigKey)storage.Names.size();
+			storage.Handles[lookup] = ret;
+			return ret;
+		}
+
+		// find existing key handle
+		ConfigKey ConfigKeys::Find(const char* section, const char* name)
+		{
+			const std::string& lookup = makeConfigLookupKey(section, name);
+			ConfigKeysStorage& storage = configKeysStorage();
+			std::shared_lock<std::shared_mutex> lock(storage.Mutex);
+			auto found = storage.Handles.find(lookup);
+			return found != storage.Handles.end() ? found->second : InvalidConfigKey;
+		}
+
+		// get key section name
+		const char* ConfigKeys::Section(ConfigKey key)
+		{
+			ConfigKeysStorage& storage = configKeysStorage();
+			std::shared_lock<std::shared_mutex> lock(storage.Mutex);
+			return (key > 0 && key <= storage.Names.size()) ? storage.Names[key - 1].first.c_str() : "";
+		}
+
+		// get key name
+		const char* ConfigKeys::Name(ConfigKey key)
+		{
+			ConfigKeysStorage& storage = configKeysStorage();
+			std::shared_lock<std::shared_mutex> lock(storage.Mutex);
+			return (key > 0 && key <= storage.Names.size()) ? storage.Names[key - 1].second.c_str() : "";
+		}
+
+		/**
+		 * Parse int from the beginning of a string, like std::stoi (skips leading spaces and stops at first invalid char).
+		 * Returns false if there's no number or it's out of range.
+		 */
+		bool parseConfigInt(const char* str, int& out)
+		{
+			char* end;
+			errno = 0;
+			long ret = strtol(str, &end, 10);
+			if (end == str || errno == ERANGE || ret < INT_MIN || ret > INT_MAX) { return false; }
+			out = (int)ret;
+			return true;
+		}
+
+		/**
+		 * Parse float from the beginning of a string, like std::stof.
+		 * Returns false if there's no number or it's out of range.
+		 */
+		bool parseConfigFloat(const char* str, float& out)
+		{
+			char* end;
+			errno = 0;
+			float ret = strtof(str, &end);
+			if (end == str || errno == ERANGE) { return false; }
+			out = ret;
+			return true;
+		}
+
+		// parse value into all types it can be
+		void ConfigValue::Parse(const char* value)
+		{
+			Str = value;
+			Types = 0;
+			char* end;
+
+			// int (decimal or hex), float and bool, same as ini reader
+			long asInt = strtol(value, &end, 0);
+			if (end > value) { Int = asInt; Types |= ConfigValueInt; }
+			float asFloat = strtof(value, &end);
+			if (end > value) { Float = asFloat; Types |= ConfigValueFloat; }
+			std::string lower = Str;
+			std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+			if (lower == "true" || lower == "yes" || lower == "on" || lower == "1") { Bool = true; Types |= ConfigValueBool; }
+			else if (lower == "false" || lower == "no" || lower == "off" || lower == "0") { Bool = false; Types |= ConfigValueBool; }
+
+			// find where every comma separated part starts (we only need the first 4)
+			const char* parts[4] = { value };
+			int partsCount = 1;
+			for (const char* c = value; *c; ++c)
+			{
+				if (*c == ',')
+				{
+					if (partsCount < 4) { parts[partsCount] = c + 1; }
+					partsCount++;
+				}
+			}
+
+			// point ("x,y"). like reading by name, a single value is used for both
+			framework::PointF point;
+			if (parseConfigFloat(parts[0], point.X) && parseConfigFloat(partsCount > 1 ? parts[1] : parts[0], point.Y))
+			{
+				Point = point;
+				Types |= ConfigValuePoint;
+			}
+
+			// color ("r,g,b,a" or "r,g,b", values range from 0 to 255)
+			int color[4] = { 0, 0, 0, 255 };
+			if (partsCount >= 3 && parseConfigInt(parts[0], color[0]) && parseConfigInt(parts[1], color[1]) && parseConfigInt(parts[2], color[2]) &&
+				(partsCount < 4 || parseConfigInt(parts[3], color[3])))
+			{
+				Color = framework::Color((float)color[0] / 255.0f, (float)color[1] / 255.0f, (float)color[2] / 255.0f, (float)color[3] / 255.0f);
+				Types |= ConfigValueColor;
+			}
+
+			// rectangle ("x,y,w,h")
+			int rect[4];
+			if (partsCount >= 4 && parseConfigInt(parts[0], rect[0]) && parseConfigInt(parts[1], rect[1]) && parseConfigInt(parts[2], rect[2]) && parseConfigInt(parts[3], rect[3]))
+			{
+				Rect = framework::RectangleF((float)rect[0], (float)rect[1], (float)rect[2], (float)rect[3]);
+				Types |= ConfigValueRect;
+			}
+		}
+
+		/**
+		 * Hash section and key names, case insensitive (FNV-1a over lower case "section=name").
+		 */
+		uint64_t configNameHash(const char* section, const char* name)
+		{
+			uint64_t hash = 14695981039346656037ULL;
+			auto add = [&hash](unsigned char c)
+			{
+				hash ^= (unsigned char)tolower(c);
+				hash *= 1099511628211ULL;
+			};
+			for (const char* c = section; *c; ++c) { add((unsigned char)*c); }
+			add('=');
+			for (const char* c = name; *c; ++c) { add((unsigned char)*c); }
+			return hash;
+		}
+
+		/**
+		 * Compare strings, case insensitive.
+		 */
+		bool configNameEquals(const std::string& a, const char* b)
+		{
+			size_t i = 0;
+			for (; i < a.length() && b[i]; ++i)
+			{
+				if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) { return false; }
+			}
+			return i == a.length() && b[i] == '\0';
+		}
+
+		// add entry to index by name
+		void ConfigTable::IndexName(size_t index)
+		{
+			// on hash collision keep the first entry, other entries are found by key handle
+			_nameIndex.emplace(configNameHash(_entries[index].Section.c_str(), _entries[index].Name.c_str()), index);
+		}
+
+		// get value by section and key names
+		const ConfigValue* ConfigTable::Find(const char* section, const char* name) const
+		{
+			auto found = _nameIndex.find(configNameHash(section, name));
+			if (found == _nameIndex.end()) { return nullptr; }
+			const Entry& entry = _entries[found->second];
+			if (configNameEquals(entry.Section, section) && configNameEquals(entry.Name, name)) { return &entry.Value; }
+
+			// hash collision - get by key handle
+			return Get(ConfigKeys::Find(section, name));
+		}
+
+		// set value
+		void ConfigTable::Set(const char* section, const char* name, const char* value)
+		{
+			ConfigKey key = ConfigKeys::Get(section, name);
+			auto found = _index.find(key);
+			if (found != _index.end())
+			{
+				_entries[found->second].Value.Parse(value);
+				return;
+			}
+			Entry entry;
+			entry.Section = section;
+			entry.Name = name;
+			entry.Key = key;
+			entry.Value.Parse(value);
+			_index[key] = _entries.size();
+			_entries.push_back(std::move(entry));
+			IndexName(_entries.size() - 1);
+		}
+
+		// remove value
+		void ConfigTable::Remove(const char* section, const char* name)
+		{
+			// find entry
+			auto found = _index.find(ConfigKeys::Find(section, name));
+			if (found == _index.end()) { return; }
+
+			// move last entry into removed entry place
+			size_t index = found->second;
+			_index.erase(found);
+			uint64_t nameHash = configNameHash(_entries[index].Section.c_str(), _entries[index].Name.c_str());
+			auto foundName = _nameIndex.find(nameHash);
+			bool removedName = foundName != _nameIndex.end() && foundName->second == index;
+			if (removedName) { _nameIndex.erase(foundName); }
+			size_t last = _entries.size() - 1;
+			if (index != last)
+			{
+				auto lastName = _nameIndex.find(configNameHash(_entries[last].Section.c_str(), _entries[last].Name.c_str()));
+				if (lastName != _nameIndex.end() && lastName->second == last) { lastName->second = index; }
+				_entries[index] = std::move(_entries.back());
+				_index[_entries[index].Key] = index;
+			}
+			_entries.pop_back();
+
+			// removed entry had a hash collision with other entries? index one of them by name instead
+			if (removedName)
+			{
+				for (size_t i = 0; i < _entries.size(); ++i)
+				{
+					if (configNameHash(_entries[i].Section.c_str(), _entries[i].Name.c_str()) == nameHash) { IndexName(i); break; }
+				}
+			}
+		}
+
+		// clear table
+		void ConfigTable::Clear()
+		{
+			_entries.clear();
+			_index.clear();
+			_nameIndex.clear();
+		}
+
+		/**
+		 * Hash string with FNV-1a.
+		 */
+		inline uint64_t compiledConfigHash(const std::string& str)
+		{
+			uint64_t hash = 14695981039346656037ULL;
+			for (char c : str)
+			{
+				hash ^= (unsigned char)c;
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		/**
+		 * Get compiled config file path from source path.
+		 */
+		std::string compiledConfigPath(const char* path)
+		{
+			std::string key(path);
+			std::replace(key.begin(), key.end(), '\\', '/');
+			char filename[32];
+			snprintf(filename, sizeof(filename), "%016llx.bcf", (unsigned long long)compiledConfigHash(key));
+			return fs::path(bon::Features().CompiledConfigFolder).append(filename).u8string();
+		}
+
+		/**
+		 * Get source file size and modification time.
+		 */
+		bool compiledConfigSourceInfo(const char* path, uint64_t& size, int64_t& mtime)
+		{
+			std::error_code err;
+			size = (uint64_t)fs::file_size(path, err);
+			if (err) { return false; }
+			auto time = fs::last_write_time(path, err);
+			if (err) { return false; }
+			mtime = (int64_t)time.time_since_epoch().count();
+			return true;
+		}
+
+		// check if compiled configs are enabled
+		bool ConfigTable::IsCompiledEnabled()
+		{
+			const char* folder = bon::Features().CompiledConfigFolder;
+			return folder != nullptr && folder[0] != '\0';
+		}
+
+		// load compiled table
+		bool ConfigTable::LoadCompiled(const char* path)
+		{
+			// get source info
+			uint64_t sourceSize;
+			int64_t sourceMTime;
+			if (!compiledConfigSourceInfo(path, sourceSize, sourceMTime)) { return false; }
+
+			// read compiled file
+			std::ifstream file(compiledConfigPath(path), std::ios::in | std::ios::binary);
+			if (!file.good()) { return false; }
+			std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			size_t offset = 0;
+			auto read = [&data, &offset](void* dest, size_t size)
+			{
+				if (offset + size > data.size()) { return false; }
+				memcpy(dest, data.data() + offset, size);
+				offset += size;
+				return true;
+			};
+			auto readString = [&data, &offset, &read](std::string& dest)
+			{
+				uint32_t length;
+				if (!read(&length, sizeof(length)) || offset + length > data.size()) { return false; }
+				dest.assign(data.data() + offset, length);
+				offset += length;
+				return true;
+			};
+
+			// validate header
+			uint32_t magic, version, count;
+			uint64_t size;
+			int64_t mtime;
+			if (!read(&magic, sizeof(magic)) || !read(&version, sizeof(version)) || !read(&size, sizeof(size)) || !read(&mtime, sizeof(mtime)) || !read(&count, sizeof(count)))
+			{
+				return false;
+			}
+			if (magic != _compiledConfigMagic || version != _compiledConfigVersion || size != sourceSize || mtime != sourceMTime)
+			{
+				BON_DLOG("Compiled config for '%s' is outdated.", path);
+				return false;
+			}
+
+			// read entries
+			std::vector<Entry> entries(count);
+			for (Entry& entry : entries)
+			{
+				int64_t asInt;
+				uint8_t asBool;
+				ConfigValue& value = entry.Value;
+				if (!readString(entry.Section) || !readString(entry.Name) || !readString(value.Str) ||
+					!read(&value.Types, sizeof(value.Types)) || !read(&asInt, sizeof(asInt)) || !read(&value.Float, sizeof(value.Float)) || !read(&asBool, sizeof(asBool)) ||
+					!read(&value.Point.X, sizeof(float)) || !read(&value.Point.Y, sizeof(float)) ||
+					!read(&value.Color.R, sizeof(float)) || !read(&value.Color.G, sizeof(float)) || !read(&value.Color.B, sizeof(float)) || !read(&value.Color.A, sizeof(float)) ||
+					!read(&value.Rect.X, sizeof(float)) || !read(&value.Rect.Y, sizeof(float)) || !read(&value.Rect.Width, sizeof(float)) || !read(&value.Rect.Height, sizeof(float)))
+				{
+					BON_WLOG("Compiled config for '%s' is corrupted.", path);
+					return false;
+				}
+				value.Int = (long)asInt;
+				value.Bool = asBool != 0;
+			}
+
+			// intern keys and build table
+			Clear();
+			_entries = std::move(entries);
+			for (size_t i = 0; i < _entries.size(); ++i)
+			{
+				_entries[i].Key = ConfigKeys::Get(_entries[i].Section.c_str(), _entries[i].Name.c_str());
+				_index[_entries[i].Key] = i;
+				IndexName(i);
+			}
+			BON_DLOG("Loaded compiled config: %s.", path);
+			return true;
+		}
+
+		// save compiled table
+		void ConfigTable::SaveCompiled(const char* path) const
+		{
+			// get source info
+			uint64_t sourceSize;
+			int64_t sourceMTime;
+			if (!compiledConfigSourceInfo(path, sourceSize, sourceMTime)) { return; }
+
+			// build file data
+			std::vector<char> data;
+			auto write = [&data](const void* src, size_t size)
+			{
+				data.insert(data.end(), (const char*)src, (const char*)src + size);
+			};
+			auto writeString = [&write](const std::string& str)
+			{
+				uint32_t length = (uint32_t)str.length();
+				write(&length, sizeof(length));
+				write(str.data(), length);
+			};
+			uint32_t count = (uint32_t)_entries.size();
+			write(&_compiledConfigMagic, sizeof(_compiledConfigMagic));
+			write(&_compiledConfigVersion, sizeof(_compiledConfigVersion));
+			write(&sourceSize, sizeof(sourceSize));
+			write(&sourceMTime, sizeof(sourceMTime));
+			write(&count, sizeof(count));
+			for (const Entry& entry : _entries)
+			{
+				const ConfigValue& value = entry.Value;
+				int64_t asInt = value.Int;
+				uint8_t asBool = value.Bool ? 1 : 0;
+				writeString(entry.Section);
+				writeString(entry.Name);
+				writeString(value.Str);
+				write(&value.Types, sizeof(value.Types));
+				write(&asInt, sizeof(asInt));
+				write(&value.Float, sizeof(value.Float));
+				write(&asBool, sizeof(asBool));
+				float floats[] = { value.Point.X, value.Point.Y, value.Color.R, value.Color.G, value.Color.B, value.Color.A, value.Rect.X, value.Rect.Y, value.Rect.Width, value.Rect.Height };
+				write(floats, sizeof(floats));
+			}
+
+			// write to file
+			std::error_code err;
+			fs::create_directories(bon::Features().CompiledConfigFolder, err);
+			std::ofstream file(compiledConfigPath(path), std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!file.good())
+			{
+				BON_WLOG("Failed to write compiled config for '%s'.", path);
+				return;
+			}
+			file.write(data.data(), data.size());
+		}
+	}
+}
\ No newline at end of file
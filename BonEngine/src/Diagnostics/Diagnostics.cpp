@@ -13,6 +13,9 @@ namespace bon
 			// reset counters
 			ResetCounter(DiagnosticsCounters::DrawCalls);
 			ResetCounter(DiagnosticsCounters::PlaySoundCalls);
+			ResetCounter(DiagnosticsCounters::StolenVoices);
+			ResetCounter(DiagnosticsCounters::ClippedUIElements);
+			ResetCounter(DiagnosticsCounters::CulledUIElements);
 
 			// to count seconds
 			static double secondsCount = 0.0;
@@ -44,5 +47,11 @@ namespace bon
 		{
 			_counters[counterId] = 0;
 		}
+
+		// get histogram
+		DiagnosticsHistogram& Diagnostics::_GetHistogram(int histogramId)
+		{
+			return _histograms[histogramId];
+		}
 	}
 }
\ No newline at end of file
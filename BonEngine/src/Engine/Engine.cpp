@@ -11,6 +11,7 @@
 #include <Engine/Scene.h>
 #include <BonEngine.h>
 #include <Engine/SignalHandler.h>
+#include <Engine/InputRecorder.h>
 
 #pragma warning(push, 0)
 #include <SDL2-2.0.12/include/SDL.h>
@@ -198,6 +199,15 @@ namespace bon
 			}
 			_logManager->Write(log::LogLevel::Info, "All managers ready, game loop starting..");
 
+			// start recording or replaying input
+			if (bon::Features().InputReplayPath) {
+				_inputRecorder = new InputRecorder();
+				_inputRecorder->StartReplay(bon::Features().InputReplayPath, bon::Features().InputReplayTimestep, bon::Features().InputReplayReportPath);
+			}
+			else if (bon::Features().InputRecordPath) {
+				StartInputRecording(bon::Features().InputRecordPath);
+			}
+
 			// call active scene's start
 			_mainLoopStarted = true;
 			if (_activeScene) {
@@ -236,6 +246,13 @@ namespace bon
 					NOW = SDL_GetPerformanceCounter();
 					deltaTime = ((double)((NOW - LAST) * 1000 / (double)SDL_GetPerformanceFrequency())) / 1000.0;
 
+					// record frame delta time, or replace it with recorded delta time when replaying
+					if (_inputRecorder && !_inputRecorder->BeginFrame(deltaTime)) {
+						_logManager->Write(log::LogLevel::Info, "Input replay ended, stop engine.");
+						_isRunning = false;
+						break;
+					}
+
 					// update all managers
 					_state = EngineStates::InternalUpdate;
 					for (size_t i = 0; i < _managers.size(); ++i) {
@@ -245,6 +262,7 @@ namespace bon
 
 					// handle events on queue
 					_state = EngineStates::HandleEvents;
+					bool replayingInput = _inputRecorder && _inputRecorder->IsReplaying();
 					while (SDL_PollEvent(&e) != 0)
 					{
 						// user requests quit
@@ -254,11 +272,34 @@ namespace bon
 							break;
 						}
 
+						// ignore live input while replaying
+						if (replayingInput) {
+							continue;
+						}
+
+						// record event
+						if (_inputRecorder) {
+							_inputRecorder->RecordEvent(e);
+						}
+
 						// send event to all managers
 						for (size_t i = 0; i < _managers.size(); ++i) {
 							(_managers)[i]->_HandleEvent(e);
 						}
 					}
+
+					// send replayed events to all managers
+					while (replayingInput && _inputRecorder->NextEvent(e))
+					{
+						for (size_t i = 0; i < _managers.size(); ++i) {
+							(_managers)[i]->_HandleEvent(e);
+						}
+					}
+
+					// end input recording frame
+					if (_inputRecorder) {
+						_inputRecorder->EndFrame();
+					}
 					_state = EngineStates::MainLoopInBetweens;
 
 					// update scene
@@ -332,6 +373,12 @@ namespace bon
 			_logManager->Write(log::LogLevel::Info, "Cleanup called.");
 			_destroyed = true;
 
+			// finish recording or replaying input
+			if (_inputRecorder) {
+				delete _inputRecorder;
+				_inputRecorder = nullptr;
+			}
+
 			// dispose active scene
 			if (_activeScene) {
 				_activeScene->_Unload();
@@ -347,6 +394,36 @@ namespace bon
 			_state = EngineStates::Destroyed;
 		}
 
+		// start recording input
+		void Engine::StartInputRecording(const char* path)
+		{
+			if (IsReplayingInput()) { throw InvalidState("Cannot record input while replaying input!"); }
+			if (!_inputRecorder) {
+				_inputRecorder = new InputRecorder();
+			}
+			_inputRecorder->StartRecording(path);
+		}
+
+		// stop recording input
+		void Engine::StopInputRecording()
+		{
+			if (IsRecordingInput()) {
+				_inputRecorder->Stop();
+			}
+		}
+
+		// get if recording input
+		bool Engine::IsRecordingInput() const
+		{
+			return _inputRecorder && _inputRecorder->IsRecording();
+		}
+
+		// get if replaying input
+		bool Engine::IsReplayingInput() const
+		{
+			return _inputRecorder && _inputRecorder->IsReplaying();
+		}
+
 		// stop running
 		void Engine::Stop()
 		{
@@ -0,0 +1,254 @@
+#include <Engine/InputRecorder.h>
+#include <Framework/Exceptions.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <cstring>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+namespace bon
+{
+	namespace engine
+	{
+		/**
+		 * Recording file header.
+		 */
+		struct InputRecordingHeader
+		{
+			// magic value + version
+			uint32_t Magic;
+			uint32_t Version;
+		};
+
+		/**
+		 * Recorded frame header.
+		 */
+		struct InputFrameHeader
+		{
+			// frame delta time, in seconds
+			double DeltaTime;
+
+			// cursor position at frame start
+			int32_t CursorX;
+			int32_t CursorY;
+
+			// keyboard modifiers after handling frame events
+			uint16_t KeyModifiers;
+
+			// how many events come after this header
+			uint16_t EventsCount;
+
+			// unused, keeps header size aligned
+			uint32_t Reserved;
+		};
+		static_assert(sizeof(InputFrameHeader) == 24, "Input frame header must be 24 bytes, to match recording files.");
+
+		// magic value for recording files ('BINP') and current version
+		const uint32_t _inputRecordingMagic = 0x504E4942;
+		const uint32_t _inputRecordingVersion = 1;
+
+		// get how many bytes of an event we need to store, or 0 if event can't be recorded
+		uint16_t recordedEventSize(const SDL_Event& event)
+		{
+			switch (event.type)
+			{
+			case SDL_KEYDOWN:
+			case SDL_KEYUP:
+				return sizeof(SDL_KeyboardEvent);
+			case SDL_TEXTINPUT:
+				return sizeof(SDL_TextInputEvent);
+			case SDL_TEXTEDITING:
+				return sizeof(SDL_TextEditingEvent);
+			case SDL_MOUSEMOTION:
+				return sizeof(SDL_MouseMotionEvent);
+			case SDL_MOUSEBUTTONDOWN:
+			case SDL_MOUSEBUTTONUP:
+				return sizeof(SDL_MouseButtonEvent);
+			case SDL_MOUSEWHEEL:
+				return sizeof(SDL_MouseWheelEvent);
+			case SDL_WINDOWEVENT:
+				return sizeof(SDL_WindowEvent);
+
+			// events that point to memory we can't store
+			case SDL_SYSWMEVENT:
+			case SDL_DROPFILE:
+			case SDL_DROPTEXT:
+				return 0;
+			}
+			return (event.type >= SDL_USEREVENT) ? 0 : (uint16_t)sizeof(SDL_Event);
+		}
+
+		// stop on destruction
+		InputRecorder::~InputRecorder()
+		{
+			Stop();
+		}
+
+		// start recording
+		void InputRecorder::StartRecording(const char* path)
+		{
+			Stop();
+			_recordFile.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!_recordFile.good())
+			{
+				_recordFile.close();
+				throw framework::InvalidValue("Failed to open input recording file for writing!");
+			}
+			InputRecordingHeader header = { _inputRecordingMagic, _inputRecordingVersion };
+			_recordFile.write((const char*)&header, sizeof(header));
+			BON_ILOG("Start recording input to: %s", path);
+		}
+
+		// start replaying
+		void InputRecorder::StartReplay(const char* path, double timestep, const char* reportPath)
+		{
+			Stop();
+			_replayFile.open(path, std::ios::in | std::ios::binary);
+			InputRecordingHeader header;
+			if (!_replayFile.good() || !_replayFile.read((char*)&header, sizeof(header)) || header.Magic != _inputRecordingMagic || header.Version != _inputRecordingVersion)
+			{
+				_replayFile.close();
+				throw framework::InvalidValue("Missing or invalid input recording file to replay!");
+			}
+			_replayTimestep = timestep;
+			_reportPath = reportPath ? reportPath : "";
+			_frameTimes.clear();
+			_frameDeltas.clear();
+			_frameStartTime = 0;
+			BON_ILOG("Start replaying input from: %s", path);
+		}
+
+		// stop recording or replaying
+		void InputRecorder::Stop()
+		{
+			if (_recordFile.is_open())
+			{
+				_recordFile.close();
+				BON_ILOG("Stopped recording input.");
+			}
+			if (_replayFile.is_open())
+			{
+				_replayFile.close();
+				WriteReport();
+				BON_ILOG("Stopped replaying input after %d frames.", (int)_frameDeltas.size());
+			}
+		}
+
+		// start a new frame
+		bool InputRecorder::BeginFrame(double& deltaTime)
+		{
+			_events.clear();
+			_eventsCount = 0;
+			_eventsReadPos = 0;
+			_eventIndex = 0;
+
+			// recording - store delta and cursor position
+			if (IsRecording())
+			{
+				_deltaTime = deltaTime;
+				SDL_GetMouseState(&_cursorPosition.X, &_cursorPosition.Y);
+				return true;
+			}
+
+			// not replaying? nothing to do
+			if (!IsReplaying()) { return true; }
+
+			// measure previous frame time
+			uint64_t now = SDL_GetPerformanceCounter();
+			if (_frameStartTime != 0)
+			{
+				_frameTimes.push_back((double)(now - _frameStartTime) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+			}
+			_frameStartTime = now;
+
+			// read next frame
+			InputFrameHeader header;
+			if (!_replayFile.read((char*)&header, sizeof(header))) { return false; }
+			_deltaTime = header.DeltaTime;
+			_cursorPosition.Set(header.CursorX, header.CursorY);
+			_keyModifiers = header.KeyModifiers;
+			_eventsCount = header.EventsCount;
+			for (uint16_t i = 0; i < _eventsCount; ++i)
+			{
+				uint16_t size;
+				if (!_replayFile.read((char*)&size, sizeof(size)) || size > sizeof(SDL_Event)) { return false; }
+				size_t pos = _events.size();
+				_events.resize(pos + sizeof(size) + size);
+				memcpy(&_events[pos], &size, sizeof(size));
+				if (!_replayFile.read(&_events[pos + sizeof(size)], size)) { return false; }
+			}
+
+			// set delta time
+			deltaTime = (_replayTimestep > 0) ? _replayTimestep : _deltaTime;
+			_frameDeltas.push_back(deltaTime);
+			return true;
+		}
+
+		// record an event
+		void InputRecorder::RecordEvent(const SDL_Event& event)
+		{
+			if (!IsRecording()) { return; }
+			uint16_t size = recordedEventSize(event);
+			if (size == 0 || _eventsCount == UINT16_MAX) { return; }
+			size_t pos = _events.size();
+			_events.resize(pos + sizeof(size) + size);
+			memcpy(&_events[pos], &size, sizeof(size));
+			memcpy(&_events[pos + sizeof(size)], &event, size);
+			_eventsCount++;
+		}
+
+		// get next replayed event
+		bool InputRecorder::NextEvent(SDL_Event& event)
+		{
+			if (!IsReplaying() || _eventIndex >= _eventsCount) { return false; }
+
+			// set keyboard modifiers before first event, since managers read them while handling events
+			if (_eventIndex == 0) { SDL_SetModState((SDL_Keymod)_keyModifiers); }
+
+			// read event
+			uint16_t size;
+			memcpy(&size, &_events[_eventsReadPos], sizeof(size));
+			memset(&event, 0, sizeof(event));
+			memcpy(&event, &_events[_eventsReadPos + sizeof(size)], size);
+			_eventsReadPos += sizeof(size) + size;
+			_eventIndex++;
+			return true;
+		}
+
+		// end current frame
+		void InputRecorder::EndFrame()
+		{
+			if (!IsRecording()) { return; }
+
+			// write frame header and events
+			InputFrameHeader header;
+			header.DeltaTime = _deltaTime;
+			header.CursorX = _cursorPosition.X;
+			header.CursorY = _cursorPosition.Y;
+			header.KeyModifiers = (uint16_t)SDL_GetModState();
+			header.EventsCount = _eventsCount;
+			header.Reserved = 0;
+			_recordFile.write((const char*)&header, sizeof(header));
+			if (!_events.empty()) { _recordFile.write(_events.data(), _events.size()); }
+		}
+
+		// write replay frame times report
+		void InputRecorder::WriteReport()
+		{
+			if (_reportPath.empty()) { return; }
+			std::ofstream file(_reportPath, std::ios::out | std::ios::trunc);
+			if (!file.good())
+			{
+				BON_WLOG("Failed to write input replay report: %s", _reportPath.c_str());
+				return;
+			}
+			file << "frame,delta_time,frame_time_ms\n";
+			for (size_t i = 0; i < _frameTimes.size() && i < _frameDeltas.size(); ++i)
+			{
+				file << i << "," << _frameDeltas[i] << "," << _frameTimes[i] << "\n";
+			}
+		}
+	}
+}
@@ -115,22 +115,50 @@ namespace bon
 		class ConfigIniHandle : public _ConfigHandle
 		{
 		private:
-			INIReader _reader;
+			// ini reader, used to list sections and keys, modify and save config.
+			// when loaded from compiled config, reader is only filled when first needed.
+			mutable INIReader _reader;
+			mutable bool _readerReady;
+
+			// compiled values, used for all get methods
+			ConfigTable _table;
 		
 		public:
 
 			/**
 			 * Create the handle without reading config file (empty config).
 			 */
-			ConfigIniHandle() : _reader()
+			ConfigIniHandle() : _reader(), _readerReady(true)
 			{
 			}
 
 			/**
-			 * Create the handle from ini file.
+			 * Create the handle from ini file, or from its compiled version if valid.
 			 */
-			ConfigIniHandle(const char* path) : _reader(path)
+			ConfigIniHandle(const char* path) : _reader(), _readerReady(false)
 			{
+				// try to load compiled config
+				bool compiled = ConfigTable::IsCompiledEnabled();
+				if (compiled && _table.LoadCompiled(path))
+				{
+					return;
+				}
+
+				// parse ini file and compile it
+				_reader = INIReader(path);
+				_readerReady = true;
+				for (auto& section : _reader.Sections())
+				{
+					for (auto& key : _reader.Keys(section))
+					{
+						const char* value = _reader.GetRef(section, key, nullptr);
+						if (value) { _table.Set(section.c_str(), key.c_str(), value); }
+					}
+				}
+				if (compiled && IsValid())
+				{
+					_table.SaveCompiled(path);
+				}
 			}
 
 			/**
@@ -143,7 +171,8 @@ namespace bon
 			 */
 			virtual const char* GetStr(const char* section, const char* name, const char* defaultVal) const override 
 			{
-				return _reader.GetRef(string(section), string(name), defaultVal);
+				const ConfigValue* value = _table.Find(section, name);
+				return value ? value->Str.c_str() : defaultVal;
 			}
 
 			/**
@@ -151,7 +180,8 @@ namespace bon
 			 */
 			virtual bool GetBool(const char* section, const char* name, bool defaultVal) const override 
 			{
-				return _reader.GetBoolean(string(section), string(name), defaultVal);
+				const ConfigValue* value = _table.Find(section, name);
+				return (value && value->Is(ConfigValueBool)) ? value->Bool : defaultVal;
 			}
 
 			/**
@@ -159,7 +189,8 @@ namespace bon
 			 */
 			virtual long GetInt(const char* section, const char* name, int defaultVal) const override
 			{
-				return _reader.GetInteger(string(section), string(name), defaultVal);
+				const ConfigValue* value = _table.Find(section, name);
+				return (value && value->Is(ConfigValueInt)) ? value->Int : defaultVal;
 			}
 
 			/**
@@ -167,7 +198,29 @@ namespace bon
 			 */
 			virtual float GetFloat(const char* section, const char* name, float defaultVal) const override
 			{
-				return _reader.GetFloat(string(section), string(name), defaultVal);
+				const ConfigValue* value = _table.Find(section, name);
+				return (value && value->Is(ConfigValueFloat)) ? value->Float : defaultVal;
+			}
+
+			/**
+			 * We support compiled values.
+			 */
+			virtual bool HaveCompiledValues() const override { return true; }
+
+			/**
+			 * Get compiled value by key handle.
+			 */
+			virtual const ConfigValue* GetValue(ConfigKey key) const override
+			{
+				return _table.Get(key);
+			}
+
+			/**
+			 * Get compiled value by section and key names.
+			 */
+			virtual const ConfigValue* GetValue(const char* section, const char* name) const override
+			{
+				return _table.Find(section, name);
 			}
 
 			/**
@@ -175,6 +228,7 @@ namespace bon
 			 */
 			virtual const std::set<std::string>& Sections() const override
 			{
+				PrepareReader();
 				return _reader.Sections();
 			}
 
@@ -183,6 +237,7 @@ namespace bon
 			 */
 			virtual const std::set<std::string>& Keys(const char* section) const override
 			{
+				PrepareReader();
 				return _reader.Keys(section);
 			}
 
@@ -191,7 +246,9 @@ namespace bon
 			 */
 			virtual void UpdateValue(const char* section, const char* key, const char* value) override
 			{
+				PrepareReader();
 				_reader.SetValue(section, key, value, true);
+				_table.Set(section, key, value);
 			}
 
 			/**
@@ -199,7 +256,9 @@ namespace bon
 			 */
 			virtual void RemoveKey(const char* section, const char* key) override
 			{
+				PrepareReader();
 				_reader.RemoveKey(section, key);
+				_table.Remove(section, key);
 			}
 
 			/**
@@ -209,6 +268,7 @@ namespace bon
 			{
 				try
 				{
+					PrepareReader();
 					_reader.Save(filename);
 					return true;
 				}
@@ -217,6 +277,21 @@ namespace bon
 					return false;
 				}
 			}
+
+		private:
+
+			/**
+			 * Fill ini reader from compiled values, if config was loaded from compiled file.
+			 */
+			void PrepareReader() const
+			{
+				if (_readerReady) { return; }
+				for (auto& entry : _table.Entries())
+				{
+					_reader.SetValue(entry.Section, entry.Name, entry.Value.Str, true);
+				}
+				_readerReady = true;
+			}
 		};
 
 		// config loader we set in the assets manager during initialize
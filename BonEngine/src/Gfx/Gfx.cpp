@@ -18,6 +18,7 @@ namespace bon
 		// dispose gfx resources
 		void Gfx::_Dispose()
 		{
+			_Implementor.StopFrameCapture();
 		}
 
 		// do updates
@@ -38,6 +39,12 @@ namespace bon
 			{
 				SetWindowProperties("BonEngine Application", 800, 600, WindowModes::Windowed, true);
 			}
+
+			// start frames capture from config
+			if (bon::Features().FrameCaptureConfig)
+			{
+				StartFrameCapture(_GetEngine().Assets().LoadConfig(bon::Features().FrameCaptureConfig));
+			}
 		}
 
 		// draw image
@@ -88,6 +95,30 @@ namespace bon
 			_Implementor.SetViewport(viewport);
 		}
 
+		// set clipping rect
+		void Gfx::SetClipRect(const framework::RectangleI* clipRect)
+		{
+			_Implementor.SetClipRect(clipRect);
+		}
+
+		// get clipping rect
+		const framework::RectangleI* Gfx::GetClipRect() const
+		{
+			return _Implementor.GetClipRect();
+		}
+
+		// set drawing offset
+		void Gfx::SetDrawOffset(const framework::PointI& offset)
+		{
+			_Implementor.SetDrawOffset(offset);
+		}
+
+		// get drawing offset
+		const framework::PointI& Gfx::GetDrawOffset() const
+		{
+			return _Implementor.GetDrawOffset();
+		}
+
 		// draw text
 		void Gfx::DrawText(const FontAsset& font, const char* text, const framework::PointF& position, const Color* color, int fontSize, int maxWidth, BlendModes blend, const PointF* origin, float rotation, int outlineWidth, const Color* outlineColor)
 		{
@@ -177,6 +208,51 @@ namespace bon
 			return _GetEngine().Assets()._CreateImageFromHandle(handle);
 		}
 
+		// read pixels without waiting for the GPU
+		PixelsReadback Gfx::ReadPixelsAsync(const assets::ImageAsset& image, const framework::RectangleI& sourceRect, const char* saveToFile)
+		{
+			if (image == nullptr)
+			{
+				return _Implementor.ReadPixelsAsync(nullptr, 0, 0, sourceRect, saveToFile);
+			}
+			return _Implementor.ReadPixelsAsync((SDL_Texture*)image->Handle()->Texture, image->Width(), image->Height(), sourceRect, saveToFile);
+		}
+
+		// start capturing frames
+		void Gfx::StartFrameCapture(const FrameCaptureSettings& settings)
+		{
+			_Implementor.StartFrameCapture(settings);
+		}
+
+		// start capturing frames from config
+		void Gfx::StartFrameCapture(const assets::ConfigAsset& config)
+		{
+			static const char* formats[] = { "png", "y4m" };
+			static const char* overflows[] = { "drop", "throttle" };
+			FrameCaptureSettings settings;
+			settings.Format = (FrameCaptureFormats)config->GetOption("capture", "format", formats, (int)settings.Format);
+			settings.OutputPath = config->GetStr("capture", "output", settings.OutputPath);
+			settings.CaptureEveryNFrames = (int)config->GetInt("capture", "every_n_frames", settings.CaptureEveryNFrames);
+			settings.MaxQueuedFrames = (int)config->GetInt("capture", "max_queued_frames", settings.MaxQueuedFrames);
+			settings.WorkerThreads = (int)config->GetInt("capture", "worker_threads", settings.WorkerThreads);
+			settings.Overflow = (FrameCaptureOverflow)config->GetOption("capture", "overflow", overflows, (int)settings.Overflow);
+			settings.FrameRate = (int)config->GetInt("capture", "frame_rate", settings.FrameRate);
+			settings.MaxFrames = (int)config->GetInt("capture", "max_frames", settings.MaxFrames);
+			_Implementor.StartFrameCapture(settings);
+		}
+
+		// stop capturing frames
+		void Gfx::StopFrameCapture()
+		{
+			_Implementor.StopFrameCapture();
+		}
+
+		// get if capturing frames
+		bool Gfx::IsCapturingFrames() const
+		{
+			return _Implementor.IsCapturingFrames();
+		}
+
 		// get window size
 		const PointI& Gfx::WindowSize() const
 		{
@@ -264,6 +340,12 @@ namespace bon
 			_Implementor.SetEffect(effect);
 		}
 
+		// compile pending effects
+		int Gfx::WarmUpEffects(double maxTime)
+		{
+			return _Implementor.WarmUpEffects(maxTime);
+		}
+
 		// get active effect
 		assets::EffectAsset Gfx::GetActiveEffect() const
 		{
@@ -0,0 +1,269 @@
+#include <Gfx/GfxFrameCapture.h>
+#include <Log/ILog.h>
+#include <Diagnostics/IDiagnostics.h>
+#include <Framework/Exceptions.h>
+#include <BonEngine.h>
+#include <filesystem>
+#include <algorithm>
+
+namespace bon
+{
+	namespace gfx
+	{
+		// initialize frames capture
+		void GfxFrameCapture::Initialize(GfxReadbacks* readbacks)
+		{
+			_readbacks = readbacks;
+		}
+
+		// start capturing frames
+		void GfxFrameCapture::Start(const FrameCaptureSettings& settings, int width, int height)
+		{
+			// stop previous capture
+			if (_isCapturing) { Stop(); }
+
+			// store settings
+			_settings = settings;
+			_outputPath = settings.OutputPath ? settings.OutputPath : "capture";
+			_settings.OutputPath = _outputPath.c_str();
+			_settings.CaptureEveryNFrames = (std::max)(settings.CaptureEveryNFrames, 1);
+			_settings.MaxQueuedFrames = (std::max)(settings.MaxQueuedFrames, 1);
+			_settings.WorkerThreads = (settings.Format == FrameCaptureFormats::Y4M) ? 1 : (std::max)(settings.WorkerThreads, 1);
+			_width = width;
+			_height = height;
+			_renderedFrames = 0;
+			_capturedFrames = 0;
+			_GetEngine().Diagnostics().ResetCounter(diagnostics::DiagnosticsCounters::CapturedFrames);
+			_GetEngine().Diagnostics().ResetCounter(diagnostics::DiagnosticsCounters::DroppedCaptureFrames);
+			_GetEngine().Diagnostics().ResetCounter(diagnostics::DiagnosticsCounters::ThrottledCaptureFrames);
+			BON_ILOG("Start frames capture to '%s', size: %dx%d.", _outputPath.c_str(), width, height);
+
+			// prepare output
+			if (_settings.Format == FrameCaptureFormats::PngSequence)
+			{
+				std::error_code err;
+				std::filesystem::create_directories(_outputPath, err);
+			}
+			else
+			{
+				_y4mFile.open(_outputPath, std::ios::out | std::ios::binary | std::ios::trunc);
+				if (!_y4mFile.good())
+				{
+					BON_ELOG("Failed to open frames capture output file: %s", _outputPath.c_str());
+					throw framework::InvalidValue("Failed to open frames capture output file!");
+				}
+				_y4mFile << "YUV4MPEG2 W" << width << " H" << height << " F" << _settings.FrameRate << ":1 Ip A1:1 C420jpeg\n";
+				_yuvBuffer.resize((size_t)width * height + 2 * (size_t)((width + 1) / 2) * ((height + 1) / 2));
+			}
+
+			// start workers
+			_stopWorkers = false;
+			for (int i = 0; i < _settings.WorkerThreads; ++i)
+			{
+				_workers.push_back(std::thread(&GfxFrameCapture::WorkerLoop, this));
+			}
+			_isCapturing = true;
+		}
+
+		// stop capturing and wait for encoders
+		void GfxFrameCapture::Stop()
+		{
+			if (!_isCapturing) { return; }
+			_isCapturing = false;
+
+			// complete pending readbacks and push them to encoders
+			_readbacks->CompleteAll();
+			Update();
+
+			// let workers finish queue and exit
+			{
+				std::lock_guard<std::mutex> lock(_queueMutex);
+				_stopWorkers = true;
+			}
+			_queueHasFrames.notify_all();
+			for (auto& worker : _workers)
+			{
+				worker.join();
+			}
+			_workers.clear();
+
+			// close output
+			if (_y4mFile.is_open())
+			{
+				_y4mFile.close();
+			}
+			BON_ILOG("Frames capture ended, captured %d frames.", _capturedFrames);
+		}
+
+		// request pixels of the rendered frame
+		void GfxFrameCapture::OnFrameRendered(int width, int height)
+		{
+			// not capturing or skip this frame?
+			if (!_isCapturing) { return; }
+			if ((_renderedFrames++ % _settings.CaptureEveryNFrames) != 0) { return; }
+
+			// reached max frames? stop
+			int requestedFrames = _capturedFrames + (int)_waitingReadback.size();
+			if (_settings.MaxFrames > 0 && requestedFrames >= _settings.MaxFrames)
+			{
+				Stop();
+				return;
+			}
+
+			// when dropping frames, don't bother reading pixels if encoders are already full
+			if (_settings.Overflow == FrameCaptureOverflow::DropFrames)
+			{
+				std::lock_guard<std::mutex> lock(_queueMutex);
+				if ((int)_encodeQueue.size() >= _settings.MaxQueuedFrames)
+				{
+					_GetEngine().Diagnostics().IncreaseCounter(diagnostics::DiagnosticsCounters::DroppedCaptureFrames);
+					return;
+				}
+			}
+
+			// request pixels
+			CapturedFrame frame;
+			frame.Pixels = _readbacks->Request(nullptr, width, height, framework::RectangleI(), nullptr);
+			_waitingReadback.push_back(frame);
+		}
+
+		// move ready frames to encoders
+		void GfxFrameCapture::Update()
+		{
+			// move frames in order, stop at the first frame that's not ready yet
+			while (!_waitingReadback.empty() && _waitingReadback.front().Pixels->IsReady())
+			{
+				CapturedFrame frame = _waitingReadback.front();
+				_waitingReadback.pop_front();
+				if (frame.Pixels->Failed()) { continue; }
+				QueueForEncoding(frame);
+			}
+		}
+
+		// push frame to encoding queue
+		void GfxFrameCapture::QueueForEncoding(CapturedFrame& frame)
+		{
+			// y4m frames must match video size
+			if (_settings.Format == FrameCaptureFormats::Y4M && (frame.Pixels->Width() != _width || frame.Pixels->Height() != _height))
+			{
+				BON_WLOG("Drop captured frame with size %dx%d, since video size is %dx%d.", frame.Pixels->Width(), frame.Pixels->Height(), _width, _height);
+				_GetEngine().Diagnostics().IncreaseCounter(diagnostics::DiagnosticsCounters::DroppedCaptureFrames);
+				return;
+			}
+
+			{
+				std::unique_lock<std::mutex> lock(_queueMutex);
+
+				// queue is full? drop frame or wait for space
+				if ((int)_encodeQueue.size() >= _settings.MaxQueuedFrames)
+				{
+					if (_settings.Overflow == FrameCaptureOverflow::DropFrames)
+					{
+						_GetEngine().Diagnostics().IncreaseCounter(diagnostics::DiagnosticsCounters::DroppedCaptureFrames);
+						return;
+					}
+					_GetEngine().Diagnostics().IncreaseCounter(diagnostics::DiagnosticsCounters::ThrottledCaptureFrames);
+					_queueHasSpace.wait(lock, [this]() { return (int)_encodeQueue.size() < _settings.MaxQueuedFrames; });
+				}
+
+				// add to queue. frames are numbered by encoding order, so png sequences won't have gaps
+				frame.Index = _capturedFrames;
+				_encodeQueue.push_back(frame);
+			}
+			_queueHasFrames.notify_one();
+			_capturedFrames++;
+			_GetEngine().Diagnostics().IncreaseCounter(diagnostics::DiagnosticsCounters::CapturedFrames);
+		}
+
+		// worker thread main loop
+		void GfxFrameCapture::WorkerLoop()
+		{
+			while (true)
+			{
+				// get next frame, or exit if stopped and nothing left to do
+				CapturedFrame frame;
+				{
+					std::unique_lock<std::mutex> lock(_queueMutex);
+					_queueHasFrames.wait(lock, [this]() { return _stopWorkers || !_encodeQueue.empty(); });
+					if (_encodeQueue.empty()) { return; }
+					frame = _encodeQueue.front();
+					_encodeQueue.pop_front();
+				}
+				_queueHasSpace.notify_one();
+
+				// encode frame
+				Encode(frame);
+			}
+		}
+
+		// encode a single frame
+		void GfxFrameCapture::Encode(const CapturedFrame& frame)
+		{
+			if (_settings.Format == FrameCaptureFormats::PngSequence)
+			{
+				char filename[32];
+				snprintf(filename, sizeof(filename), "frame_%06d.png", frame.Index);
+				std::string path = (std::filesystem::path(_outputPath) / filename).u8string();
+				frame.Pixels->SaveToFile(path.c_str());
+			}
+			else
+			{
+				WriteY4MFrame(frame.Pixels);
+			}
+		}
+
+		// convert frame to yuv 4:2:0 (full range BT.601) and write to y4m file
+		void GfxFrameCapture::WriteY4MFrame(const PixelsReadback& pixels)
+		{
+			const unsigned char* rgba = pixels->Pixels();
+			int w = pixels->Width();
+			int h = pixels->Height();
+			int cw = (w + 1) / 2;
+			int ch = (h + 1) / 2;
+			unsigned char* yPlane = _yuvBuffer.data();
+			unsigned char* uPlane = yPlane + (size_t)w * h;
+			unsigned char* vPlane = uPlane + (size_t)cw * ch;
+
+			// luma
+			for (int y = 0; y < h; ++y)
+			{
+				const unsigned char* src = rgba + (size_t)y * w * 4;
+				unsigned char* dst = yPlane + (size_t)y * w;
+				for (int x = 0; x < w; ++x, src += 4)
+				{
+					dst[x] = (unsigned char)((77 * src[0] + 150 * src[1] + 29 * src[2] + 128) >> 8);
+				}
+			}
+
+			// chroma, averaged over 2x2 blocks
+			for (int cy = 0; cy < ch; ++cy)
+			{
+				for (int cx = 0; cx < cw; ++cx)
+				{
+					int r = 0, g = 0, b = 0, count = 0;
+					for (int dy = 0; dy < 2; ++dy)
+					{
+						int y = cy * 2 + dy;
+						if (y >= h) { break; }
+						for (int dx = 0; dx < 2; ++dx)
+						{
+							int x = cx * 2 + dx;
+							if (x >= w) { break; }
+							const unsigned char* p = rgba + ((size_t)y * w + x) * 4;
+							r += p[0]; g += p[1]; b += p[2]; count++;
+						}
+					}
+					r /= count; g /= count; b /= count;
+					int u = ((-43 * r - 85 * g + 128 * b + 128) >> 8) + 128;
+					int v = ((128 * r - 107 * g - 21 * b + 128) >> 8) + 128;
+					uPlane[(size_t)cy * cw + cx] = (unsigned char)(std::min)((std::max)(u, 0), 255);
+					vPlane[(size_t)cy * cw + cx] = (unsigned char)(std::min)((std::max)(v, 0), 255);
+				}
+			}
+
+			// write frame
+			_y4mFile << "FRAME\n";
+			_y4mFile.write((const char*)_yuvBuffer.data(), _yuvBuffer.size());
+		}
+	}
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include <Gfx/GfxOpenGL.h>
 #include <fstream>
 #include <streambuf>
+#include <vector>
+#include <cstdint>
+#include <cstring>
 
 #include <SDL2-2.0.12/include/SDL.h>
 #include <SDL2_image-2.0.5/include/SDL_image.h>
@@ -41,6 +44,7 @@ PFNGLCOMPILESHADERPROC glCompileShader;
 PFNGLGETSHADERIVPROC glGetShaderiv;
 PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
 PFNGLDELETESHADERPROC glDeleteShader;
+PFNGLDELETEPROGRAMPROC glDeleteProgram;
 PFNGLATTACHSHADERPROC glAttachShader;
 PFNGLCREATEPROGRAMPROC glCreateProgram;
 PFNGLLINKPROGRAMPROC glLinkProgram;
@@ -64,6 +68,24 @@ PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
 PFNGLBLENDEQUATIONSEPARATEPROC glBlendEquationSeparate;
 PFNGLBLENDEQUATIONEXTPROC glBlendEquationEXT;
 PFNGLBLENDEQUATIONSEPARATEEXTPROC glBlendEquationSeparateEXT;
+PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+PFNGLPROGRAMBINARYPROC glProgramBinary;
+PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+PFNGLGENBUFFERSPROC glGenBuffers;
+PFNGLDELETEBUFFERSPROC glDeleteBuffers;
+PFNGLBINDBUFFERPROC glBindBuffer;
+PFNGLBUFFERDATAPROC glBufferData;
+PFNGLBUFFERSUBDATAPROC glBufferSubData;
+PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
+PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
+PFNGLMAPBUFFERPROC glMapBuffer;
+PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+PFNGLFENCESYNCPROC glFenceSync;
+PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+PFNGLDELETESYNCPROC glDeleteSync;
+PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
 //PFNGLCLEARTEXIMAGEPROC glClearTexImage;
 
 // load GL extension methods
@@ -75,6 +97,7 @@ bool initGLExtensions()
 	glGetShaderiv = (PFNGLGETSHADERIVPROC)SDL_GL_GetProcAddress("glGetShaderiv");
 	glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)SDL_GL_GetProcAddress("glGetShaderInfoLog");
 	glDeleteShader = (PFNGLDELETESHADERPROC)SDL_GL_GetProcAddress("glDeleteShader");
+	glDeleteProgram = (PFNGLDELETEPROGRAMPROC)SDL_GL_GetProcAddress("glDeleteProgram");
 	glAttachShader = (PFNGLATTACHSHADERPROC)SDL_GL_GetProcAddress("glAttachShader");
 	glCreateProgram = (PFNGLCREATEPROGRAMPROC)SDL_GL_GetProcAddress("glCreateProgram");
 	glLinkProgram = (PFNGLLINKPROGRAMPROC)SDL_GL_GetProcAddress("glLinkProgram");
@@ -99,6 +122,30 @@ bool initGLExtensions()
 	glBlendEquationEXT = (PFNGLBLENDEQUATIONEXTPROC)SDL_GL_GetProcAddress("glBlendEquationEXT");
 	glBlendEquationSeparateEXT = (PFNGLBLENDEQUATIONSEPARATEEXTPROC)SDL_GL_GetProcAddress("glBlendEquationSeparateEXT");
 
+	// optional - program binaries (GL 4.1 / ARB_get_program_binary), used for shaders cache
+	glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glGetProgramBinary");
+	glProgramBinary = (PFNGLPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glProgramBinary");
+	glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)SDL_GL_GetProcAddress("glProgramParameteri");
+
+	// optional - buffer objects and uniform blocks (GL 3.1+), used for uniform buffers
+	glGenBuffers = (PFNGLGENBUFFERSPROC)SDL_GL_GetProcAddress("glGenBuffers");
+	glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)SDL_GL_GetProcAddress("glDeleteBuffers");
+	glBindBuffer = (PFNGLBINDBUFFERPROC)SDL_GL_GetProcAddress("glBindBuffer");
+	glBufferData = (PFNGLBUFFERDATAPROC)SDL_GL_GetProcAddress("glBufferData");
+	glBufferSubData = (PFNGLBUFFERSUBDATAPROC)SDL_GL_GetProcAddress("glBufferSubData");
+	glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)SDL_GL_GetProcAddress("glBindBufferBase");
+	glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)SDL_GL_GetProcAddress("glGetUniformBlockIndex");
+	glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)SDL_GL_GetProcAddress("glUniformBlockBinding");
+
+	// optional - pixel buffers, fences and framebuffer blits (GL 3.2+), used for async pixels readback and screen copy
+	glMapBuffer = (PFNGLMAPBUFFERPROC)SDL_GL_GetProcAddress("glMapBuffer");
+	glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)SDL_GL_GetProcAddress("glUnmapBuffer");
+	glFenceSync = (PFNGLFENCESYNCPROC)SDL_GL_GetProcAddress("glFenceSync");
+	glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)SDL_GL_GetProcAddress("glClientWaitSync");
+	glDeleteSync = (PFNGLDELETESYNCPROC)SDL_GL_GetProcAddress("glDeleteSync");
+	glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)SDL_GL_GetProcAddress("glBindFramebuffer");
+	glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)SDL_GL_GetProcAddress("glBlitFramebuffer");
+
 	return glCreateShader && glShaderSource && glCompileShader && glGetShaderiv &&
 		glGetShaderInfoLog && glDeleteShader && glAttachShader && glCreateProgram &&
 		glLinkProgram && glValidateProgram && glGetProgramiv && glGetProgramInfoLog &&
@@ -150,23 +197,230 @@ namespace bon
 			return result;
 		}
 
+		/**
+		 * Read a whole text file into a string.
+		 */
+		std::string readTextFile(const char* path)
+		{
+			std::ifstream file(path, std::ios::in | std::ios::binary);
+			if (!file.good())
+			{
+				BON_ELOG("Failed to read shader file: %s", path);
+				throw bon::framework::AssetLoadError(path);
+			}
+			std::string ret;
+			file.seekg(0, std::ios::end);
+			ret.resize((size_t)file.tellg());
+			file.seekg(0, std::ios::beg);
+			file.read(&ret[0], ret.size());
+			return ret;
+		}
+
 		/**
 		 * Compile and return a GLSL program from file.
 		 */
 		GLuint GfxOpenGL::CompileProgramFromFiles(const char* vtxFile, const char* fragFile)
 		{
-			std::ifstream fvtx(vtxFile);
-			std::string sourceVtx((std::istreambuf_iterator<char>(fvtx)), std::istreambuf_iterator<char>());
-			std::ifstream ffrag(fragFile);
-			std::string sourceFrag((std::istreambuf_iterator<char>(ffrag)), std::istreambuf_iterator<char>());
+			std::string sourceVtx = readTextFile(vtxFile);
+			std::string sourceFrag = readTextFile(fragFile);
 			return CompileProgram(sourceVtx.c_str(), sourceFrag.c_str());
 		}
 
+		/**
+		 * Header we put at the beginning of every cached program binary file.
+		 */
+		struct ProgramBinaryHeader
+		{
+			// magic value to identify file type
+			uint32_t Magic;
+
+			// binary format, as returned by the driver
+			uint32_t BinaryFormat;
+
+			// binary length in bytes
+			uint32_t Length;
+
+			// padding
+			uint32_t Reserved;
+
+			// cache key this binary was stored with
+			uint64_t Key;
+		};
+
+		// magic value for cached program binaries ('BSPB' + version)
+		const uint32_t _programBinaryMagic = 0x42535001;
+
+		/**
+		 * Hash data with FNV-1a.
+		 */
+		inline uint64_t fnv1aHash(const char* data, size_t length, uint64_t hash = 14695981039346656037ULL)
+		{
+			for (size_t i = 0; i < length; ++i)
+			{
+				hash ^= (unsigned char)data[i];
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		/**
+		 * Build the cache key of a program.
+		 * Key is based on the shaders source and the driver / renderer strings, so updating drivers will invalidate cache.
+		 */
+		uint64_t programCacheKey(const char* vtxShader, const char* fragShader)
+		{
+			static std::string driverId;
+			if (driverId.empty())
+			{
+				const char* vendor = (const char*)glGetString(GL_VENDOR);
+				const char* renderer = (const char*)glGetString(GL_RENDERER);
+				const char* version = (const char*)glGetString(GL_VERSION);
+				driverId = std::string(vendor ? vendor : "") + "|" + (renderer ? renderer : "") + "|" + (version ? version : "");
+			}
+			uint64_t hash = fnv1aHash(driverId.c_str(), driverId.length());
+			hash = fnv1aHash(vtxShader, strlen(vtxShader), hash);
+			hash = fnv1aHash("|", 1, hash);
+			hash = fnv1aHash(fragShader, strlen(fragShader), hash);
+			return hash;
+		}
+
+		/**
+		 * Get program binary cache path from key.
+		 */
+		std::string programCachePath(uint64_t key)
+		{
+			char filename[32];
+			snprintf(filename, sizeof(filename), "%016llx.bin", (unsigned long long)key);
+			return fs::path(bon::Features().ShaderCacheFolder).append(filename).u8string();
+		}
+
+		/**
+		 * Try to create a program from cached binary.
+		 * Return 0 if not found or binary is no longer valid.
+		 */
+		GLuint loadProgramBinary(uint64_t key)
+		{
+#ifndef __APPLE__
+			// open cached file
+			std::string path = programCachePath(key);
+			std::ifstream file(path, std::ios::in | std::ios::binary);
+			if (!file.good()) { return 0; }
+
+			// read and validate header
+			ProgramBinaryHeader header;
+			if (!file.read((char*)&header, sizeof(header)) || header.Magic != _programBinaryMagic || header.Key != key || header.Length == 0)
+			{
+				BON_WLOG("Invalid shader program cache file: %s", path.c_str());
+				return 0;
+			}
+
+			// read binary data
+			std::vector<char> binary(header.Length);
+			if (!file.read(binary.data(), header.Length)) 
+			{
+				BON_WLOG("Corrupted shader program cache file: %s", path.c_str());
+				return 0;
+			}
+
+			// create program from binary and make sure driver accepted it
+			GLuint programId = glCreateProgram();
+			glProgramBinary(programId, (GLenum)header.BinaryFormat, binary.data(), (GLsizei)header.Length);
+			GLint linked = GL_FALSE;
+			glGetProgramiv(programId, GL_LINK_STATUS, &linked);
+			if (linked != GL_TRUE)
+			{
+				BON_DLOG("Shader program cache file was rejected by driver, will recompile: %s", path.c_str());
+				glDeleteProgram(programId);
+				return 0;
+			}
+
+			BON_DLOG("Loaded shader program from cache: %s", path.c_str());
+			return programId;
+#else
+			return 0;
+#endif
+		}
+
+		/**
+		 * Store a linked program binary in cache.
+		 */
+		void saveProgramBinary(GLuint programId, uint64_t key)
+		{
+#ifndef __APPLE__
+			// get binary length
+			GLint length = 0;
+			glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &length);
+			if (length <= 0) { return; }
+
+			// get binary
+			std::vector<char> binary((size_t)length);
+			GLenum format = 0;
+			GLsizei written = 0;
+			glGetProgramBinary(programId, length, &written, &format, binary.data());
+			if (written <= 0) { return; }
+
+			// write to file
+			std::error_code err;
+			fs::create_directories(bon::Features().ShaderCacheFolder, err);
+			std::string path = programCachePath(key);
+			std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!file.good())
+			{
+				BON_WLOG("Failed to write shader program cache file: %s", path.c_str());
+				return;
+			}
+			ProgramBinaryHeader header = { _programBinaryMagic, (uint32_t)format, (uint32_t)written, 0, key };
+			file.write((const char*)&header, sizeof(header));
+			file.write(binary.data(), written);
+			BON_DLOG("Stored shader program in cache: %s", path.c_str());
+#endif
+		}
+
+		/**
+		 * Check if program binaries cache is enabled.
+		 */
+		bool GfxOpenGL::ProgramBinaryCacheEnabled()
+		{
+#ifndef __APPLE__
+			// check if feature is enabled
+			const char* folder = bon::Features().ShaderCacheFolder;
+			if (folder == nullptr || folder[0] == '\0') { return false; }
+
+			// check if driver supports program binaries
+			static int supportedFormats = -1;
+			if (supportedFormats == -1)
+			{
+				supportedFormats = 0;
+				if (glGetProgramBinary && glProgramBinary && glProgramParameteri)
+				{
+					glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &supportedFormats);
+				}
+				if (supportedFormats == 0)
+				{
+					BON_WLOG("Shader program binaries are not supported by driver, shaders cache is disabled.");
+				}
+			}
+			return supportedFormats > 0;
+#else
+			return false;
+#endif
+		}
+
 		/**
 		 * Compile and return a GLSL program.
 		 */
 		GLuint GfxOpenGL::CompileProgram(const char* vtxShader, const char* fragShader)
 		{
+			// try to get from binaries cache
+			bool useCache = ProgramBinaryCacheEnabled();
+			uint64_t cacheKey = 0;
+			if (useCache)
+			{
+				cacheKey = programCacheKey(vtxShader, fragShader);
+				GLuint fromCache = loadProgramBinary(cacheKey);
+				if (fromCache) { return fromCache; }
+			}
+
 			GLuint programId = 0;
 			GLuint vtxShaderId, fragShaderId;
 
@@ -180,6 +434,9 @@ namespace bon
 				// associate shader with program
 				glAttachShader(programId, vtxShaderId);
 				glAttachShader(programId, fragShaderId);
+#ifndef __APPLE__
+				if (useCache) { glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE); }
+#endif
 				glLinkProgram(programId);
 				glValidateProgram(programId);
 
@@ -194,6 +451,14 @@ namespace bon
 					BON_DLOG("Compiling shaders prog info log:\n%s", log);
 					free(log);
 				}
+
+				// store in cache
+				GLint linked = GL_FALSE;
+				glGetProgramiv(programId, GL_LINK_STATUS, &linked);
+				if (useCache && linked == GL_TRUE)
+				{
+					saveProgramBinary(programId, cacheKey);
+				}
 			}
 			if (vtxShaderId) {
 				glDeleteShader(vtxShaderId);
@@ -349,6 +614,19 @@ namespace bon
 			return ret;
 		}
 
+		/**
+		 * Set offset to add to all drawing positions.
+		 */
+		void GfxOpenGL::SetDrawOffset(int x, int y)
+		{
+			glMatrixMode(GL_MODELVIEW);
+			glLoadIdentity();
+			if (x != 0 || y != 0)
+			{
+				glTranslatef((GLfloat)x, (GLfloat)y, 0);
+			}
+		}
+
 		/**
 		 * Set blending mode.
 		 */
@@ -394,6 +672,11 @@ namespace bon
 				glEnable(GL_BLEND);
 				break;
 
+			case BlendModes::Premultiplied:
+				glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+				glEnable(GL_BLEND);
+				break;
+
 			case BlendModes::Subtract:
 				glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ONE, GL_ONE);
 				glBlendEquationSeparate(GL_FUNC_REVERSE_SUBTRACT, GL_FUNC_ADD);
@@ -753,5 +1036,245 @@ namespace bon
 		{
 			glUniformMatrix4fv(uniform, count, transpose, values);
 		}
+
+		/**
+		 * Check if uniform buffer objects are supported.
+		 */
+		bool GfxOpenGL::SupportsUniformBuffers()
+		{
+#ifndef __APPLE__
+			return glGenBuffers && glBindBuffer && glBufferData && glBufferSubData && glBindBufferBase && glGetUniformBlockIndex && glUniformBlockBinding;
+#else
+			return false;
+#endif
+		}
+
+		/**
+		 * Get uniform block index from program.
+		 */
+		GLint GfxOpenGL::GetUniformBlockIndex(GLint programId, const char* name)
+		{
+			GLuint ret = glGetUniformBlockIndex(programId, name);
+			return (ret == GL_INVALID_INDEX) ? -1 : (GLint)ret;
+		}
+
+		/**
+		 * Attach a program uniform block to a binding point.
+		 */
+		void GfxOpenGL::SetUniformBlockBinding(GLint programId, GLint blockIndex, GLuint bindingPoint)
+		{
+			glUniformBlockBinding(programId, (GLuint)blockIndex, bindingPoint);
+		}
+
+		/**
+		 * Upload data to a uniform buffer, and create the buffer if needed.
+		 */
+		void GfxOpenGL::UploadUniformBuffer(GLuint& buffer, const void* data, size_t size, bool resize)
+		{
+			if (buffer == 0)
+			{
+				glGenBuffers(1, &buffer);
+				resize = true;
+			}
+			glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+			if (resize)
+			{
+				glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr)size, data, GL_DYNAMIC_DRAW);
+			}
+			else
+			{
+				glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr)size, data);
+			}
+			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		}
+
+		/**
+		 * Bind a uniform buffer to a binding point.
+		 */
+		void GfxOpenGL::BindUniformBuffer(GLuint bindingPoint, GLuint buffer)
+		{
+			glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, buffer);
+		}
+
+		/**
+		 * Delete a buffer object.
+		 */
+		void GfxOpenGL::DeleteBuffer(GLuint buffer)
+		{
+			if (buffer && glDeleteBuffers)
+			{
+				glDeleteBuffers(1, &buffer);
+			}
+		}
+
+		/**
+		 * Check if pixel buffers are supported.
+		 */
+		bool GfxOpenGL::SupportsPixelBuffers()
+		{
+#ifndef __APPLE__
+			return glGenBuffers && glBindBuffer && glBufferData && glMapBuffer && glUnmapBuffer;
+#else
+			return false;
+#endif
+		}
+
+		/**
+		 * Start reading pixels from current read framebuffer into a pixel buffer.
+		 */
+		void GfxOpenGL::ReadPixelsToBuffer(GLuint& buffer, size_t& capacity, int x, int y, int width, int height)
+		{
+			size_t size = (size_t)width * (size_t)height * 4;
+			if (buffer == 0)
+			{
+				glGenBuffers(1, &buffer);
+				capacity = 0;
+			}
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+			if (size > capacity)
+			{
+				glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)size, NULL, GL_STREAM_READ);
+				capacity = size;
+			}
+			glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		}
+
+		/**
+		 * Copy pixels from a pixel buffer into memory.
+		 */
+		bool GfxOpenGL::CopyPixelBuffer(GLuint buffer, int width, int height, bool flipRows, unsigned char* dest)
+		{
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+			const unsigned char* src = (const unsigned char*)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+			if (src == nullptr)
+			{
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+				return false;
+			}
+			size_t pitch = (size_t)width * 4;
+			if (flipRows)
+			{
+				for (int row = 0; row < height; ++row)
+				{
+					memcpy(dest + pitch * row, src + pitch * (height - row - 1), pitch);
+				}
+			}
+			else
+			{
+				memcpy(dest, src, pitch * height);
+			}
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			return true;
+		}
+
+		/**
+		 * Upload rows of pixels into a texture.
+		 */
+		void GfxOpenGL::UploadTextureRows(SDL_Texture* texture, GLuint& buffer, size_t& capacity, int y, int width, int rows, const unsigned char* pixels)
+		{
+			// bind texture. SDL uses rectangle textures (with coords in pixels) only if non power of two textures are not supported
+			float texw;
+			float texh;
+			SDL_GL_BindTexture(texture, &texw, &texh);
+
+			// no pixel buffers (or 1 pixel wide texture, where we can't tell the texture type)? upload directly
+			if (!SupportsPixelBuffers() || width <= 1)
+			{
+				SDL_Rect rect = { 0, y, width, rows };
+				SDL_UpdateTexture(texture, &rect, pixels, width * 4);
+				return;
+			}
+
+			// copy pixels into buffer (orphan previous storage, so we don't wait for the driver to finish with it)
+			size_t size = (size_t)width * (size_t)rows * 4;
+			if (buffer == 0)
+			{
+				glGenBuffers(1, &buffer);
+				capacity = 0;
+			}
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+			if (size > capacity) { capacity = size; }
+			glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)capacity, NULL, GL_STREAM_DRAW);
+			void* dest = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+			if (dest == nullptr)
+			{
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+				SDL_Rect rect = { 0, y, width, rows };
+				SDL_UpdateTexture(texture, &rect, pixels, width * 4);
+				return;
+			}
+			memcpy(dest, pixels, size);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+			// transfer from buffer to texture
+			GLenum target = (texw > 1.0f) ? GL_TEXTURE_RECTANGLE : GL_TEXTURE_2D;
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+			glTexSubImage2D(target, 0, 0, y, width, rows, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
+
+		/**
+		 * Insert a fence to the GPU commands stream.
+		 */
+		void* GfxOpenGL::CreateFence()
+		{
+#ifndef __APPLE__
+			if (glFenceSync) { return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0); }
+#endif
+			return nullptr;
+		}
+
+		/**
+		 * Check if GPU passed a fence, without waiting.
+		 */
+		bool GfxOpenGL::IsFenceSignaled(void* fence)
+		{
+#ifndef __APPLE__
+			if (fence && glClientWaitSync)
+			{
+				GLenum result = glClientWaitSync((GLsync)fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+				return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED;
+			}
+#endif
+			return true;
+		}
+
+		/**
+		 * Delete a fence.
+		 */
+		void GfxOpenGL::DeleteFence(void* fence)
+		{
+#ifndef __APPLE__
+			if (fence && glDeleteSync) { glDeleteSync((GLsync)fence); }
+#endif
+		}
+
+		/**
+		 * Check if framebuffer blit is supported.
+		 */
+		bool GfxOpenGL::SupportsFramebufferBlit()
+		{
+#ifndef __APPLE__
+			return glBindFramebuffer && glBlitFramebuffer;
+#else
+			return false;
+#endif
+		}
+
+		/**
+		 * Copy the screen (default framebuffer) into the currently bound render target, flipped to top-down rows.
+		 */
+		void GfxOpenGL::BlitScreenToCurrentTarget(int screenWidth, int screenHeight, int targetWidth, int targetHeight)
+		{
+			GLint drawFramebuffer = 0;
+			glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+			GLenum filter = (screenWidth == targetWidth && screenHeight == targetHeight) ? GL_NEAREST : GL_LINEAR;
+			glBlitFramebuffer(0, 0, screenWidth, screenHeight, 0, targetHeight, targetWidth, 0, GL_COLOR_BUFFER_BIT, filter);
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, drawFramebuffer);
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <Gfx/GfxReadbacks.h>
+#include <Gfx/GfxOpenGL.h>
+#include <Log/ILog.h>
+#include <Framework/Exceptions.h>
+#include <BonEngine.h>
+#include <chrono>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+namespace bon
+{
+	namespace gfx
+	{
+		// initialize readbacks ring
+		void GfxReadbacks::Initialize(SDL_Renderer* renderer)
+		{
+			_renderer = renderer;
+			_slots.clear();
+			_slots.resize((size_t)bon::Features().AsyncReadbackFrames + 2);
+			_nextSlot = 0;
+		}
+
+		// request to read pixels from texture or screen
+		PixelsReadback GfxReadbacks::Request(SDL_Texture* texture, int width, int height, const framework::RectangleI& sourceRect, const char* saveToFile)
+		{
+			// calc region to read
+			SDL_Rect rect;
+			rect.x = sourceRect.X;
+			rect.y = sourceRect.Y;
+			rect.w = (sourceRect.Width != 0) ? sourceRect.Width : (width - sourceRect.X);
+			rect.h = (sourceRect.Height != 0) ? sourceRect.Height : (height - sourceRect.Y);
+			if (rect.x < 0 || rect.y < 0 || rect.w <= 0 || rect.h <= 0 || rect.x + rect.w > width || rect.y + rect.h > height)
+			{
+				throw bon::framework::InvalidValue("Invalid source rect to read pixels from!");
+			}
+
+			// create request
+			PixelsReadback ret = std::make_shared<_PixelsReadback>(rect.w, rect.h, saveToFile);
+
+			// get current render target and set source as the new render target
+			SDL_Texture* prevTarget = SDL_GetRenderTarget(_renderer);
+			SDL_SetRenderTarget(_renderer, texture);
+
+			// pixel buffers not supported? read synchronously
+			if (!GfxOpenGL::SupportsPixelBuffers() || _slots.empty())
+			{
+				ret->_Buffer().resize((size_t)rect.w * rect.h * 4);
+				bool success = SDL_RenderReadPixels(_renderer, &rect, SDL_PIXELFORMAT_RGBA32, ret->_Buffer().data(), rect.w * 4) == 0;
+				SDL_SetRenderTarget(_renderer, prevTarget);
+				ret->_SetReady(success);
+				OnReady(ret);
+				return ret;
+			}
+
+			// get next slot in ring. if its still busy, complete it now (will wait for GPU)
+			ReadbackSlot& slot = _slots[_nextSlot];
+			_nextSlot = (_nextSlot + 1) % _slots.size();
+			if (slot.Request)
+			{
+				BON_DLOG("Readbacks ring is full, wait for oldest readback to complete.");
+				Complete(slot);
+			}
+
+			// start reading into pixel buffer. screen rows are bottom-up, render targets are top-down
+			slot.FlipRows = (texture == nullptr);
+			int glY = slot.FlipRows ? (height - rect.y - rect.h) : rect.y;
+			GfxOpenGL::ReadPixelsToBuffer(slot.Buffer, slot.Capacity, rect.x, glY, rect.w, rect.h);
+			slot.Fence = GfxOpenGL::CreateFence();
+			slot.FramesLeft = bon::Features().AsyncReadbackFrames;
+			slot.Request = ret;
+
+			// restore previous render target
+			SDL_SetRenderTarget(_renderer, prevTarget);
+			return ret;
+		}
+
+		// complete readbacks that are ready
+		void GfxReadbacks::Update()
+		{
+			// check pending readbacks
+			for (ReadbackSlot& slot : _slots)
+			{
+				if (!slot.Request) { continue; }
+				if (--slot.FramesLeft <= 0 && GfxOpenGL::IsFenceSignaled(slot.Fence))
+				{
+					Complete(slot);
+				}
+			}
+
+			// clear files that finished saving
+			for (auto it = _pendingSaves.begin(); it != _pendingSaves.end(); )
+			{
+				if (it->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+				{
+					it = _pendingSaves.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		// complete all pending readbacks
+		void GfxReadbacks::CompleteAll()
+		{
+			for (ReadbackSlot& slot : _slots)
+			{
+				if (slot.Request) { Complete(slot); }
+			}
+		}
+
+		// complete readbacks, wait for saves and free buffers
+		void GfxReadbacks::Dispose()
+		{
+			CompleteAll();
+			for (auto& save : _pendingSaves)
+			{
+				save.wait();
+			}
+			_pendingSaves.clear();
+			for (ReadbackSlot& slot : _slots)
+			{
+				GfxOpenGL::DeleteBuffer(slot.Buffer);
+			}
+			_slots.clear();
+		}
+
+		// copy pixels from slot into request and free slot
+		void GfxReadbacks::Complete(ReadbackSlot& slot)
+		{
+			// copy pixels
+			PixelsReadback request = slot.Request;
+			request->_Buffer().resize((size_t)request->Width() * request->Height() * 4);
+			bool success = GfxOpenGL::CopyPixelBuffer(slot.Buffer, request->Width(), request->Height(), slot.FlipRows, request->_Buffer().data());
+			if (!success)
+			{
+				BON_WLOG("Failed to map pixel buffer for async readback.");
+			}
+
+			// free slot
+			GfxOpenGL::DeleteFence(slot.Fence);
+			slot.Fence = nullptr;
+			slot.Request = nullptr;
+
+			// set as ready
+			request->_SetReady(success);
+			OnReady(request);
+		}
+
+		// handle readback that just got ready
+		void GfxReadbacks::OnReady(const PixelsReadback& request)
+		{
+			// save to file in background, so encoding won't stall the frame
+			if (!request->Failed() && !request->_SaveToFilePath().empty())
+			{
+				PixelsReadback toSave = request;
+				_pendingSaves.push_back(std::async(std::launch::async, [toSave]() {
+					toSave->SaveToFile(toSave->_SaveToFilePath().c_str());
+				}));
+			}
+		}
+	}
+}
\ No newline at end of file
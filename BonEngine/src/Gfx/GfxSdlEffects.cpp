@@ -10,6 +10,9 @@
 #include <filesystem>
 #include <fstream>
 #include <streambuf>
+#include <vector>
+#include <algorithm>
+#include <cstring>
 
 #pragma warning(push, 0)
 #include <SDL2-2.0.12/include/SDL.h>
@@ -68,6 +71,12 @@ namespace bon
 {
 	namespace gfx
 	{
+		// forward declare effect handle
+		class SDL_EffectHandle;
+
+		// effects that were loaded but are waiting to be compiled (lazy compilation)
+		std::vector<SDL_EffectHandle*> _pendingEffects;
+
 		// effect handle for SDL
 		class SDL_EffectHandle : public _EffectHandle
 		{
@@ -76,6 +85,9 @@ namespace bon
 			// loaded program id
 			GLuint _programId;
 
+			// is the program compiled?
+			bool _isCompiled;
+
 			// fragment / vertex shaders full path
 			std::string _fragmentPath;
 			std::string _vertexPath;
@@ -89,6 +101,106 @@ namespace bon
 			// cache uniforms
 			std::unordered_map<std::string, GLint> _uniformAddress;
 
+			// uniform location that was not resolved yet
+			static const GLint UnresolvedUniform = -2;
+
+			// staged uniform value types
+			enum class StagedUniformType
+			{
+				None,
+				Float1, Float2, Float3, Float4,
+				Int1, Int2, Int3, Int4,
+				Matrix2, Matrix3, Matrix4,
+			};
+
+			// a uniform value waiting to be uploaded to program
+			struct StagedUniform
+			{
+				std::string Name;
+				GLint Location = UnresolvedUniform;
+				StagedUniformType Type = StagedUniformType::None;
+				bool Dirty = false;
+				bool Transpose = false;
+				int Count = 0;
+				float Floats[4] = { 0 };
+				int Ints[4] = { 0 };
+				std::vector<float> Matrix;
+			};
+
+			// a uniform block data waiting to be uploaded as uniform buffer
+			struct StagedUniformBlock
+			{
+				std::string Name;
+				GLint Index = UnresolvedUniform;
+				GLuint Buffer = 0;
+				bool Dirty = false;
+				bool Resize = false;
+				std::vector<unsigned char> Data;
+			};
+
+			// staged uniforms, their index by name, and indices of uniforms that changed since last flush
+			std::vector<StagedUniform> _uniforms;
+			std::unordered_map<std::string, int> _uniformsIndex;
+			std::vector<int> _dirtyUniforms;
+
+			// staged uniform blocks
+			std::vector<StagedUniformBlock> _uniformBlocks;
+
+			// get staged uniform from handle
+			inline StagedUniform& GetStaged(UniformHandle uniform)
+			{
+				if (!uniform.IsValid() || uniform.Id >= (int)_uniforms.size())
+				{
+					throw bon::InvalidValue("Invalid uniform handle!");
+				}
+				return _uniforms[uniform.Id];
+			}
+
+			// mark staged uniform as dirty
+			inline void MarkDirty(StagedUniform& staged, int index)
+			{
+				if (!staged.Dirty)
+				{
+					staged.Dirty = true;
+					_dirtyUniforms.push_back(index);
+				}
+			}
+
+			// stage float values, skip if unchanged
+			void StageFloats(UniformHandle uniform, StagedUniformType type, const float* values)
+			{
+				StagedUniform& staged = GetStaged(uniform);
+				int count = (int)type - (int)StagedUniformType::Float1 + 1;
+				if (staged.Type == type && memcmp(staged.Floats, values, sizeof(float) * count) == 0) { return; }
+				staged.Type = type;
+				memcpy(staged.Floats, values, sizeof(float) * count);
+				MarkDirty(staged, uniform.Id);
+			}
+
+			// stage int values, skip if unchanged
+			void StageInts(UniformHandle uniform, StagedUniformType type, const int* values)
+			{
+				StagedUniform& staged = GetStaged(uniform);
+				int count = (int)type - (int)StagedUniformType::Int1 + 1;
+				if (staged.Type == type && memcmp(staged.Ints, values, sizeof(int) * count) == 0) { return; }
+				staged.Type = type;
+				memcpy(staged.Ints, values, sizeof(int) * count);
+				MarkDirty(staged, uniform.Id);
+			}
+
+			// stage matrix values, skip if unchanged
+			void StageMatrix(UniformHandle uniform, StagedUniformType type, int count, bool transpose, const float* values, int valuesPerMatrix)
+			{
+				StagedUniform& staged = GetStaged(uniform);
+				size_t size = (size_t)count * valuesPerMatrix;
+				if (staged.Type == type && staged.Transpose == transpose && staged.Matrix.size() == size && memcmp(staged.Matrix.data(), values, sizeof(float) * size) == 0) { return; }
+				staged.Type = type;
+				staged.Count = count;
+				staged.Transpose = transpose;
+				staged.Matrix.assign(values, values + size);
+				MarkDirty(staged, uniform.Id);
+			}
+
 		public:
 
 			/**
@@ -99,7 +211,7 @@ namespace bon
 			/**
 			 * Constructor.
 			 */
-			SDL_EffectHandle(const bon::assets::ConfigAsset& config) : _isValid(false)
+			SDL_EffectHandle(const bon::assets::ConfigAsset& config) : _programId(0), _isCompiled(false), _isValid(false)
 			{
 				// read basic properties
 				_useTextures = config->GetBool("general", "texture", true);
@@ -110,8 +222,16 @@ namespace bon
 				_vertexPath = std::filesystem::path(effectFolder).append(config->GetStr("shaders", "vertex", "shader.vertex")).u8string();
 				_fragmentPath = std::filesystem::path(effectFolder).append(config->GetStr("shaders", "fragment", "shader.fragment")).u8string();
 				BON_DLOG("Load effect '%s' shaders. Fragment: %s, Vertex: %s.", config->Path(), _fragmentPath.c_str(), _vertexPath.c_str());
-				_programId = GfxOpenGL::CompileProgramFromFiles(_vertexPath.c_str(), _fragmentPath.c_str());
-				BON_DLOG("Created effect program with id: %d", _programId);
+
+				// compile now, or add to pending effects to compile on first use
+				if (bon::Features().LazyEffectsCompilation)
+				{
+					_pendingEffects.push_back(this);
+				}
+				else
+				{
+					Compile();
+				}
 
 				// load general params
 				_flipCoordsV = config->GetBool("general", "flip_texture_v", true);
@@ -123,7 +243,7 @@ namespace bon
 			/**
 			 * Constructor with params.
 			 */
-			SDL_EffectHandle(bool useTexture, bool useVertexColor, bool flipTextureY, const char* vertex, const char* frag) : _isValid(false)
+			SDL_EffectHandle(bool useTexture, bool useVertexColor, bool flipTextureY, const char* vertex, const char* frag) : _isCompiled(true), _isValid(false)
 			{
 				// store basic params
 				_useTextures = useTexture;
@@ -139,6 +259,43 @@ namespace bon
 				_isValid = true;
 			}
 
+			/**
+			 * Destructor.
+			 */
+			virtual ~SDL_EffectHandle()
+			{
+				if (!_isCompiled)
+				{
+					_pendingEffects.erase(std::remove(_pendingEffects.begin(), _pendingEffects.end(), this), _pendingEffects.end());
+				}
+				for (StagedUniformBlock& block : _uniformBlocks)
+				{
+					if (block.Buffer) { GfxOpenGL::DeleteBuffer(block.Buffer); }
+				}
+			}
+
+			/**
+			 * Get if this effect program is compiled and ready to use.
+			 */
+			virtual bool IsCompiled() const override { return _isCompiled; }
+
+			/**
+			 * Compile the effect program from shader files, if not already compiled.
+			 */
+			virtual void Compile() override
+			{
+				// already compiled? skip
+				if (_isCompiled) { return; }
+
+				// compile program
+				_programId = GfxOpenGL::CompileProgramFromFiles(_vertexPath.c_str(), _fragmentPath.c_str());
+				_isCompiled = true;
+				BON_DLOG("Created effect program with id: %d", _programId);
+
+				// remove from pending effects
+				_pendingEffects.erase(std::remove(_pendingEffects.begin(), _pendingEffects.end(), this), _pendingEffects.end());
+			}
+
 			/**
 			 * Get uniform location from program.
 			 */
@@ -154,13 +311,127 @@ namespace bon
 				return ret;
 			}
 
+			/**
+			 * Resolve a uniform by name and return its handle.
+			 */
+			virtual UniformHandle GetUniformHandle(const char* name) override
+			{
+				UniformHandle ret;
+				auto found = _uniformsIndex.find(name);
+				if (found != _uniformsIndex.end())
+				{
+					ret.Id = found->second;
+					return ret;
+				}
+				ret.Id = (int)_uniforms.size();
+				_uniforms.push_back(StagedUniform());
+				_uniforms.back().Name = name;
+				_uniformsIndex[name] = ret.Id;
+				return ret;
+			}
+
+			/**
+			 * Set float uniform.
+			 */
+			virtual void SetUniformFloat(UniformHandle uniform, float value) override
+			{
+				float values[] = { value };
+				StageFloats(uniform, StagedUniformType::Float1, values);
+			}
+
+			/**
+			 * Set vector2 uniform.
+			 */
+			virtual void SetUniformVector2(UniformHandle uniform, float x, float y) override
+			{
+				float values[] = { x, y };
+				StageFloats(uniform, StagedUniformType::Float2, values);
+			}
+
+			/**
+			 * Set vector3 uniform.
+			 */
+			virtual void SetUniformVector3(UniformHandle uniform, float x, float y, float z) override
+			{
+				float values[] = { x, y, z };
+				StageFloats(uniform, StagedUniformType::Float3, values);
+			}
+
+			/**
+			 * Set vector4 uniform.
+			 */
+			virtual void SetUniformVector4(UniformHandle uniform, float x, float y, float z, float w) override
+			{
+				float values[] = { x, y, z, w };
+				StageFloats(uniform, StagedUniformType::Float4, values);
+			}
+
+			/**
+			 * Set int uniform.
+			 */
+			virtual void SetUniformInt(UniformHandle uniform, int value) override
+			{
+				int values[] = { value };
+				StageInts(uniform, StagedUniformType::Int1, values);
+			}
+
+			/**
+			 * Set vector2 uniform.
+			 */
+			virtual void SetUniformVector2(UniformHandle uniform, int x, int y) override
+			{
+				int values[] = { x, y };
+				StageInts(uniform, StagedUniformType::Int2, values);
+			}
+
+			/**
+			 * Set vector3 uniform.
+			 */
+			virtual void SetUniformVector3(UniformHandle uniform, int x, int y, int z) override
+			{
+				int values[] = { x, y, z };
+				StageInts(uniform, StagedUniformType::Int3, values);
+			}
+
+			/**
+			 * Set vector4 uniform.
+			 */
+			virtual void SetUniformVector4(UniformHandle uniform, int x, int y, int z, int w) override
+			{
+				int values[] = { x, y, z, w };
+				StageInts(uniform, StagedUniformType::Int4, values);
+			}
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			virtual void SetUniformMatrix2(UniformHandle uniform, int count, bool transpose, const float* values) override
+			{
+				StageMatrix(uniform, StagedUniformType::Matrix2, count, transpose, values, 4);
+			}
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			virtual void SetUniformMatrix3(UniformHandle uniform, int count, bool transpose, const float* values) override
+			{
+				StageMatrix(uniform, StagedUniformType::Matrix3, count, transpose, values, 9);
+			}
+
+			/**
+			 * Set a matrix uniform.
+			 */
+			virtual void SetUniformMatrix4(UniformHandle uniform, int count, bool transpose, const float* values) override
+			{
+				StageMatrix(uniform, StagedUniformType::Matrix4, count, transpose, values, 16);
+			}
+
 			/**
 			 * Set float uniform.
 			 */
 			virtual void SetUniformFloat(const char* name, float value) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformFloat(uni, value);
+				SetUniformFloat(GetUniformHandle(name), value);
 			}
 
 			/**
@@ -168,8 +439,7 @@ namespace bon
 			 */
 			virtual void SetUniformVector2(const char* name, float x, float y) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformVector2(uni, x, y);
+				SetUniformVector2(GetUniformHandle(name), x, y);
 			}
 
 			/**
@@ -177,8 +447,7 @@ namespace bon
 			 */
 			virtual void SetUniformVector3(const char* name, float x, float y, float z) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformVector3(uni, x, y, z);
+				SetUniformVector3(GetUniformHandle(name), x, y, z);
 			}
 
 			/**
@@ -186,8 +455,7 @@ namespace bon
 			 */
 			virtual void SetUniformVector4(const char* name, float x, float y, float z, float w) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformVector4(uni, x, y, z, w);
+				SetUniformVector4(GetUniformHandle(name), x, y, z, w);
 			}
 
 			/**
@@ -195,8 +463,7 @@ namespace bon
 			 */
 			virtual void SetUniformInt(const char* name, int value) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformInt(uni, value);
+				SetUniformInt(GetUniformHandle(name), value);
 			}
 
 			/**
@@ -204,8 +471,7 @@ namespace bon
 			 */
 			virtual void SetUniformVector2(const char* name, int x, int y) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformVector2(uni, x, y);
+				SetUniformVector2(GetUniformHandle(name), x, y);
 			}
 
 			/**
@@ -213,8 +479,7 @@ namespace bon
 			 */
 			virtual void SetUniformVector3(const char* name, int x, int y, int z) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformVector3(uni, x, y, z);
+				SetUniformVector3(GetUniformHandle(name), x, y, z);
 			}
 
 			/**
@@ -222,8 +487,7 @@ namespace bon
 			 */
 			virtual void SetUniformVector4(const char* name, int x, int y, int z, int w) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformVector4(uni, x, y, z, w);
+				SetUniformVector4(GetUniformHandle(name), x, y, z, w);
 			}
 
 			/**
@@ -231,8 +495,7 @@ namespace bon
 			 */
 			virtual void SetUniformMatrix2(const char* name, int count, bool transpose, const float* values) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformMatrix2(uni, count, transpose, values);
+				SetUniformMatrix2(GetUniformHandle(name), count, transpose, values);
 			}
 
 			/**
@@ -240,8 +503,7 @@ namespace bon
 			 */
 			virtual void SetUniformMatrix3(const char* name, int count, bool transpose, const float* values) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformMatrix3(uni, count, transpose, values);
+				SetUniformMatrix3(GetUniformHandle(name), count, transpose, values);
 			}
 
 			/**
@@ -249,8 +511,102 @@ namespace bon
 			 */
 			virtual void SetUniformMatrix4(const char* name, int count, bool transpose, const float* values) override
 			{
-				GLint uni = GetUniform(name);
-				GfxOpenGL::SetUniformMatrix4(uni, count, transpose, values);
+				SetUniformMatrix4(GetUniformHandle(name), count, transpose, values);
+			}
+
+			/**
+			 * Resolve a uniform block by name and return its handle.
+			 */
+			virtual UniformBlockHandle GetUniformBlockHandle(const char* name) override
+			{
+				UniformBlockHandle ret;
+				for (size_t i = 0; i < _uniformBlocks.size(); ++i)
+				{
+					if (_uniformBlocks[i].Name == name)
+					{
+						ret.Id = (int)i;
+						return ret;
+					}
+				}
+				ret.Id = (int)_uniformBlocks.size();
+				_uniformBlocks.push_back(StagedUniformBlock());
+				_uniformBlocks.back().Name = name;
+				return ret;
+			}
+
+			/**
+			 * Set uniform block data.
+			 */
+			virtual void SetUniformBlockData(UniformBlockHandle block, const void* data, size_t size) override
+			{
+				if (!block.IsValid() || block.Id >= (int)_uniformBlocks.size())
+				{
+					throw bon::InvalidValue("Invalid uniform block handle!");
+				}
+				StagedUniformBlock& staged = _uniformBlocks[block.Id];
+				const unsigned char* bytes = (const unsigned char*)data;
+				if (staged.Data.size() == size && memcmp(staged.Data.data(), bytes, size) == 0) { return; }
+				staged.Resize = staged.Data.size() != size;
+				staged.Data.assign(bytes, bytes + size);
+				staged.Dirty = true;
+			}
+
+			/**
+			 * Upload all staged uniforms that changed since last upload.
+			 */
+			virtual void FlushUniforms(bool justBound) override
+			{
+				// upload dirty uniforms
+				for (int index : _dirtyUniforms)
+				{
+					StagedUniform& uniform = _uniforms[index];
+					if (uniform.Location == UnresolvedUniform) 
+					{ 
+						uniform.Location = GetUniform(uniform.Name.c_str()); 
+					}
+					switch (uniform.Type)
+					{
+					case StagedUniformType::Float1: GfxOpenGL::SetUniformFloat(uniform.Location, uniform.Floats[0]); break;
+					case StagedUniformType::Float2: GfxOpenGL::SetUniformVector2(uniform.Location, uniform.Floats[0], uniform.Floats[1]); break;
+					case StagedUniformType::Float3: GfxOpenGL::SetUniformVector3(uniform.Location, uniform.Floats[0], uniform.Floats[1], uniform.Floats[2]); break;
+					case StagedUniformType::Float4: GfxOpenGL::SetUniformVector4(uniform.Location, uniform.Floats[0], uniform.Floats[1], uniform.Floats[2], uniform.Floats[3]); break;
+					case StagedUniformType::Int1: GfxOpenGL::SetUniformInt(uniform.Location, uniform.Ints[0]); break;
+					case StagedUniformType::Int2: GfxOpenGL::SetUniformVector2(uniform.Location, uniform.Ints[0], uniform.Ints[1]); break;
+					case StagedUniformType::Int3: GfxOpenGL::SetUniformVector3(uniform.Location, uniform.Ints[0], uniform.Ints[1], uniform.Ints[2]); break;
+					case StagedUniformType::Int4: GfxOpenGL::SetUniformVector4(uniform.Location, uniform.Ints[0], uniform.Ints[1], uniform.Ints[2], uniform.Ints[3]); break;
+					case StagedUniformType::Matrix2: GfxOpenGL::SetUniformMatrix2(uniform.Location, uniform.Count, uniform.Transpose, uniform.Matrix.data()); break;
+					case StagedUniformType::Matrix3: GfxOpenGL::SetUniformMatrix3(uniform.Location, uniform.Count, uniform.Transpose, uniform.Matrix.data()); break;
+					case StagedUniformType::Matrix4: GfxOpenGL::SetUniformMatrix4(uniform.Location, uniform.Count, uniform.Transpose, uniform.Matrix.data()); break;
+					default: break;
+					}
+					uniform.Dirty = false;
+				}
+				_dirtyUniforms.clear();
+
+				// no uniform blocks or not supported? skip
+				if (_uniformBlocks.empty() || !GfxOpenGL::SupportsUniformBuffers()) { return; }
+
+				// upload dirty uniform blocks, and rebind buffers if program was just bound (binding points are shared between programs)
+				for (StagedUniformBlock& block : _uniformBlocks)
+				{
+					if (block.Index == UnresolvedUniform)
+					{
+						block.Index = GfxOpenGL::GetUniformBlockIndex(_programId, block.Name.c_str());
+						if (block.Index >= 0) { GfxOpenGL::SetUniformBlockBinding(_programId, block.Index, (GLuint)block.Index); }
+						else { BON_WLOG("Uniform block '%s' not found in effect program.", block.Name.c_str()); }
+						justBound = true;
+					}
+					if (block.Index < 0 || block.Data.empty()) { continue; }
+					if (block.Dirty)
+					{
+						GfxOpenGL::UploadUniformBuffer(block.Buffer, block.Data.data(), block.Data.size(), block.Resize);
+						block.Dirty = block.Resize = false;
+					}
+					if (justBound)
+					{
+						GfxOpenGL::BindUniformBuffer((GLuint)block.Index, block.Buffer);
+					}
+				}
 			}
 
 			/**
@@ -336,6 +692,32 @@ namespace bon
 			}
 		}
 
+		// compile pending effects until time limit is reached
+		int GfxSdlEffects::CompilePendingEffects(double maxTime)
+		{
+			// nothing to compile?
+			if (_pendingEffects.empty()) { return 0; }
+
+			// compile effects until out of time
+			Uint64 start = SDL_GetPerformanceCounter();
+			double frequency = (double)SDL_GetPerformanceFrequency();
+			BON_DLOG("Warm up effects: %d effects are waiting to be compiled.", (int)_pendingEffects.size());
+			while (!_pendingEffects.empty())
+			{
+				// note: compiling effect removes it from pending list
+				_pendingEffects.back()->Compile();
+
+				// check time limit
+				if (maxTime > 0 && ((double)(SDL_GetPerformanceCounter() - start) / frequency) >= maxTime)
+				{
+					break;
+				}
+			}
+
+			// return how many effects are left
+			return (int)_pendingEffects.size();
+		}
+
 		// Load and return default shader.
 		EffectAsset GfxSdlEffects::LoadDefaultProgram()
 		{
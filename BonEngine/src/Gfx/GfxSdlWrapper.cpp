@@ -1,5 +1,6 @@
 #include <Gfx/GfxSdlWrapper.h>
 #include <Gfx/GfxOpenGL.h>
+#include <Gfx/GfxTextureCache.h>
 #include <Log/ILog.h>
 #include <Framework/Exceptions.h>
 #include <Assets/Defs.h>
@@ -9,6 +10,9 @@
 #include <Gfx/Defs.h>
 #include <BonEngine.h>
 #include <unordered_map>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
 
 #pragma warning(push, 0)
 #include <SDL2-2.0.12/include/SDL.h>
@@ -43,6 +47,9 @@ namespace bon
 			// if we want to read image pixels - convert it to surface
 			SDL_Surface* _asSurface = nullptr;
 
+			// streaming state, if this image is loaded progressively
+			std::shared_ptr<StreamedTexture> _streamed;
+
 		public:
 
 			/**
@@ -62,6 +69,10 @@ namespace bon
 			 */
 			virtual ~SDL_ImageHandle()
 			{
+				if (_streamed)
+				{
+					_wrapper->TextureStreamer().Remove(_streamed.get());
+				}
 				if (Texture) 
 				{
 					SDL_DestroyTexture((SDL_Texture*)(Texture));
@@ -102,6 +113,36 @@ namespace bon
 				return _alpha;
 			}
 
+			/**
+			 * Get texture memory, in bytes (for streamed images, only the level currently in texture).
+			 */
+			virtual size_t MemoryUsage() const override
+			{
+				return _streamed ? (size_t)_streamed->TextureWidth * (size_t)_streamed->TextureHeight * 4 : (size_t)_w * (size_t)_h * 4;
+			}
+
+			/**
+			 * Set streaming state, for images loaded progressively.
+			 */
+			inline void SetStreamed(const std::shared_ptr<StreamedTexture>& streamed)
+			{
+				_streamed = streamed;
+			}
+
+			/**
+			 * Get streaming state, or nullptr if image is not streamed.
+			 */
+			inline StreamedTexture* Streamed() const
+			{
+				return _streamed.get();
+			}
+
+			/**
+			 * Get actual texture size (streamed images texture only holds the currently needed level).
+			 */
+			inline int TextureWidth() const { return _streamed ? _streamed->TextureWidth : _w; }
+			inline int TextureHeight() const { return _streamed ? _streamed->TextureHeight : _h; }
+
 			/**
 			 * Save image asset to file.
 			 *
@@ -109,7 +150,7 @@ namespace bon
 			 */
 			virtual void SaveToFile(const char* filename) const override
 			{
-				_wrapper->SaveImageToFile((SDL_Texture*)Texture, _w, _h, filename);
+				_wrapper->SaveImageToFile((SDL_Texture*)Texture, TextureWidth(), TextureHeight(), filename);
 			}
 
 			/**
@@ -125,7 +166,7 @@ namespace bon
 				}
 
 				// get new surface
-				_asSurface = _wrapper->TextureToSurface((SDL_Texture*)Texture, _w, _h, sourceRect);
+				_asSurface = _wrapper->TextureToSurface((SDL_Texture*)Texture, TextureWidth(), TextureHeight(), sourceRect);
 			}
 
 			/**
@@ -146,7 +187,7 @@ namespace bon
 			 */
 			virtual void Clear() override
 			{
-				_wrapper->ClearTexture((SDL_Texture*)Texture, Width(), Height());
+				_wrapper->ClearTexture((SDL_Texture*)Texture, TextureWidth(), TextureHeight());
 			}
 
 			/**
@@ -225,25 +266,84 @@ namespace bon
 			// get asset path
 			const char* path = asset->Path();
 			
+			// stream image progressively?
+			if (path != nullptr && path[0] != '\0' && extraData != nullptr && *((ImageStreaming*)extraData) == ImageStreaming::Progressive)
+			{
+				GfxSdlWrapper* wrapper = (GfxSdlWrapper*)context;
+				int fullWidth; int fullHeight;
+				if (GfxTextureStreamer::ReadImageSize(path, fullWidth, fullHeight))
+				{
+					SDL_ImageHandle* handle = new SDL_ImageHandle(nullptr, fullWidth, fullHeight, true, wrapper);
+					auto streamed = wrapper->TextureStreamer().Create(path, fullWidth, fullHeight, ((bon::assets::_Image*)asset)->FilteringMode(), handle);
+					if (streamed != nullptr)
+					{
+						handle->SetStreamed(streamed);
+						asset->_SetHandle(handle);
+						return;
+					}
+					delete handle;
+				}
+				BON_WLOG("Can't stream image '%s' (unknown format or failed to create placeholder). Will load it normally.", path);
+			}
+
 			// load texture from file
 			if (path != nullptr && path[0] != '\0') 
 			{
+				// try to load decoded pixels from textures cache
+				CachedImagePixels cached;
+				bool useCache = GfxTextureCache::IsEnabled();
+				if (useCache && GfxTextureCache::Load(path, cached))
+				{
+					BON_DLOG("Load image from textures cache: %s.", path);
+				}
 				// load image and make sure succeed
-				BON_DLOG("Load image from file: %s.", path);
-				SDL_Surface* surface = nullptr;
-				surface = IMG_Load(path);
-				if (surface == nullptr)
+				else
 				{
-					printf("Unable to load image %s! SDL Error: %s\n", path, SDL_GetError());
-					throw AssetLoadError(path);
+					BON_DLOG("Load image from file: %s.", path);
+					SDL_Surface* surface = nullptr;
+					surface = IMG_Load(path);
+					if (surface == nullptr)
+					{
+						printf("Unable to load image %s! SDL Error: %s\n", path, SDL_GetError());
+						throw AssetLoadError(path);
+					}
+
+					// no cache? convert surface to texture directly
+					if (!useCache)
+					{
+						width = surface->w;
+						height = surface->h;
+						haveAlpha = GfxTextureCache::HaveAlpha(surface);
+						texture = SDL_CreateTextureFromSurface(((GfxSdlWrapper*)context)->GetRenderer(), surface);
+						SDL_FreeSurface(surface);
+					}
+					// convert to RGBA pixels and store in cache
+					else
+					{
+						bool converted = GfxTextureCache::FromSurface(surface, cached);
+						SDL_FreeSurface(surface);
+						if (!converted)
+						{
+							BON_ELOG("Unable to convert image %s! SDL Error: %s", path, SDL_GetError());
+							throw AssetLoadError(path);
+						}
+						GfxTextureCache::Save(path, cached);
+					}
 				}
 
-				// convert to texture
-				width = surface->w;
-				height = surface->h;
-				if (surface->format->Amask) { haveAlpha = true; }
-				texture = SDL_CreateTextureFromSurface(((GfxSdlWrapper*)context)->GetRenderer(), surface);
-				SDL_FreeSurface(surface);
+				// create texture from cached pixels
+				if (useCache)
+				{
+					width = cached.Width;
+					height = cached.Height;
+					haveAlpha = cached.HaveAlpha;
+					texture = SDL_CreateTexture(((GfxSdlWrapper*)context)->GetRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
+					if (texture != nullptr)
+					{
+						SDL_UpdateTexture(texture, nullptr, cached.Pixels.data(), width * 4);
+						SDL_SetTextureBlendMode(texture, haveAlpha ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+					}
+				}
 			}
 			// create empty texture
 			else 
@@ -369,6 +469,10 @@ namespace bon
 		// default effect for drawing shapes
 		EffectAsset _defaultEffectShapes = nullptr;
 
+		// default effects uniform handles
+		UniformHandle _shapeColorUniform;
+		UniformHandle _extraAlphaUniform;
+
 		// initialize graphics
 		void GfxSdlWrapper::Initialize()
 		{
@@ -618,6 +722,13 @@ namespace bon
 		// dispose basic stuff
 		void GfxSdlWrapper::Dispose()
 		{
+			if (_renderer) {
+				_textureStreamer.Stop();
+				GfxTextureCache::StopWorkers();
+				_uploadQueue.Dispose();
+				_frameCapture.Stop();
+				_readbacks.Dispose();
+			}
 			if (_window) {
 				SDL_DestroyWindow(_window);
 				_window = nullptr;
@@ -693,12 +804,23 @@ namespace bon
 			// init effects manager
 			_effectsImpl.Initialize(_renderer);
 
+			// init async readbacks and frames capture
+			_readbacks.Initialize(_renderer);
+			_frameCapture.Initialize(&_readbacks);
+
+			// start streaming images
+			_textureStreamer.Start(this);
+
 			// init default effect
 			_defaultEffect = _effectsImpl.LoadDefaultProgram();
 
 			// init default shapes effect
 			_defaultEffectShapes = _effectsImpl.LoadDefaultShapesProgram();
 
+			// get default effects uniforms
+			_shapeColorUniform = _defaultEffectShapes->GetUniformHandle("shape_color");
+			_extraAlphaUniform = _defaultEffect->GetUniformHandle("extra_a");
+
 			// use default effect
 			RestoreDefaultEffect();
 		}
@@ -737,7 +859,10 @@ namespace bon
 		void GfxSdlWrapper::SetShapesColor(const framework::Color& color)
 		{
 			//SDL_SetRenderDrawColor(_renderer, 255, 255, 255, 255);
-			_defaultEffectShapes->SetUniformVector4("shape_color", color.R, color.G, color.B, color.A);
+			_defaultEffectShapes->SetUniformVector4(_shapeColorUniform, color.R, color.G, color.B, color.A);
+
+			// upload staged uniforms before drawing
+			_currentEffect->Handle()->FlushUniforms(false);
 		}
 
 		// use default textures effect
@@ -760,6 +885,12 @@ namespace bon
 			SetCurrentEffectFromAsset(_defaultEffect);
 		}
 
+		// compile effects that are waiting for lazy compilation
+		int GfxSdlWrapper::WarmUpEffects(double maxTime)
+		{
+			return _effectsImpl.CompilePendingEffects(maxTime);
+		}
+
 		// get current effect handle.
 		void* GfxSdlWrapper::GetCurrentEffectHandle()
 		{
@@ -780,9 +911,11 @@ namespace bon
 			{
 				lastRotation = (float)-9999999999999;
 				lastAnchor.Set((float)-9999999999, (float)-9999999999);
+				if (!effect->IsCompiled()) { effect->Compile(); }
 				GLuint program = *((GLuint*)effect->Handle()->GetProgramHandle());
 				GfxOpenGL::SetShaderProgram(program);
 				_currentEffect = effect;
+				_currentEffect->Handle()->FlushUniforms(true);
 				RestoreDefaultStates();
 			}
 		}
@@ -791,20 +924,57 @@ namespace bon
 		void GfxSdlWrapper::RestoreDefaultStates()
 		{
 			GfxOpenGL::SetBlendMode(BlendModes::Opaque);
+			ApplyClipRect();
 			SDL_RenderDrawPoint(_renderer, -1, -1);
+			GfxOpenGL::SetDrawOffset(_drawOffset.X, _drawOffset.Y);
+		}
+
+		// apply clipping rect to renderer
+		void GfxSdlWrapper::ApplyClipRect()
+		{
+			// note: SDL resets clipping when render target changes, and handles flipping to GL scissor coordinates
+			if (_hasClipRect)
+			{
+				SDL_Rect rect;
+				rect.x = _clipRect.X + _drawOffset.X;
+				rect.y = _clipRect.Y + _drawOffset.Y;
+				rect.w = std::max(_clipRect.Width, 0);
+				rect.h = std::max(_clipRect.Height, 0);
+				SDL_RenderSetClipRect(_renderer, &rect);
+			}
+			else
+			{
+				SDL_RenderSetClipRect(_renderer, nullptr);
+			}
 		}
 
 		// update window / draw.
 		void GfxSdlWrapper::UpdateWindow()
 		{
+			// capture frame before presenting it
+			if (_frameCapture.IsCapturing())
+			{
+				int w; int h;
+				SDL_GetRendererOutputSize(_renderer, &w, &h);
+				_frameCapture.OnFrameRendered(w, h);
+			}
+
 			// render screen
 			SDL_RenderPresent(_renderer);
 
+			// complete async readbacks that are ready, and pass captured frames to encoders
+			_readbacks.Update();
+			_frameCapture.Update();
+
 			// update effects
 			RestoreDefaultEffect();
 
 			// update cache
 			fontsTextureCache.Update();
+
+			// queue streamed images levels and request the levels needed for next frames, then upload within frame budget
+			_textureStreamer.Update();
+			_uploadQueue.Update();
 		}
 
 		// show / hide cursor
@@ -917,13 +1087,29 @@ namespace bon
 		// render screen to surface
 		assets::_ImageHandle* GfxSdlWrapper::RenderScreenToImage() const
 		{
-			// get current render target and set texture as the new render target
+			// get current render target
 			SDL_Texture* target = SDL_GetRenderTarget(_renderer);
-			SDL_SetRenderTarget(_renderer, NULL);
 
-			// calc source rect / surface size
+			// calc image size
 			int w; int h;
 			SDL_GetWindowSize(_window, &w, &h);
+
+			// if supported, copy screen into a new render target texture without leaving the GPU
+			if (GfxOpenGL::SupportsFramebufferBlit())
+			{
+				int screenW; int screenH;
+				SDL_GetRendererOutputSize(_renderer, &screenW, &screenH);
+				SDL_Texture* ret = SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, w, h);
+				SDL_SetRenderTarget(_renderer, ret);
+				GfxOpenGL::BlitScreenToCurrentTarget(screenW, screenH, w, h);
+				SDL_SetRenderTarget(_renderer, target);
+				return new SDL_ImageHandle(ret, w, h, true, (GfxSdlWrapper*)this);
+			}
+
+			// set screen as render target
+			SDL_SetRenderTarget(_renderer, NULL);
+
+			// calc source rect / surface size
 			SDL_Rect rect;
 			rect.x = 0;
 			rect.y = 0;
@@ -945,6 +1131,31 @@ namespace bon
 			return new SDL_ImageHandle(ret, w, h, true, (GfxSdlWrapper*)this);
 		}
 
+		// request to read pixels without waiting for the GPU
+		PixelsReadback GfxSdlWrapper::ReadPixelsAsync(SDL_Texture* texture, int width, int height, const framework::RectangleI& sourceRect, const char* saveToFile)
+		{
+			// reading from screen? use renderer output size
+			if (texture == nullptr)
+			{
+				SDL_GetRendererOutputSize(_renderer, &width, &height);
+			}
+			return _readbacks.Request(texture, width, height, sourceRect, saveToFile);
+		}
+
+		// start capturing frames
+		void GfxSdlWrapper::StartFrameCapture(const FrameCaptureSettings& settings)
+		{
+			int w; int h;
+			SDL_GetRendererOutputSize(_renderer, &w, &h);
+			_frameCapture.Start(settings, w, h);
+		}
+
+		// stop capturing frames
+		void GfxSdlWrapper::StopFrameCapture()
+		{
+			_frameCapture.Stop();
+		}
+
 		// draw texture on screen
 		void GfxSdlWrapper::DrawTextAsTexture(SDL_Texture* texture, const PointF& position, const PointI& size, BlendModes blend, const RectangleI* sourceRect, const PointF& origin, float rotation, Color color, RectangleI* outDestRect, bool dryrun, int textW, int textH)
 		{
@@ -989,6 +1200,36 @@ namespace bon
 			}
 		}
 
+		// set drawing offset
+		void GfxSdlWrapper::SetDrawOffset(const framework::PointI& offset)
+		{
+			_drawOffset = offset;
+			GfxOpenGL::SetDrawOffset(offset.X, offset.Y);
+
+			// clipping rect is in drawing coordinates, so it moves with the offset
+			if (_hasClipRect) 
+			{ 
+				ApplyClipRect(); 
+				SDL_RenderDrawPoint(_renderer, -1, -1);
+			}
+		}
+
+		// set clipping rect
+		void GfxSdlWrapper::SetClipRect(const framework::RectangleI* clipRect)
+		{
+			// skip if didn't change
+			if (!clipRect && !_hasClipRect) { return; }
+			if (clipRect && _hasClipRect && *clipRect == _clipRect) { return; }
+
+			// set and apply clipping
+			// note: draw a point outside the screen to make SDL flush the scissor state to GL, since we draw with GL directly
+			_hasClipRect = clipRect != nullptr;
+			if (clipRect) { _clipRect = *clipRect; }
+			ApplyClipRect();
+			SDL_RenderDrawPoint(_renderer, -1, -1);
+			GfxOpenGL::SetDrawOffset(_drawOffset.X, _drawOffset.Y);
+		}
+
 		// get default size or default if 0,0
 		const PointI& SizeOrDefault(const PointI& size, const RectangleI* sourceRect, const ImageAsset& sourceImage)
 		{
@@ -1013,7 +1254,7 @@ namespace bon
 		}
 
 		// handle images without alpha channels by adding alpha of 1
-		void GfxSdlWrapper::HandleImagesWithoutAlpha(assets::ImageAsset image)
+		void GfxSdlWrapper::HandleImagesWithoutAlpha(const assets::_Image* image)
 		{
 			if (_currentEffect == _defaultEffect)
 			{
@@ -1022,16 +1263,19 @@ namespace bon
 				{
 					if (!_lastExtraA) 
 					{
-						_currentEffect->SetUniformFloat("extra_a", 1);
+						_currentEffect->SetUniformFloat(_extraAlphaUniform, 1);
 						_lastExtraA = true;
 					}
 				}
 				else if (_lastExtraA)
 				{
-					_currentEffect->SetUniformFloat("extra_a", 0);
+					_currentEffect->SetUniformFloat(_extraAlphaUniform, 0);
 					_lastExtraA = false;
 				}
 			}
+
+			// upload staged uniforms before drawing
+			_currentEffect->Handle()->FlushUniforms(false);
 		}
 
 		// draw image on screen
@@ -1041,7 +1285,7 @@ namespace bon
 			UseDefaultTexturesEffect(true);
 
 			// fix alpha for images without alpha channel
-			HandleImagesWithoutAlpha(sourceImage);
+			HandleImagesWithoutAlpha(sourceImage.get());
 
 			// get image handle
 			SDL_ImageHandle* handle = (SDL_ImageHandle*)sourceImage->Handle();
@@ -1051,6 +1295,12 @@ namespace bon
 			
 			// draw texture
 			const PointI& sizeOrDefault = SizeOrDefault(size, sourceRect, sourceImage);
+			if (handle->Streamed())
+			{
+				int sourceWidth = (sourceRect && sourceRect->Width != 0) ? sourceRect->Width : handle->Width();
+				int sourceHeight = (sourceRect && sourceRect->Height != 0) ? sourceRect->Height : handle->Height();
+				handle->Streamed()->OnDraw(std::abs((float)sizeOrDefault.X) * handle->Width() / sourceWidth, std::abs((float)sizeOrDefault.Y) * handle->Height() / sourceHeight);
+			}
 			GfxOpenGL::DrawTexture(position, sizeOrDefault, sourceRect, texture, color, handle->Width(), handle->Height(), blend, _currentEffect->UseTexture(), _currentEffect->UseVertexColor(), _currentEffect->FlipTextureCoordsV(), origin, rotation);
 		}
 
@@ -1061,7 +1311,7 @@ namespace bon
 			UseDefaultTexturesEffect(true);
 
 			// fix alpha for images without alpha channel
-			HandleImagesWithoutAlpha(sourceImage);
+			HandleImagesWithoutAlpha(sourceImage.get());
 
 			// get image handle
 			SDL_ImageHandle* handle = (SDL_ImageHandle*)sourceImage->Handle();
@@ -1072,6 +1322,10 @@ namespace bon
 			// draw with effect
 			static Color color(1, 1, 1, 1);
 			const PointI& sizeOrDefault = SizeOrDefault(size, nullptr, sourceImage);
+			if (handle->Streamed())
+			{
+				handle->Streamed()->OnDraw(std::abs((float)sizeOrDefault.X), std::abs((float)sizeOrDefault.Y));
+			}
 			GfxOpenGL::DrawTexture(position, sizeOrDefault, nullptr, texture, color, handle->Width(), handle->Height(), blend, _currentEffect->UseTexture(), _currentEffect->UseVertexColor(), _currentEffect->FlipTextureCoordsV(), PointF::Zero, 0);
 		}
 	}
@@ -0,0 +1,734 @@
+#include <Gfx/GfxTextureCache.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+namespace fs = std::filesystem;
+
+namespace bon
+{
+	namespace gfx
+	{
+		/**
+		 * Texture cache file header.
+		 */
+		struct TextureCacheHeader
+		{
+			// magic value + version
+			uint32_t Magic;
+			uint32_t Version;
+
+			// image size
+			uint32_t Width;
+			uint32_t Height;
+
+			// flags (bit 0 = have alpha)
+			uint32_t Flags;
+
+			// pixels codec (0 = raw, 1 = lz4 block)
+			uint32_t Codec;
+
+			// source file size, modification time and content hash
+			uint64_t SourceSize;
+			int64_t SourceMTime;
+			uint64_t SourceHash;
+
+			// uncompressed size of every chunk (last chunk may be smaller) and chunks count
+			uint32_t ChunkRawSize;
+			uint32_t ChunksCount;
+		};
+		static_assert(sizeof(TextureCacheHeader) == 56, "Texture cache header must be 56 bytes, to match cache files written by tools.");
+
+		// magic value for texture cache files ('BTXC') and current version
+		const uint32_t _textureCacheMagic = 0x43585442;
+		const uint32_t _textureCacheVersion = 1;
+
+		// texture cache codecs
+		const uint32_t _codecRaw = 0;
+		const uint32_t _codecLz4 = 1;
+
+		// uncompressed size of every pixels chunk
+		const uint32_t _chunkRawSize = 256 * 1024;
+
+		// texture cache flags
+		const uint32_t _flagHaveAlpha = 1;
+
+		/**
+		 * Hash data with FNV-1a.
+		 */
+		inline uint64_t fnv1aHash(const char* data, size_t length, uint64_t hash = 14695981039346656037ULL)
+		{
+			for (size_t i = 0; i < length; ++i)
+			{
+				hash ^= (unsigned char)data[i];
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		/**
+		 * Get texture cache file path from source image path and level.
+		 * Path separators are normalized, so cache built on one platform will work on others. Levels after the first add '#level' to the key.
+		 */
+		std::string textureCachePath(const char* path, int level)
+		{
+			std::string key(path);
+			std::replace(key.begin(), key.end(), '\\', '/');
+			if (level > 0) { key += "#" + std::to_string(level); }
+			char filename[32];
+			snprintf(filename, sizeof(filename), "%016llx.btc", (unsigned long long)fnv1aHash(key.c_str(), key.length()));
+			return fs::path(GfxTextureCache::Folder()).append(filename).u8string();
+		}
+
+		/**
+		 * Get source file size and modification time.
+		 */
+		bool getSourceInfo(const char* path, uint64_t& size, int64_t& mtime)
+		{
+			std::error_code err;
+			size = (uint64_t)fs::file_size(path, err);
+			if (err) { return false; }
+			auto time = fs::last_write_time(path, err);
+			if (err) { return false; }
+			mtime = (int64_t)time.time_since_epoch().count();
+			return true;
+		}
+
+		/**
+		 * Hash source file content.
+		 */
+		bool hashSourceFile(const char* path, uint64_t& hash)
+		{
+			std::ifstream file(path, std::ios::in | std::ios::binary);
+			if (!file.good()) { return false; }
+			hash = 14695981039346656037ULL;
+			char buffer[64 * 1024];
+			while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+			{
+				hash = fnv1aHash(buffer, (size_t)file.gcount(), hash);
+			}
+			return true;
+		}
+
+		/**
+		 * Read-only memory mapped file.
+		 */
+		class MappedFile
+		{
+		private:
+			const unsigned char* _data = nullptr;
+			size_t _size = 0;
+#ifdef _WIN32
+			HANDLE _file = INVALID_HANDLE_VALUE;
+			HANDLE _mapping = NULL;
+#endif
+
+		public:
+
+			/**
+			 * Map file to memory. Check 'Data()' to see if succeeded.
+			 */
+			MappedFile(const std::string& path)
+			{
+#ifdef _WIN32
+				_file = CreateFileW(fs::u8path(path).wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+				if (_file == INVALID_HANDLE_VALUE) { return; }
+				LARGE_INTEGER size;
+				if (!GetFileSizeEx(_file, &size) || size.QuadPart == 0) { return; }
+				_mapping = CreateFileMappingW(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+				if (_mapping == NULL) { return; }
+				_data = (const unsigned char*)MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+				if (_data) { _size = (size_t)size.QuadPart; }
+#else
+				int file = open(path.c_str(), O_RDONLY);
+				if (file < 0) { return; }
+				struct stat info;
+				if (fstat(file, &info) == 0 && info.st_size > 0)
+				{
+					void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+					if (data != MAP_FAILED)
+					{
+						_data = (const unsigned char*)data;
+						_size = (size_t)info.st_size;
+					}
+				}
+				close(file);
+#endif
+			}
+
+			/**
+			 * Unmap file.
+			 */
+			~MappedFile()
+			{
+#ifdef _WIN32
+				if (_data) { UnmapViewOfFile(_data); }
+				if (_mapping != NULL) { CloseHandle(_mapping); }
+				if (_file != INVALID_HANDLE_VALUE) { CloseHandle(_file); }
+#else
+				if (_data) { munmap((void*)_data, _size); }
+#endif
+			}
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			/**
+			 * Get file data (nullptr if failed to map).
+			 */
+			inline const unsigned char* Data() const { return _data; }
+
+			/**
+			 * Get file size.
+			 */
+			inline size_t Size() const { return _size; }
+		};
+
+		/**
+		 * A function to run for every chunk, split between the calling thread and worker threads.
+		 */
+		struct ChunksJob
+		{
+			// function to run on every chunk. returns false on failure
+			std::function<bool(size_t)> Func;
+			size_t ChunksCount = 0;
+
+			// next chunk to take, and did all chunks succeed so far
+			std::atomic<size_t> NextChunk{ 0 };
+			std::atomic<bool> Success{ true };
+
+			// workers currently working on this job (under workers mutex)
+			int Workers = 0;
+
+			/**
+			 * Take and run chunks until there are none left.
+			 */
+			void Work()
+			{
+				size_t i;
+				while ((i = NextChunk.fetch_add(1)) < ChunksCount)
+				{
+					if (!Func(i)) { Success = false; }
+				}
+			}
+		};
+
+		/**
+		 * Persistent worker threads to compress and decompress cache chunks, so we don't spawn threads for every image.
+		 */
+		class ChunksWorkers
+		{
+		private:
+			std::vector<std::thread> _threads;
+			std::deque<ChunksJob*> _jobs;
+			std::mutex _mutex;
+			std::condition_variable _wakeUp;
+			std::condition_variable _workerDone;
+			bool _running = false;
+
+			/**
+			 * Worker thread loop.
+			 */
+			void WorkerLoop()
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				while (true)
+				{
+					_wakeUp.wait(lock, [this]() { return !_running || !_jobs.empty(); });
+					if (!_running) { return; }
+
+					// job has no chunks left to take? remove it from queue
+					ChunksJob* job = _jobs.front();
+					if (job->NextChunk.load() >= job->ChunksCount)
+					{
+						_jobs.pop_front();
+						continue;
+					}
+
+					// help with the job. job owner waits for us before returning, so job stays valid until we decrease workers count
+					job->Workers++;
+					lock.unlock();
+					job->Work();
+					lock.lock();
+					job->Workers--;
+					_workerDone.notify_all();
+				}
+			}
+
+		public:
+
+			/**
+			 * Stop workers on destruction.
+			 */
+			~ChunksWorkers()
+			{
+				Stop();
+			}
+
+			/**
+			 * Run job on calling thread and worker threads, and wait for it to finish.
+			 * Starts worker threads on first call.
+			 */
+			bool Run(ChunksJob& job)
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				if (!_running)
+				{
+					_running = true;
+					unsigned int workersCount = (std::max)(std::thread::hardware_concurrency(), 1u) - 1;
+					for (unsigned int i = 0; i < workersCount; ++i)
+					{
+						_threads.push_back(std::thread(&ChunksWorkers::WorkerLoop, this));
+					}
+				}
+
+				// no workers or nothing to split? do it on calling thread
+				if (_threads.empty() || job.ChunksCount <= 1)
+				{
+					lock.unlock();
+					job.Work();
+					return job.Success;
+				}
+
+				// add job for workers and work on it ourselves
+				_jobs.push_back(&job);
+				lock.unlock();
+				_wakeUp.notify_all();
+				job.Work();
+
+				// no chunks left to take - remove job from queue and wait for workers still running its chunks
+				lock.lock();
+				auto queued = std::find(_jobs.begin(), _jobs.end(), &job);
+				if (queued != _jobs.end()) { _jobs.erase(queued); }
+				_workerDone.wait(lock, [&job]() { return job.Workers == 0; });
+				return job.Success;
+			}
+
+			/**
+			 * Stop and join worker threads.
+			 */
+			void Stop()
+			{
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_running = false;
+				}
+				_wakeUp.notify_all();
+				for (auto& thread : _threads)
+				{
+					thread.join();
+				}
+				_threads.clear();
+			}
+		};
+
+		// cache worker threads
+		ChunksWorkers _chunksWorkers;
+
+		/**
+		 * Run a function for every chunk, split between worker threads.
+		 * Function returns false on failure.
+		 */
+		bool forEachChunk(size_t chunksCount, std::function<bool(size_t)> func)
+		{
+			ChunksJob job;
+			job.Func = std::move(func);
+			job.ChunksCount = chunksCount;
+			return _chunksWorkers.Run(job);
+		}
+
+		// check if texture cache is enabled
+		bool GfxTextureCache::IsEnabled()
+		{
+			return bon::Features().TextureCacheFolder != nullptr;
+		}
+
+		// get cache folder
+		std::string GfxTextureCache::Folder()
+		{
+			if (IsEnabled()) { return bon::Features().TextureCacheFolder; }
+			std::error_code err;
+			return (fs::temp_directory_path(err) / "BonEngineTextureCache").u8string();
+		}
+
+		// check if decoded image has transparency
+		bool GfxTextureCache::HaveAlpha(SDL_Surface* surface)
+		{
+			return surface->format->Amask != 0 || SDL_HasColorKey(surface);
+		}
+
+		// convert decoded image to rgba pixels
+		bool GfxTextureCache::FromSurface(SDL_Surface* surface, CachedImagePixels& out)
+		{
+			SDL_Surface* rgba = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+			if (rgba == nullptr) { return false; }
+			out.HaveAlpha = HaveAlpha(surface);
+			out.Width = rgba->w;
+			out.Height = rgba->h;
+			out.Pixels.resize((size_t)rgba->w * rgba->h * 4);
+			SDL_LockSurface(rgba);
+			for (int y = 0; y < rgba->h; ++y)
+			{
+				memcpy(out.Pixels.data() + (size_t)y * rgba->w * 4, (unsigned char*)rgba->pixels + (size_t)y * rgba->pitch, (size_t)rgba->w * 4);
+			}
+			SDL_UnlockSurface(rgba);
+			SDL_FreeSurface(rgba);
+			return true;
+		}
+
+		// stop worker threads
+		void GfxTextureCache::StopWorkers()
+		{
+			_chunksWorkers.Stop();
+		}
+
+		// load image pixels from cache
+		bool GfxTextureCache::Load(const char* path, CachedImagePixels& out, int level)
+		{
+			// get source file info
+			uint64_t sourceSize = 0;
+			int64_t sourceMTime = 0;
+			if (!getSourceInfo(path, sourceSize, sourceMTime)) { return false; }
+
+			// map cached file
+			std::string cachePath = textureCachePath(path, level);
+			TextureCacheHeader header;
+			bool updateMTime = false;
+			{
+				MappedFile file(cachePath);
+				if (file.Data() == nullptr) { return false; }
+
+				// read and validate header
+				if (file.Size() < sizeof(header))
+				{
+					BON_WLOG("Invalid texture cache file: %s", cachePath.c_str());
+					return false;
+				}
+				memcpy(&header, file.Data(), sizeof(header));
+				if (header.Magic != _textureCacheMagic || header.Version != _textureCacheVersion ||
+					(header.Codec != _codecRaw && header.Codec != _codecLz4) || header.ChunkRawSize == 0)
+				{
+					BON_WLOG("Invalid texture cache file: %s", cachePath.c_str());
+					return false;
+				}
+				size_t rawSize = (size_t)header.Width * header.Height * 4;
+				if (header.ChunksCount != (rawSize + header.ChunkRawSize - 1) / header.ChunkRawSize)
+				{
+					BON_WLOG("Invalid texture cache file: %s", cachePath.c_str());
+					return false;
+				}
+
+				// validate source file didn't change. if only modification time changed (copied, checked out, or prebuilt cache), compare content hash instead
+				if (header.SourceSize != sourceSize) { return false; }
+				if (header.SourceMTime != sourceMTime)
+				{
+					uint64_t sourceHash = 0;
+					if (!hashSourceFile(path, sourceHash) || sourceHash != header.SourceHash) { return false; }
+					updateMTime = true;
+				}
+
+				// get chunks table and data offsets
+				size_t tableSize = (size_t)header.ChunksCount * sizeof(uint32_t);
+				if (file.Size() - sizeof(header) < tableSize)
+				{
+					BON_WLOG("Corrupted texture cache file: %s", cachePath.c_str());
+					return false;
+				}
+				std::vector<uint32_t> chunkSizes(header.ChunksCount);
+				memcpy(chunkSizes.data(), file.Data() + sizeof(header), tableSize);
+				std::vector<size_t> chunkOffsets(header.ChunksCount);
+				size_t dataOffset = sizeof(header) + tableSize;
+				for (size_t i = 0; i < chunkSizes.size(); ++i)
+				{
+					chunkOffsets[i] = dataOffset;
+					dataOffset += chunkSizes[i];
+				}
+				if (dataOffset > file.Size())
+				{
+					BON_WLOG("Corrupted texture cache file: %s", cachePath.c_str());
+					return false;
+				}
+
+				// decompress chunks straight from mapped file on worker threads
+				const unsigned char* data = file.Data();
+				out.Pixels.resize(rawSize);
+				bool success = forEachChunk(header.ChunksCount, [&](size_t i)
+				{
+					size_t rawOffset = i * header.ChunkRawSize;
+					size_t chunkRawSize = (std::min)((size_t)header.ChunkRawSize, rawSize - rawOffset);
+					if (header.Codec == _codecRaw)
+					{
+						if (chunkSizes[i] != chunkRawSize) { return false; }
+						memcpy(out.Pixels.data() + rawOffset, data + chunkOffsets[i], chunkRawSize);
+						return true;
+					}
+					return Decompress(data + chunkOffsets[i], chunkSizes[i], out.Pixels.data() + rawOffset, chunkRawSize);
+				});
+				if (!success)
+				{
+					BON_WLOG("Corrupted texture cache file: %s", cachePath.c_str());
+					out.Pixels.clear();
+					return false;
+				}
+			}
+
+			// content is the same but modification time changed - update it, so next time we can skip hashing
+			if (updateMTime)
+			{
+				std::fstream update(cachePath, std::ios::in | std::ios::out | std::ios::binary);
+				if (update.good())
+				{
+					header.SourceMTime = sourceMTime;
+					update.write((const char*)&header, sizeof(header));
+				}
+			}
+
+			// success!
+			out.Width = (int)header.Width;
+			out.Height = (int)header.Height;
+			out.HaveAlpha = (header.Flags & _flagHaveAlpha) != 0;
+			out.SourceHash = header.SourceHash;
+			BON_DLOG("Loaded image from texture cache: %s", cachePath.c_str());
+			return true;
+		}
+
+		// save image pixels to cache
+		void GfxTextureCache::Save(const char* path, CachedImagePixels& image, int level)
+		{
+			// build header
+			TextureCacheHeader header = {};
+			header.Magic = _textureCacheMagic;
+			header.Version = _textureCacheVersion;
+			header.Width = (uint32_t)image.Width;
+			header.Height = (uint32_t)image.Height;
+			header.Flags = image.HaveAlpha ? _flagHaveAlpha : 0;
+			header.Codec = _codecLz4;
+			header.ChunkRawSize = _chunkRawSize;
+			if (!getSourceInfo(path, header.SourceSize, header.SourceMTime)) { return; }
+			if (image.SourceHash == 0 && !hashSourceFile(path, image.SourceHash)) { return; }
+			header.SourceHash = image.SourceHash;
+
+			// compress chunks on worker threads
+			size_t rawSize = (size_t)image.Width * image.Height * 4;
+			if (image.Pixels.size() < rawSize) { return; }
+			header.ChunksCount = (uint32_t)((rawSize + _chunkRawSize - 1) / _chunkRawSize);
+			std::vector<std::vector<unsigned char>> chunks(header.ChunksCount);
+			std::vector<uint32_t> chunkSizes(header.ChunksCount);
+			forEachChunk(header.ChunksCount, [&](size_t i)
+			{
+				size_t rawOffset = i * _chunkRawSize;
+				size_t chunkRawSize = (std::min)((size_t)_chunkRawSize, rawSize - rawOffset);
+				chunks[i].resize(CompressBound(chunkRawSize));
+				chunkSizes[i] = (uint32_t)Compress(image.Pixels.data() + rawOffset, chunkRawSize, chunks[i].data());
+				return true;
+			});
+
+			// write to temporary file and rename, so a crash won't leave a broken cache file behind
+			std::error_code err;
+			fs::create_directories(Folder(), err);
+			std::string cachePath = textureCachePath(path, level);
+			std::string tempPath = cachePath + ".tmp";
+			{
+				std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+				if (!file.good())
+				{
+					BON_WLOG("Failed to write texture cache file: %s", cachePath.c_str());
+					return;
+				}
+				file.write((const char*)&header, sizeof(header));
+				file.write((const char*)chunkSizes.data(), chunkSizes.size() * sizeof(uint32_t));
+				for (size_t i = 0; i < chunks.size(); ++i)
+				{
+					file.write((const char*)chunks[i].data(), chunkSizes[i]);
+				}
+				if (!file.good())
+				{
+					BON_WLOG("Failed to write texture cache file: %s", cachePath.c_str());
+					file.close();
+					fs::remove(tempPath, err);
+					return;
+				}
+			}
+			fs::rename(tempPath, cachePath, err);
+			if (err)
+			{
+				BON_WLOG("Failed to write texture cache file: %s", cachePath.c_str());
+				fs::remove(tempPath, err);
+				return;
+			}
+			BON_DLOG("Stored image in texture cache: %s", cachePath.c_str());
+		}
+
+		/**
+		 * Write LZ4 length extension bytes.
+		 */
+		inline unsigned char* writeLz4Length(unsigned char* op, size_t length)
+		{
+			while (length >= 255)
+			{
+				*op++ = 255;
+				length -= 255;
+			}
+			*op++ = (unsigned char)length;
+			return op;
+		}
+
+		/**
+		 * Write a LZ4 sequence: literals followed by an optional match.
+		 */
+		inline unsigned char* writeLz4Sequence(unsigned char* op, const unsigned char* literals, size_t literalsLength, size_t offset, size_t matchLength)
+		{
+			// token
+			unsigned char* token = op++;
+			*token = (unsigned char)((literalsLength >= 15 ? 15 : literalsLength) << 4);
+			if (literalsLength >= 15) { op = writeLz4Length(op, literalsLength - 15); }
+
+			// literals
+			memcpy(op, literals, literalsLength);
+			op += literalsLength;
+
+			// match (last sequence has no match)
+			if (matchLength > 0)
+			{
+				*op++ = (unsigned char)(offset & 0xff);
+				*op++ = (unsigned char)(offset >> 8);
+				size_t length = matchLength - 4;
+				*token |= (unsigned char)(length >= 15 ? 15 : length);
+				if (length >= 15) { op = writeLz4Length(op, length - 15); }
+			}
+			return op;
+		}
+
+		// compress with lz4 block format
+		size_t GfxTextureCache::Compress(const unsigned char* src, size_t srcSize, unsigned char* dest)
+		{
+			// lz4 block rules: min match is 4 bytes, last match must start at least 12 bytes before end, and last 5 bytes are always literals
+			const size_t minMatch = 4;
+			const size_t matchStartLimit = 12;
+			const size_t lastLiterals = 5;
+			const int hashBits = 12;
+
+			unsigned char* op = dest;
+			size_t anchor = 0;
+			if (srcSize > matchStartLimit)
+			{
+				// hash table of last position for every 4 bytes sequence
+				std::vector<int32_t> table((size_t)1 << hashBits, -1);
+				size_t ip = 0;
+				size_t matchEndLimit = srcSize - lastLiterals;
+				while (ip + matchStartLimit <= srcSize)
+				{
+					uint32_t sequence;
+					memcpy(&sequence, src + ip, 4);
+					uint32_t hash = (sequence * 2654435761U) >> (32 - hashBits);
+					int32_t ref = table[hash];
+					table[hash] = (int32_t)ip;
+
+					// no match? advance
+					uint32_t refSequence;
+					if (ref < 0 || ip - (size_t)ref > 65535 || (memcpy(&refSequence, src + ref, 4), refSequence != sequence))
+					{
+						ip++;
+						continue;
+					}
+
+					// extend match and write sequence
+					size_t matchLength = minMatch;
+					while (ip + matchLength < matchEndLimit && src[ref + matchLength] == src[ip + matchLength]) { matchLength++; }
+					op = writeLz4Sequence(op, src + anchor, ip - anchor, ip - (size_t)ref, matchLength);
+					ip += matchLength;
+					anchor = ip;
+				}
+			}
+
+			// write last literals
+			op = writeLz4Sequence(op, src + anchor, srcSize - anchor, 0, 0);
+			return (size_t)(op - dest);
+		}
+
+		// decompress lz4 block format
+		bool GfxTextureCache::Decompress(const unsigned char* src, size_t srcSize, unsigned char* dest, size_t destSize)
+		{
+			const unsigned char* ip = src;
+			const unsigned char* ipEnd = src + srcSize;
+			unsigned char* op = dest;
+			unsigned char* opEnd = dest + destSize;
+
+			while (ip < ipEnd)
+			{
+				// literals length
+				unsigned char token = *ip++;
+				size_t length = token >> 4;
+				if (length == 15)
+				{
+					unsigned char extra;
+					do
+					{
+						if (ip >= ipEnd) { return false; }
+						extra = *ip++;
+						length += extra;
+					} while (extra == 255);
+				}
+
+				// copy literals
+				if ((size_t)(ipEnd - ip) < length || (size_t)(opEnd - op) < length) { return false; }
+				memcpy(op, ip, length);
+				ip += length;
+				op += length;
+
+				// last sequence has no match
+				if (ip >= ipEnd) { break; }
+
+				// match offset
+				if (ipEnd - ip < 2) { return false; }
+				size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+				ip += 2;
+				if (offset == 0 || offset > (size_t)(op - dest)) { return false; }
+
+				// match length
+				length = (token & 15);
+				if (length == 15)
+				{
+					unsigned char extra;
+					do
+					{
+						if (ip >= ipEnd) { return false; }
+						extra = *ip++;
+						length += extra;
+					} while (extra == 255);
+				}
+				length += 4;
+
+				// copy match byte by byte, since it may overlap output
+				if ((size_t)(opEnd - op) < length) { return false; }
+				const unsigned char* match = op - offset;
+				for (size_t i = 0; i < length; ++i) { op[i] = match[i]; }
+				op += length;
+			}
+			return op == opEnd;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,469 @@
+#include <Gfx/GfxTextureStreamer.h>
+#include <Gfx/GfxSdlWrapper.h>
+#include <Gfx/GfxTextureCache.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#include <SDL2_image-2.0.5/include/SDL_image.h>
+#pragma warning(pop)
+
+namespace bon
+{
+	namespace gfx
+	{
+		namespace
+		{
+			// load a level from textures cache, and make sure its size matches the level size
+			bool loadCachedLevel(const StreamedTexture& texture, int level, CachedImagePixels& out)
+			{
+				return GfxTextureCache::Load(texture.Path.c_str(), out, level) && out.Width == texture.LevelWidth(level) && out.Height == texture.LevelHeight(level);
+			}
+		}
+
+		// mark image as drawn at size
+		void StreamedTexture::OnDraw(float screenWidth, float screenHeight)
+		{
+			// find the smallest level that still has at least one texel per screen pixel
+			int level = 0;
+			while (level < PlaceholderLevel && LevelWidth(level + 1) >= screenWidth && LevelHeight(level + 1) >= screenHeight)
+			{
+				level++;
+			}
+			if (level < FrameLevel) { FrameLevel = level; }
+		}
+
+		// stop decoders
+		GfxTextureStreamer::~GfxTextureStreamer()
+		{
+			Stop();
+		}
+
+		// start decoder threads
+		void GfxTextureStreamer::Start(GfxSdlWrapper* gfx)
+		{
+			Stop();
+			_gfx = gfx;
+			_running = true;
+			for (int i = 0; i < WorkerThreads; ++i)
+			{
+				_workers.emplace_back(&GfxTextureStreamer::Run, this);
+			}
+		}
+
+		// stop decoder threads
+		void GfxTextureStreamer::Stop()
+		{
+			if (!_running) { return; }
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_running = false;
+				_requests.clear();
+			}
+			_wakeUp.notify_all();
+			for (auto& worker : _workers)
+			{
+				worker.join();
+			}
+			_workers.clear();
+			_results.clear();
+			for (auto& texture : _textures)
+			{
+				texture->Pending = false;
+			}
+		}
+
+		// create streamed image
+		std::shared_ptr<StreamedTexture> GfxTextureStreamer::Create(const char* path, int width, int height, assets::ImageFilterMode filter, assets::_ImageHandle* handle)
+		{
+			// create streamed image
+			auto ret = std::make_shared<StreamedTexture>();
+			ret->Path = path;
+			ret->Width = width;
+			ret->Height = height;
+			ret->Filter = filter;
+			ret->Handle = handle;
+			while (ret->LevelWidth(ret->PlaceholderLevel) > PlaceholderSize || ret->LevelHeight(ret->PlaceholderLevel) > PlaceholderSize)
+			{
+				ret->PlaceholderLevel++;
+			}
+
+			// use placeholder level from textures cache as preview, if we have it (its tiny, so we can read it right away).
+			// otherwise, use a 1x1 transparent texture until first level is decoded
+			static const unsigned char transparent[4] = { 0, 0, 0, 0 };
+			CachedImagePixels preview;
+			bool havePreview = loadCachedLevel(*ret, ret->PlaceholderLevel, preview);
+			int textureWidth = havePreview ? preview.Width : 1;
+			int textureHeight = havePreview ? preview.Height : 1;
+			_gfx->SetTextureFiltering(filter);
+			SDL_Texture* texture = SDL_CreateTexture(_gfx->GetRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, textureWidth, textureHeight);
+			if (texture == nullptr) { return nullptr; }
+			SDL_UpdateTexture(texture, nullptr, havePreview ? preview.Pixels.data() : transparent, textureWidth * 4);
+			SDL_SetTextureBlendMode(texture, (!havePreview || preview.HaveAlpha) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+			handle->Texture = texture;
+			if (havePreview)
+			{
+				ret->HaveAlpha = preview.HaveAlpha;
+				ret->ResidentLevel = ret->PlaceholderLevel;
+				ret->TextureWidth = textureWidth;
+				ret->TextureHeight = textureHeight;
+				ret->PlaceholderPixels = std::move(preview.Pixels);
+			}
+
+			// start with the placeholder level, until image is drawn
+			ret->TargetLevel = ret->PlaceholderLevel;
+			ret->FrameLevel = ret->PlaceholderLevel + 1;
+			ret->LastNeededTime = SDL_GetTicks() / 1000.0;
+			_textures.push_back(ret);
+			BON_DLOG("Stream image %s (%dx%d, placeholder level %d%s).", path, width, height, ret->PlaceholderLevel, havePreview ? ", cached preview" : "");
+			return ret;
+		}
+
+		// stop streaming image
+		void GfxTextureStreamer::Remove(StreamedTexture* texture)
+		{
+			texture->Disposed = true;
+			texture->Handle = nullptr;
+			for (auto it = _textures.begin(); it != _textures.end(); ++it)
+			{
+				if (it->get() == texture)
+				{
+					_textures.erase(it);
+					return;
+				}
+			}
+		}
+
+		// upload decoded levels and request new levels
+		void GfxTextureStreamer::Update()
+		{
+			if (!_running) { return; }
+
+			// take decoded levels
+			std::vector<DecodeResult> ready;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				ready.swap(_results);
+			}
+
+			// queue decoded levels upload (upload queue spreads them over multiple frames)
+			for (auto& result : ready)
+			{
+				StreamedTexture& texture = *result.Texture;
+				texture.Pending = false;
+				if (texture.Disposed) { continue; }
+				if (result.Failed)
+				{
+					BON_WLOG("Failed to stream image '%s'. Image will stay transparent.", texture.Path.c_str());
+					texture.Failed = true;
+					continue;
+				}
+				texture.HaveAlpha = result.HaveAlpha;
+				if (!result.PlaceholderPixels.empty())
+				{
+					texture.PlaceholderPixels = std::move(result.PlaceholderPixels);
+				}
+
+				// upload only if still needed (target may have changed while decoding)
+				if (result.Level == texture.TargetLevel)
+				{
+					texture.Pending = Upload(result.Texture, result.Level, result.Width, result.Height, std::move(result.Pixels));
+				}
+			}
+
+			// update target levels and request missing levels
+			double now = SDL_GetTicks() / 1000.0;
+			bool requested = false;
+			for (auto& texturePtr : _textures)
+			{
+				StreamedTexture& texture = *texturePtr;
+
+				// get level needed this frame (not drawn = placeholder)
+				int needed = std::min(texture.FrameLevel, texture.PlaceholderLevel);
+				texture.FrameLevel = texture.PlaceholderLevel + 1;
+
+				// switch to finer levels immediately, but to coarser levels only after not needing current level for a while
+				if (needed <= texture.TargetLevel)
+				{
+					texture.TargetLevel = needed;
+					texture.LastNeededTime = now;
+				}
+				else if (now - texture.LastNeededTime >= DowngradeDelay)
+				{
+					texture.TargetLevel = needed;
+					texture.LastNeededTime = now;
+				}
+
+				// already resident or in progress?
+				if (texture.ResidentLevel == texture.TargetLevel || texture.Pending || texture.Failed) { continue; }
+
+				// drop to placeholder without decoding again
+				if (texture.TargetLevel == texture.PlaceholderLevel && !texture.PlaceholderPixels.empty())
+				{
+					std::vector<unsigned char> pixels = texture.PlaceholderPixels;
+					texture.Pending = Upload(texturePtr, texture.PlaceholderLevel, texture.LevelWidth(texture.PlaceholderLevel), texture.LevelHeight(texture.PlaceholderLevel), std::move(pixels));
+					continue;
+				}
+
+				// request level
+				texture.Pending = true;
+				std::lock_guard<std::mutex> lock(_mutex);
+				_requests.push_back({ texturePtr, texture.TargetLevel, texture.PlaceholderPixels.empty() });
+				requested = true;
+			}
+
+			// wake up decoders
+			if (requested)
+			{
+				_wakeUp.notify_all();
+			}
+		}
+
+		// decoder thread loop
+		void GfxTextureStreamer::Run()
+		{
+			while (true)
+			{
+				// wait for request
+				DecodeRequest request;
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					_wakeUp.wait(lock, [this]() { return !_running || !_requests.empty(); });
+					if (!_running) { return; }
+					request = std::move(_requests.front());
+					_requests.pop_front();
+				}
+
+				// decode and push result
+				DecodeResult result;
+				Decode(request, result);
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (_running)
+				{
+					_results.push_back(std::move(result));
+				}
+			}
+		}
+
+		// decode a level
+		void GfxTextureStreamer::Decode(const DecodeRequest& request, DecodeResult& result)
+		{
+			StreamedTexture& texture = *request.Texture;
+			result.Texture = request.Texture;
+			result.Level = request.Level;
+
+			// disposed while waiting?
+			if (texture.Disposed)
+			{
+				result.Failed = true;
+				return;
+			}
+
+			// try to load only the requested level (and placeholder, if we don't have it yet) from textures cache
+			CachedImagePixels cached;
+			if (loadCachedLevel(texture, request.Level, cached))
+			{
+				CachedImagePixels placeholder;
+				if (!request.NeedPlaceholder || request.Level == texture.PlaceholderLevel || loadCachedLevel(texture, texture.PlaceholderLevel, placeholder))
+				{
+					result.HaveAlpha = cached.HaveAlpha;
+					result.Width = cached.Width;
+					result.Height = cached.Height;
+					if (request.NeedPlaceholder)
+					{
+						result.PlaceholderPixels = (request.Level == texture.PlaceholderLevel) ? cached.Pixels : std::move(placeholder.Pixels);
+					}
+					result.Pixels = std::move(cached.Pixels);
+					return;
+				}
+			}
+
+			// level is not cached - get full image from textures cache or decode it from file
+			const char* path = texture.Path.c_str();
+			bool fullImageCached = GfxTextureCache::Load(path, cached);
+			if (!fullImageCached)
+			{
+				SDL_Surface* surface = IMG_Load(path);
+				if (surface == nullptr)
+				{
+					result.Failed = true;
+					return;
+				}
+				bool converted = GfxTextureCache::FromSurface(surface, cached);
+				SDL_FreeSurface(surface);
+				if (!converted)
+				{
+					result.Failed = true;
+					return;
+				}
+			}
+
+			// file changed since we read its size?
+			if (cached.Width != texture.Width || cached.Height != texture.Height)
+			{
+				result.Failed = true;
+				return;
+			}
+			result.HaveAlpha = cached.HaveAlpha;
+
+			// build the levels chain down to placeholder, and store every level in cache so next time a level is needed we only load that level.
+			// keep the requested level and placeholder
+			std::vector<unsigned char> smaller;
+			for (int level = 0; level <= texture.PlaceholderLevel; ++level)
+			{
+				if (level > 0 || !fullImageCached) { GfxTextureCache::Save(path, cached, level); }
+
+				int nextWidth = cached.Width;
+				int nextHeight = cached.Height;
+				if (level < texture.PlaceholderLevel) { Downsample(cached.Pixels, cached.Width, cached.Height, smaller, nextWidth, nextHeight); }
+
+				if (level == texture.PlaceholderLevel && request.NeedPlaceholder) { result.PlaceholderPixels = cached.Pixels; }
+				if (level == request.Level)
+				{
+					result.Width = cached.Width;
+					result.Height = cached.Height;
+					result.Pixels = std::move(cached.Pixels);
+				}
+				cached.Pixels.swap(smaller);
+				cached.Width = nextWidth;
+				cached.Height = nextHeight;
+			}
+		}
+
+		// create level texture and queue its upload
+		bool GfxTextureStreamer::Upload(const std::shared_ptr<StreamedTexture>& texture, int level, int width, int height, std::vector<unsigned char>&& pixels)
+		{
+			// create texture with image filtering mode
+			_gfx->SetTextureFiltering(texture->Filter);
+			SDL_Texture* newTexture = SDL_CreateTexture(_gfx->GetRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
+			if (newTexture == nullptr)
+			{
+				BON_WLOG("Failed to create texture for streamed image '%s' level %d! SDL Error: %s", texture->Path.c_str(), level, SDL_GetError());
+				return false;
+			}
+			SDL_SetTextureBlendMode(newTexture, texture->HaveAlpha ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+
+			// queue upload, and swap into handle once done
+			_gfx->UploadQueue().Enqueue(newTexture, width, height, std::move(pixels), [texture, level, width, height](SDL_Texture* uploaded, bool success)
+			{
+				texture->Pending = false;
+				if (!success || texture->Disposed)
+				{
+					SDL_DestroyTexture(uploaded);
+					return;
+				}
+				if (texture->Handle->Texture)
+				{
+					SDL_DestroyTexture((SDL_Texture*)texture->Handle->Texture);
+				}
+				texture->Handle->Texture = uploaded;
+				texture->ResidentLevel = level;
+				texture->TextureWidth = width;
+				texture->TextureHeight = height;
+			});
+			return true;
+		}
+
+		// shrink pixels to half size
+		void GfxTextureStreamer::Downsample(const std::vector<unsigned char>& source, int width, int height, std::vector<unsigned char>& dest, int& outWidth, int& outHeight)
+		{
+			int newWidth = std::max(width / 2, 1);
+			int newHeight = std::max(height / 2, 1);
+			dest.resize((size_t)newWidth * newHeight * 4);
+			for (int y = 0; y < newHeight; ++y)
+			{
+				int y0 = std::min(y * 2, height - 1);
+				int y1 = std::min(y * 2 + 1, height - 1);
+				for (int x = 0; x < newWidth; ++x)
+				{
+					int x0 = std::min(x * 2, width - 1);
+					int x1 = std::min(x * 2 + 1, width - 1);
+					const unsigned char* p00 = &source[((size_t)y0 * width + x0) * 4];
+					const unsigned char* p01 = &source[((size_t)y0 * width + x1) * 4];
+					const unsigned char* p10 = &source[((size_t)y1 * width + x0) * 4];
+					const unsigned char* p11 = &source[((size_t)y1 * width + x1) * 4];
+					unsigned char* out = &dest[((size_t)y * newWidth + x) * 4];
+					for (int c = 0; c < 4; ++c)
+					{
+						out[c] = (unsigned char)((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+					}
+				}
+			}
+			outWidth = newWidth;
+			outHeight = newHeight;
+		}
+
+		// read image size from header
+		bool GfxTextureStreamer::ReadImageSize(const char* path, int& outWidth, int& outHeight)
+		{
+			FILE* file = fopen(path, "rb");
+			if (file == nullptr) { return false; }
+			unsigned char header[26];
+			size_t read = fread(header, 1, sizeof(header), file);
+			bool ret = false;
+
+			// png (size is in IHDR chunk, big endian)
+			static const unsigned char pngSignature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+			if (read >= 24 && memcmp(header, pngSignature, 8) == 0)
+			{
+				outWidth = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+				outHeight = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+				ret = true;
+			}
+			// gif (little endian 16 bit)
+			else if (read >= 10 && memcmp(header, "GIF8", 4) == 0)
+			{
+				outWidth = header[6] | (header[7] << 8);
+				outHeight = header[8] | (header[9] << 8);
+				ret = true;
+			}
+			// bmp (little endian 32 bit, height is negative for top-down images)
+			else if (read >= 26 && header[0] == 'B' && header[1] == 'M')
+			{
+				outWidth = header[18] | (header[19] << 8) | (header[20] << 16) | (header[21] << 24);
+				outHeight = header[22] | (header[23] << 8) | (header[24] << 16) | (header[25] << 24);
+				if (outHeight < 0) { outHeight = -outHeight; }
+				ret = true;
+			}
+			// jpeg (size is in the start of frame segment)
+			else if (read >= 4 && header[0] == 0xFF && header[1] == 0xD8)
+			{
+				fseek(file, 2, SEEK_SET);
+				while (true)
+				{
+					// find next marker
+					int marker = fgetc(file);
+					if (marker != 0xFF) { break; }
+					while (marker == 0xFF) { marker = fgetc(file); }
+					if (marker == EOF || marker == 0xD9 || marker == 0xDA) { break; }
+
+					// read segment length
+					unsigned char lengthBytes[2];
+					if (fread(lengthBytes, 1, 2, file) != 2) { break; }
+					int length = (lengthBytes[0] << 8) | lengthBytes[1];
+
+					// start of frame? (all SOFn markers except DHT, JPG and DAC)
+					if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+					{
+						unsigned char frame[5];
+						if (fread(frame, 1, 5, file) != 5) { break; }
+						outHeight = (frame[1] << 8) | frame[2];
+						outWidth = (frame[3] << 8) | frame[4];
+						ret = true;
+						break;
+					}
+
+					// skip segment
+					if (length < 2 || fseek(file, length - 2, SEEK_CUR) != 0) { break; }
+				}
+			}
+
+			fclose(file);
+			return ret && outWidth > 0 && outHeight > 0;
+		}
+	}
+}
\ No newline at end of file
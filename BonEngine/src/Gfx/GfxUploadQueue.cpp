@@ -0,0 +1,107 @@
+#include <Gfx/GfxUploadQueue.h>
+#include <Gfx/GfxOpenGL.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <chrono>
+
+namespace bon
+{
+	namespace gfx
+	{
+		// add upload to queue
+		void GfxUploadQueue::Enqueue(SDL_Texture* texture, int width, int height, std::vector<unsigned char>&& pixels, UploadCallback onComplete)
+		{
+			Upload upload;
+			upload.Texture = texture;
+			upload.Width = width;
+			upload.Height = height;
+			upload.NextRow = 0;
+			upload.Pixels = std::move(pixels);
+			upload.OnComplete = std::move(onComplete);
+			_pendingBytes += upload.Pixels.size();
+			_uploads.push_back(std::move(upload));
+		}
+
+		// upload within frame budget
+		void GfxUploadQueue::Update()
+		{
+			if (_uploads.empty()) { return; }
+
+			// get budget
+			size_t bytesBudget = bon::Features().TextureUploadBytesPerFrame;
+			double timeBudget = bon::Features().TextureUploadTimePerFrame;
+			auto start = std::chrono::high_resolution_clock::now();
+
+			// upload chunks until we run out of budget (but at least one chunk)
+			size_t uploaded = 0;
+			while (!_uploads.empty())
+			{
+				size_t maxBytes = ChunkBytes;
+				if (bytesBudget > 0 && uploaded > 0)
+				{
+					if (uploaded >= bytesBudget) { break; }
+					maxBytes = std::min(maxBytes, bytesBudget - uploaded);
+				}
+				uploaded += UploadChunk(maxBytes);
+
+				// check time budget
+				if (timeBudget > 0)
+				{
+					std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+					if (elapsed.count() >= timeBudget) { break; }
+				}
+			}
+		}
+
+		// upload everything
+		void GfxUploadQueue::Flush()
+		{
+			while (!_uploads.empty())
+			{
+				UploadChunk(ChunkBytes);
+			}
+		}
+
+		// drop pending uploads
+		void GfxUploadQueue::Dispose()
+		{
+			while (!_uploads.empty())
+			{
+				Upload upload = std::move(_uploads.front());
+				_uploads.pop_front();
+				_pendingBytes -= upload.Pixels.size() - (size_t)upload.NextRow * upload.Width * 4;
+				if (upload.OnComplete) { upload.OnComplete(upload.Texture, false); }
+			}
+			if (_buffer)
+			{
+				GfxOpenGL::DeleteBuffer(_buffer);
+				_buffer = 0;
+				_capacity = 0;
+			}
+		}
+
+		// upload next chunk
+		size_t GfxUploadQueue::UploadChunk(size_t maxBytes)
+		{
+			// upload rows
+			Upload& upload = _uploads.front();
+			size_t rowBytes = (size_t)upload.Width * 4;
+			int rows = std::max((int)(maxBytes / rowBytes), 1);
+			rows = std::min(rows, upload.Height - upload.NextRow);
+			GfxOpenGL::UploadTextureRows(upload.Texture, _buffer, _capacity, upload.NextRow, upload.Width, rows, upload.Pixels.data() + rowBytes * upload.NextRow);
+			upload.NextRow += rows;
+			size_t bytes = rowBytes * rows;
+			_pendingBytes -= bytes;
+
+			// done? remove from queue before calling callback, since it may add new uploads
+			if (upload.NextRow >= upload.Height)
+			{
+				Upload done = std::move(upload);
+				_uploads.pop_front();
+				if (done.OnComplete) { done.OnComplete(done.Texture, true); }
+			}
+			return bytes;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <Gfx/PixelsReadback.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#include <SDL2_image-2.0.5/include/SDL_image.h>
+#pragma warning(pop)
+
+namespace bon
+{
+	namespace gfx
+	{
+		// get pixel color
+		framework::Color _PixelsReadback::GetPixel(const framework::PointI& position) const
+		{
+			// not ready or out of range?
+			if (!_ready || _failed || position.X < 0 || position.Y < 0 || position.X >= _width || position.Y >= _height)
+			{
+				return framework::Color::TransparentBlack;
+			}
+
+			// get pixel
+			const unsigned char* p = _pixels.data() + ((size_t)position.Y * _width + position.X) * 4;
+			return framework::Color::FromBytes(p[0], p[1], p[2], p[3]);
+		}
+
+		// save pixels to png file
+		bool _PixelsReadback::SaveToFile(const char* filename) const
+		{
+			// not ready?
+			if (!_ready || _failed)
+			{
+				BON_WLOG("Tried to save pixels readback to file '%s', but pixels are not ready!", filename);
+				return false;
+			}
+
+			// create surface from pixels and save it
+			SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom((void*)_pixels.data(), _width, _height, 32, _width * 4, SDL_PIXELFORMAT_RGBA32);
+			if (surface == nullptr)
+			{
+				BON_ELOG("Failed to create surface to save pixels readback! SDL Error: %s", SDL_GetError());
+				return false;
+			}
+			bool success = IMG_SavePNG(surface, filename) == 0;
+			SDL_FreeSurface(surface);
+			return success;
+		}
+	}
+}
\ No newline at end of file
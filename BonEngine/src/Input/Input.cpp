@@ -1,8 +1,11 @@
 #include <Input/Input.h>
 #include <Log/ILog.h>
 #include <Input/Defs.h>
+#include <Framework/Exceptions.h>
+#include <Engine/InputRecorder.h>
 #include <BonEngine.h>
 #include <string>
+#include <algorithm>
 
 #pragma warning(push, 0)
 #include <SDL2-2.0.12/include/SDL.h>
@@ -529,6 +532,7 @@ namespace bon
 				case KeyCodes::MouseMiddle: return "MouseMiddle";
 				case KeyCodes::MouseX1: return "MouseX1";
 				case KeyCodes::MouseX2: return "MouseX2";
+				case KeyCodes::_Count: break;
 			}
 			return "Unknown";
 		}
@@ -553,8 +557,14 @@ namespace bon
 			// copy current cursor position to previous frame cursor position
 			_prevCursorPosition = _cursorPosition;
 
-			// get new cursor position
-			SDL_GetMouseState(&_cursorPosition.X, &_cursorPosition.Y);
+			// get new cursor position (from recorded input, when replaying)
+			auto recorder = _GetEngine()._GetInputRecorder();
+			if (recorder && recorder->IsReplaying()) {
+				_cursorPosition = recorder->CursorPosition();
+			}
+			else {
+				SDL_GetMouseState(&_cursorPosition.X, &_cursorPosition.Y);
+			}
 			
 			// calculate mouse delta
 			_cursorMovement.Set(_cursorPosition.X - _prevCursorPosition.X, _cursorPosition.Y - _prevCursorPosition.Y);
@@ -582,7 +592,7 @@ namespace bon
 		void Input::_Start()
 		{
 			// if started and user didn't do any maps, do default mappings
-			if (_keyBinds.empty()) {
+			if (_keyBindsCount == 0) {
 				BON_ILOG("Set default key bindings.");
 				SetDefaultKeyBinds();
 			}
@@ -647,8 +657,108 @@ namespace bon
 		// set a key binding
 		void Input::SetKeyBind(KeyCodes keyCode, const char* actionId)
 		{
+			RemoveKeyBinds(keyCode);
+			AddKeyBind(keyCode, actionId);
+		}
+
+		// add a key binding
+		void Input::AddKeyBind(KeyCodes keyCode, const char* actionId)
+		{
+			// validate key code
+			if ((size_t)keyCode >= KeysCount) 
+			{ 
+				throw framework::InvalidValue("Invalid key code to bind!"); 
+			}
+
+			// resolve action handle now, so key events don't need to do any string lookups
+			ActionHandle action = RegisterAction(actionId);
+			std::vector<ActionHandle>& keyActions = _keyBinds[(size_t)keyCode];
+			if (std::find(keyActions.begin(), keyActions.end(), action) != keyActions.end()) { return; }
+
+			// add bind
 			BON_DLOG("Bind key: %s --> '%s'.", KeyCodeToString(keyCode), actionId);
-			(_keyBinds)[keyCode] = std::string(actionId);
+			keyActions.push_back(action);
+			_actionKeys[action].push_back(keyCode);
+			_keyBindsCount++;
+
+			// key is currently down? update action
+			UpdateActionState(action, _currKeyStates[(size_t)keyCode]);
+		}
+
+		// remove all actions bound to a key
+		void Input::RemoveKeyBinds(KeyCodes keyCode)
+		{
+			if ((size_t)keyCode >= KeysCount) { return; }
+			std::vector<ActionHandle>& keyActions = _keyBinds[(size_t)keyCode];
+			for (auto action : keyActions)
+			{
+				std::vector<KeyCodes>& actionKeys = _actionKeys[action];
+				actionKeys.erase(std::remove(actionKeys.begin(), actionKeys.end(), keyCode), actionKeys.end());
+				_keyBindsCount--;
+				UpdateActionState(action, _currKeyStates[(size_t)keyCode]);
+			}
+			keyActions.clear();
+		}
+
+		// remove all key binds
+		void Input::ClearKeyBinds()
+		{
+			for (size_t i = 0; i < KeysCount; ++i)
+			{
+				RemoveKeyBinds((KeyCodes)i);
+			}
+		}
+
+		// register action and get its handle
+		ActionHandle Input::RegisterAction(const char* actionId)
+		{
+			// already registered?
+			ActionHandle ret = FindAction(actionId);
+			if (ret != InvalidActionHandle) { return ret; }
+
+			// register new action
+			ret = (ActionHandle)_actionIds.size();
+			_actionHandles[actionId] = ret;
+			_actionIds.push_back(actionId);
+			_actionKeys.emplace_back();
+			_actionStates.emplace_back();
+			return ret;
+		}
+
+		// get action handle without registering it
+		ActionHandle Input::FindAction(const char* actionId) const
+		{
+			auto found = _actionHandles.find(actionId);
+			return found != _actionHandles.end() ? found->second : InvalidActionHandle;
+		}
+
+		// get action id from handle
+		const char* Input::GetActionId(ActionHandle action) const
+		{
+			return ((size_t)action < _actionIds.size()) ? _actionIds[action].c_str() : nullptr;
+		}
+
+		// update action state from its keys
+		void Input::UpdateActionState(ActionHandle action, const _ActionStates& changedKeyState)
+		{
+			// action is down while any of its keys is down
+			bool isDown = false;
+			for (auto key : _actionKeys[action])
+			{
+				if (_currKeyStates[(size_t)key].IsDown) 
+				{ 
+					isDown = true; 
+					break; 
+				}
+			}
+
+			// set state if changed, using the update frames of the key that changed it
+			_ActionStates& state = _actionStates[action];
+			if (state.IsDown != isDown)
+			{
+				state = changedKeyState;
+				state.IsDown = isDown;
+			}
 		}
 
 		// handle events
@@ -702,7 +812,7 @@ namespace bon
 			// clear previous key binds
 			if (removePreviousBinds)
 			{
-				_keyBinds.clear();
+				ClearKeyBinds();
 			}
 
 			// load keys
@@ -813,55 +923,75 @@ namespace bon
 		// set key state
 		void Input::SetKeyState(KeyCodes key, bool value)
 		{
+			// skip unsupported keys
+			if ((size_t)key >= KeysCount) {
+				return;
+			}
+
 			// get existing value
-			bool currVal = (_currKeyStates)[key].IsDown;
+			_ActionStates& state = _currKeyStates[(size_t)key];
 
 			// if didn't change, stop here!
-			if (value == currVal) {
+			if (value == state.IsDown) {
 				return;
 			}
 
 			// set key state
-			_ActionStates state;
 			state.IsDown = value;
 			state.UpdateFrameId = _GetEngine().UpdatesCount();
 			state.FixedUpdateFrameId = _GetEngine().FixedUpdatesCount();
-			(_currKeyStates)[key] = state;
 
-			// check if this key is bound to action, and if so set action as well
-			if (_keyBinds.find(key) != _keyBinds.end()) 
+			// update actions bound to this key
+			for (auto action : _keyBinds[(size_t)key])
 			{
-				const char* action = (_keyBinds)[key].c_str();
-				(_actionStates)[std::move(action)] = state;
+				UpdateActionState(action, state);
 			}
 		}
 
 		// get if given action is down
 		bool Input::Down(const char* actionId) const
 		{
-			auto state = GetState(actionId);
-			return state == KeyStates::PressedNow || state == KeyStates::Pressed;
+			return Down(FindAction(actionId));
 		}
 
 		// get if a given game action was released this frame
 		bool Input::ReleasedNow(const char* actionId) const
 		{
-			auto state = GetState(actionId);
-			return state == KeyStates::ReleasedNow;
+			return ReleasedNow(FindAction(actionId));
 		}
 
 		// get if a given game action was pressed this frame
 		bool Input::PressedNow(const char* actionId) const
 		{
-			auto state = GetState(actionId);
-			return state == KeyStates::PressedNow;
+			return PressedNow(FindAction(actionId));
+		}
+
+		// get if given action is down
+		bool Input::Down(ActionHandle action) const
+		{
+			if ((size_t)action >= _actionStates.size()) { return false; }
+			return _actionStates[action].IsDown;
+		}
+
+		// get if a given game action was released this frame
+		bool Input::ReleasedNow(ActionHandle action) const
+		{
+			if ((size_t)action >= _actionStates.size()) { return false; }
+			return GetState(_actionStates[action]) == KeyStates::ReleasedNow;
+		}
+
+		// get if a given game action was pressed this frame
+		bool Input::PressedNow(ActionHandle action) const
+		{
+			if ((size_t)action >= _actionStates.size()) { return false; }
+			return GetState(_actionStates[action]) == KeyStates::PressedNow;
 		}
 
 		// get if a key is currently down
 		bool Input::Down(KeyCodes key) const
 		{
-			auto state = GetState(key);
-			return state == KeyStates::PressedNow || state == KeyStates::Pressed;
+			if ((size_t)key >= KeysCount) { return false; }
+			return _currKeyStates[(size_t)key].IsDown;
 		}
 
 		// get if a key was released this frame
@@ -881,21 +1011,21 @@ namespace bon
 		// get action state
 		KeyStates Input::GetState(const char* actionId) const
 		{
-			_ActionStates state = ((Input*)(this))->_actionStates[std::move(actionId)];
-			bool wasUpdateNow = (_GetEngine().CurrentState() == engine::EngineStates::Update && _GetEngine().UpdatesCount() == state.UpdateFrameId) ||
-				(_GetEngine().CurrentState() == engine::EngineStates::FixedUpdate && _GetEngine().FixedUpdatesCount() == state.FixedUpdateFrameId);
-			if (state.IsDown) {
-				return wasUpdateNow ? KeyStates::PressedNow : KeyStates::Pressed;
-			}
-			else {
-				return wasUpdateNow ? KeyStates::ReleasedNow : KeyStates::Released;
-			}
+			ActionHandle action = FindAction(actionId);
+			if (action == InvalidActionHandle) { return KeyStates::Released; }
+			return GetState(_actionStates[action]);
 		}
 
 		// get key state
 		KeyStates Input::GetState(KeyCodes keyCode) const
 		{
-			_ActionStates state = ((Input*)(this))->_currKeyStates[keyCode];
+			if ((size_t)keyCode >= KeysCount) { return KeyStates::Released; }
+			return GetState(_currKeyStates[(size_t)keyCode]);
+		}
+
+		// get key state from stored state
+		KeyStates Input::GetState(const _ActionStates& state) const
+		{
 			bool wasUpdateNow = (_GetEngine().CurrentState() == engine::EngineStates::Update && _GetEngine().UpdatesCount() == state.UpdateFrameId) ||
 				(_GetEngine().CurrentState() == engine::EngineStates::FixedUpdate && _GetEngine().FixedUpdatesCount() == state.FixedUpdateFrameId);
 			if (state.IsDown) {
@@ -909,16 +1039,14 @@ namespace bon
 		// get keys assigned to action id
 		std::vector<KeyCodes> Input::GetAssignedKeys(const char* actionId) const
 		{
-			std::vector<KeyCodes> ret;
-			std::string actionIdStr(actionId);
-			for (auto x : _keyBinds)
-			{
-				if (x.second == actionIdStr)
-				{
-					ret.push_back(x.first);
-				}
-			}
-			return ret;
+			return GetAssignedKeys(FindAction(actionId));
+		}
+
+		// get keys assigned to action handle
+		std::vector<KeyCodes> Input::GetAssignedKeys(ActionHandle action) const
+		{
+			if ((size_t)action >= _actionKeys.size()) { return std::vector<KeyCodes>(); }
+			return _actionKeys[action];
 		}
 	}
 }
\ No newline at end of file
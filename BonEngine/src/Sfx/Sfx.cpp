@@ -1,5 +1,6 @@
 #include <Sfx/Sfx.h>
 #include <Diagnostics/IDiagnostics.h>
+#include <Log/ILog.h>
 #include <BonEngine.h>
 
 namespace bon
@@ -21,6 +22,9 @@ namespace bon
 		// do updates
 		void Sfx::_Update(double deltaTime)
 		{
+			if (_Implementor.IsInit()) {
+				_Implementor.Update();
+			}
 		}
 
 		// called on main loop start
@@ -130,6 +134,146 @@ namespace bon
 			_Implementor.SetVolume(channel, calcVol);
 		}
 
+		// set channel's pitch
+		void Sfx::SetChannelPitch(SoundChannelId channel, float pitch)
+		{
+			if (channel == InvalidSoundChannel) return;
+			_Implementor.SetChannelPitch(channel, pitch);
+		}
+
+		// get channel's pitch
+		float Sfx::GetChannelPitch(SoundChannelId channel) const
+		{
+			if (channel == InvalidSoundChannel) return 1.0f;
+			return _Implementor.GetChannelPitch(channel);
+		}
+
+		// set resampling quality
+		void Sfx::SetResampleQuality(ResampleQuality quality)
+		{
+			_Implementor.Mixer().SetQuality(quality);
+		}
+
+		// get resampling quality
+		ResampleQuality Sfx::GetResampleQuality() const
+		{
+			return _Implementor.Mixer().GetQuality();
+		}
+
+		// set bus volume
+		void Sfx::SetBusVolume(SoundBus bus, float volume)
+		{
+			_Implementor.Mixer().SetBusVolume(bus, volume);
+		}
+
+		// get bus volume
+		float Sfx::GetBusVolume(SoundBus bus) const
+		{
+			return _Implementor.Mixer().GetBusVolume(bus);
+		}
+
+		// add bus insert
+		void Sfx::AddBusInsert(SoundBus bus, SoundDsp dsp)
+		{
+			_Implementor.Mixer().AddInsert(bus, dsp);
+		}
+
+		// remove bus insert
+		void Sfx::RemoveBusInsert(SoundBus bus, SoundDsp dsp)
+		{
+			_Implementor.Mixer().RemoveInsert(bus, dsp);
+		}
+
+		// get bus insert cost
+		bool Sfx::GetBusInsertCost(SoundBus bus, SoundDsp dsp, double& averageTime, double& maxTime)
+		{
+			return _Implementor.Mixer().GetInsertCost(bus, dsp, averageTime, maxTime);
+		}
+
+		// log audio stats
+		void Sfx::LogAudioStats()
+		{
+			_Implementor.LogAudioStats();
+		}
+
+		// get if rendering audio offline
+		bool Sfx::IsOfflineAudio() const
+		{
+			return _Implementor.IsInit() && _Implementor.Mixer().IsOffline();
+		}
+
+		// set listener
+		void Sfx::SetListener(const framework::PointF& position, float rotation)
+		{
+			_Implementor.Spatial().SetListener(position, rotation);
+		}
+
+		// get listener position
+		const framework::PointF& Sfx::GetListenerPosition() const
+		{
+			return _Implementor.Spatial().ListenerPosition();
+		}
+
+		// set spatial pan distance
+		void Sfx::SetSpatialPanDistance(float distance)
+		{
+			_Implementor.Spatial().SetPanDistance(distance);
+		}
+
+		// create emitter
+		SoundEmitterId Sfx::CreateEmitter(const framework::PointF& position, float minDistance, float maxDistance, SoundRolloff rolloff)
+		{
+			return _Implementor.Spatial().CreateEmitter(position, minDistance, maxDistance, rolloff);
+		}
+
+		// destroy emitter
+		void Sfx::DestroyEmitter(SoundEmitterId emitter)
+		{
+			_Implementor.Spatial().DestroyEmitter(emitter);
+		}
+
+		// set emitter position
+		void Sfx::SetEmitterPosition(SoundEmitterId emitter, const framework::PointF& position)
+		{
+			if (!_Implementor.Spatial().IsValid(emitter)) return;
+			_Implementor.Spatial().SetEmitterPosition(emitter, position);
+		}
+
+		// get emitter position
+		framework::PointF Sfx::GetEmitterPosition(SoundEmitterId emitter) const
+		{
+			if (!_Implementor.Spatial().IsValid(emitter)) return framework::PointF();
+			return _Implementor.Spatial().GetEmitterPosition(emitter);
+		}
+
+		// set emitter rolloff
+		void Sfx::SetEmitterRolloff(SoundEmitterId emitter, float minDistance, float maxDistance, SoundRolloff rolloff)
+		{
+			if (!_Implementor.Spatial().IsValid(emitter)) return;
+			_Implementor.Spatial().SetEmitterRolloff(emitter, minDistance, maxDistance, rolloff);
+		}
+
+		// play a sound effect on emitter
+		SoundChannelId Sfx::PlaySoundAt(SoundEmitterId emitter, assets::SoundAsset sound, int volume, int loops, float pitch, float fadeInTime)
+		{
+			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::PlaySoundCalls);
+			volume = (int)((float)volume * _masterVolume);
+			SoundChannelId ret = _Implementor.PlaySoundAt(emitter, sound, volume, loops, pitch, fadeInTime);
+			return ret != AllChannels ? ret : InvalidSoundChannel;
+		}
+
+		// render offline audio
+		int Sfx::RenderOffline(float* buffer, int frames)
+		{
+			if (!IsOfflineAudio())
+			{
+				BON_WLOG("Called 'RenderOffline()' but audio is not offline!");
+				return 0;
+			}
+			_Implementor.Mixer().Render(buffer, frames);
+			return frames;
+		}
+
 		// check if sound is playing
 		bool Sfx::IsPlaying(assets::SoundAsset sound, SoundChannelId channel) const
 		{
@@ -0,0 +1,746 @@
+#include <Sfx/SfxMixer.h>
+#include <Sfx/SfxResampler.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <cstring>
+#include <chrono>
+#include <thread>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+// SSE2 is always available on x86 / x64 builds
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BON_MIXER_SSE
+#include <immintrin.h>
+#endif
+
+namespace bon
+{
+	namespace sfx
+	{
+		namespace
+		{
+			// add source frames into destination, while ramping left / right gains linearly along the block
+			void mixWithGains(float* dest, const float* src, int frames, int channels, float left0, float right0, float left1, float right1)
+			{
+				float leftStep = (left1 - left0) / (float)frames;
+				float rightStep = (right1 - right0) / (float)frames;
+				int i = 0;
+
+				// mono - use average gain
+				if (channels == 1)
+				{
+					float gain = (left0 + right0) * 0.5f;
+					float gainStep = (leftStep + rightStep) * 0.5f;
+#ifdef BON_MIXER_SSE
+					__m128 gains = _mm_setr_ps(gain, gain + gainStep, gain + gainStep * 2.0f, gain + gainStep * 3.0f);
+					__m128 gainsStep = _mm_set1_ps(gainStep * 4.0f);
+					for (; i + 4 <= frames; i += 4)
+					{
+						__m128 mixed = _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(_mm_loadu_ps(src + i), gains));
+						_mm_storeu_ps(dest + i, mixed);
+						gains = _mm_add_ps(gains, gainsStep);
+					}
+#endif
+					for (; i < frames; ++i)
+					{
+						dest[i] += src[i] * (gain + gainStep * (float)i);
+					}
+					return;
+				}
+
+				// stereo - two frames per vector
+				if (channels == 2)
+				{
+#ifdef BON_MIXER_SSE
+					__m128 gains = _mm_setr_ps(left0, right0, left0 + leftStep, right0 + rightStep);
+					__m128 gainsStep = _mm_setr_ps(leftStep * 2.0f, rightStep * 2.0f, leftStep * 2.0f, rightStep * 2.0f);
+					for (; i + 2 <= frames; i += 2)
+					{
+						__m128 mixed = _mm_add_ps(_mm_loadu_ps(dest + i * 2), _mm_mul_ps(_mm_loadu_ps(src + i * 2), gains));
+						_mm_storeu_ps(dest + i * 2, mixed);
+						gains = _mm_add_ps(gains, gainsStep);
+					}
+#endif
+					for (; i < frames; ++i)
+					{
+						dest[i * 2] += src[i * 2] * (left0 + leftStep * (float)i);
+						dest[i * 2 + 1] += src[i * 2 + 1] * (right0 + rightStep * (float)i);
+					}
+					return;
+				}
+
+				// more channels - first two are left and right, the rest use average gain
+				for (; i < frames; ++i)
+				{
+					float left = left0 + leftStep * (float)i;
+					float right = right0 + rightStep * (float)i;
+					float center = (left + right) * 0.5f;
+					const float* srcFrame = src + i * channels;
+					float* destFrame = dest + i * channels;
+					destFrame[0] += srcFrame[0] * left;
+					destFrame[1] += srcFrame[1] * right;
+					for (int c = 2; c < channels; ++c)
+					{
+						destFrame[c] += srcFrame[c] * center;
+					}
+				}
+			}
+
+			// multiply frames by gain, ramping linearly along the block
+			void applyGain(float* buffer, int frames, int channels, float gain0, float gain1)
+			{
+				size_t count = (size_t)frames * channels;
+				size_t i = 0;
+
+				// constant gain
+				if (gain0 == gain1)
+				{
+					if (gain0 == 1.0f) { return; }
+#ifdef BON_MIXER_SSE
+					__m128 gains = _mm_set1_ps(gain0);
+					for (; i + 4 <= count; i += 4)
+					{
+						_mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), gains));
+					}
+#endif
+					for (; i < count; ++i)
+					{
+						buffer[i] *= gain0;
+					}
+					return;
+				}
+
+				// ramping gain (only when volume changes)
+				float gainStep = (gain1 - gain0) / (float)frames;
+				for (int frame = 0; frame < frames; ++frame)
+				{
+					float gain = gain0 + gainStep * (float)frame;
+					for (int c = 0; c < channels; ++c, ++i)
+					{
+						buffer[i] *= gain;
+					}
+				}
+			}
+
+			// add source samples into destination
+			void addSamples(float* dest, const float* src, size_t count)
+			{
+				size_t i = 0;
+#ifdef BON_MIXER_SSE
+				for (; i + 4 <= count; i += 4)
+				{
+					_mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_loadu_ps(src + i)));
+				}
+#endif
+				for (; i < count; ++i)
+				{
+					dest[i] += src[i];
+				}
+			}
+
+			// get bytes per frame for format and channels
+			inline int bytesPerFrame(uint16_t format, int channels)
+			{
+				return (int)(SDL_AUDIO_BITSIZE(format) / 8) * channels;
+			}
+
+			// fade out time when stopping a voice, in seconds
+			const float stopFadeTime = 0.005f;
+
+			// get current time in microseconds, for stats
+			inline uint64_t nowMicroseconds()
+			{
+				return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+
+			// set atomic to value, if value is bigger
+			inline void atomicMax(std::atomic<uint32_t>& target, uint64_t value)
+			{
+				uint32_t clamped = (uint32_t)std::min<uint64_t>(value, UINT32_MAX);
+				uint32_t current = target.load(std::memory_order_relaxed);
+				while (clamped > current && !target.compare_exchange_weak(current, clamped, std::memory_order_relaxed)) {}
+			}
+		}
+
+		// init mixer
+		void SfxMixer::Initialize(int frequency, uint16_t format, int channels, int voicesCount, int blockFrames, bool offline)
+		{
+			BON_DLOG("Initialize software mixer: %d voices, %d Hz, %d channels, %d frames per block.", voicesCount, frequency, channels, blockFrames);
+
+			// store format
+			_frequency = frequency;
+			_format = format;
+			_channels = channels;
+			_blockFrames = std::max(blockFrames, 64);
+			_offline = offline;
+			_lastCallbackTime = 0;
+
+			// create voices
+			_voices = std::vector<Voice>((size_t)std::max(voicesCount, 1));
+
+			// create buses
+			size_t blockSamples = (size_t)_blockFrames * _channels;
+			for (auto& bus : _buses)
+			{
+				bus.Buffer.assign(blockSamples, 0.0f);
+				bus.LastVolume = bus.Volume;
+			}
+			_voiceBuffer.assign(blockSamples, 0.0f);
+			_outBuffer.assign(blockSamples, 0.0f);
+			_streamBuffer.assign((size_t)(SoundStream::RingFrames + SoundStream::HistoryFrames * 2) * _channels, 0.0f);
+		}
+
+		// start playing a sound
+		int SfxMixer::StartVoice(const void* data, uint32_t bytes, SoundBus bus, float volume, int loops, float pitch, float fadeInTime, bool startVirtual, SoundStream* stream)
+		{
+			for (int i = 0; i < (int)_voices.size(); ++i)
+			{
+				// try to claim a free voice
+				Voice& voice = _voices[i];
+				int expected = Free;
+				if (!voice.State.compare_exchange_strong(expected, Starting, std::memory_order_acquire))
+				{
+					continue;
+				}
+
+				// set voice params. audio thread skips voices that are not playing, so its safe to write them
+				voice.Data = data;
+				voice.Frames = bytes / (uint32_t)bytesPerFrame(_format, _channels);
+				voice.Stream = stream;
+				voice.Bus = bus;
+				voice.Volume = volume;
+				voice.PanLeft = 1.0f;
+				voice.PanRight = 1.0f;
+				voice.Distance = 0.0f;
+				voice.Pitch = pitch;
+				voice.FadeOutRequest = 0.0f;
+				voice.Virtual = startVirtual;
+				voice.LoopsLeft = loops;
+				voice.Position = 0;
+				voice.FadeInTotal = (int)(fadeInTime * (float)_frequency);
+				voice.FadeInDone = 0;
+				voice.FadeOutTotal = 0;
+				voice.FadeOutLeft = 0;
+				voice.LastGainLeft = voice.LastGainRight = -1.0f;
+
+				// start playing
+				voice.State.store(Playing, std::memory_order_release);
+				return i;
+			}
+			return -1;
+		}
+
+		// stop voice with a short fade out
+		void SfxMixer::StopVoice(int voice)
+		{
+			_voices[voice].FadeOutRequest = stopFadeTime;
+		}
+
+		// stop voice immediately
+		void SfxMixer::StopVoiceNow(int voice)
+		{
+			int expected = Playing;
+			_voices[voice].State.compare_exchange_strong(expected, Stopping);
+		}
+
+		// fade out voice
+		void SfxMixer::FadeOutVoice(int voice, float fadeOutTime)
+		{
+			_voices[voice].FadeOutRequest = std::max(fadeOutTime, stopFadeTime);
+		}
+
+		// set voice volume
+		void SfxMixer::SetVolume(int voice, float volume)
+		{
+			_voices[voice].Volume = std::max(volume, 0.0f);
+		}
+
+		// get voice volume
+		float SfxMixer::GetVolume(int voice) const
+		{
+			return _voices[voice].Volume;
+		}
+
+		// get voice final gain
+		float SfxMixer::GetAudibleGain(int voice) const
+		{
+			const Voice& ret = _voices[voice];
+			return ret.Volume * (1.0f - ret.Distance) * std::max<float>(ret.PanLeft, ret.PanRight) * _buses[(int)ret.Bus].Volume;
+		}
+
+		// set if voice is virtual
+		void SfxMixer::SetVirtual(int voice, bool isVirtual)
+		{
+			_voices[voice].Virtual.store(isVirtual, std::memory_order_relaxed);
+		}
+
+		// get if voice is virtual
+		bool SfxMixer::IsVirtual(int voice) const
+		{
+			return _voices[voice].Virtual.load(std::memory_order_relaxed);
+		}
+
+		// set voice panning
+		void SfxMixer::SetPanning(int voice, float panLeft, float panRight)
+		{
+			_voices[voice].PanLeft = panLeft;
+			_voices[voice].PanRight = panRight;
+		}
+
+		// set voice distance
+		void SfxMixer::SetDistance(int voice, float distance)
+		{
+			_voices[voice].Distance = std::min(std::max(distance, 0.0f), 1.0f);
+		}
+
+		// set panning and distance of many voices
+		void SfxMixer::SetSpatial(const int* voices, const float* pansLeft, const float* pansRight, const float* distances, int count)
+		{
+			// values are only read once per block, so relaxed writes are enough
+			for (int i = 0; i < count; ++i)
+			{
+				Voice& voice = _voices[voices[i]];
+				voice.PanLeft.store(pansLeft[i], std::memory_order_relaxed);
+				voice.PanRight.store(pansRight[i], std::memory_order_relaxed);
+				voice.Distance.store(distances[i], std::memory_order_relaxed);
+			}
+		}
+
+		// set voice pitch
+		void SfxMixer::SetPitch(int voice, float pitch)
+		{
+			_voices[voice].Pitch = pitch;
+		}
+
+		// get voice pitch
+		float SfxMixer::GetPitch(int voice) const
+		{
+			return _voices[voice].Pitch;
+		}
+
+		// get if voice is playing
+		bool SfxMixer::IsPlaying(int voice, const void* data) const
+		{
+			const Voice& ret = _voices[voice];
+			if (ret.State.load(std::memory_order_acquire) != Playing) { return false; }
+			return data == nullptr || ret.Data == data;
+		}
+
+		// set bus volume
+		void SfxMixer::SetBusVolume(SoundBus bus, float volume)
+		{
+			_buses[(int)bus].Volume = std::max(volume, 0.0f);
+		}
+
+		// get bus volume
+		float SfxMixer::GetBusVolume(SoundBus bus) const
+		{
+			return _buses[(int)bus].Volume;
+		}
+
+		// add bus insert
+		void SfxMixer::AddInsert(SoundBus bus, SoundDsp dsp)
+		{
+			std::lock_guard<std::mutex> lock(_insertsMutex);
+			std::unique_ptr<InsertsSnapshot> inserts(new InsertsSnapshot(*_inserts));
+			inserts->Inserts[(int)bus].push_back(dsp);
+			inserts->Costs[(int)bus].push_back(std::make_shared<DspCost>());
+			PublishInserts(std::move(inserts));
+		}
+
+		// remove bus insert
+		void SfxMixer::RemoveInsert(SoundBus bus, SoundDsp dsp)
+		{
+			std::lock_guard<std::mutex> lock(_insertsMutex);
+			std::unique_ptr<InsertsSnapshot> snapshot(new InsertsSnapshot(*_inserts));
+			auto& inserts = snapshot->Inserts[(int)bus];
+			auto& costs = snapshot->Costs[(int)bus];
+			for (size_t i = inserts.size(); i > 0; --i)
+			{
+				if (inserts[i - 1] != dsp) { continue; }
+				inserts.erase(inserts.begin() + (i - 1));
+				costs.erase(costs.begin() + (i - 1));
+			}
+			PublishInserts(std::move(snapshot));
+		}
+
+		// publish inserts to audio thread
+		void SfxMixer::PublishInserts(std::unique_ptr<InsertsSnapshot> inserts)
+		{
+			// previous snapshot may still be processed by current mixing, so only free it after audio thread is done with it
+			_publishedInserts.store(inserts.get());
+			WaitForAudioThread();
+			_inserts = std::move(inserts);
+		}
+
+		// get insert processing cost
+		bool SfxMixer::GetInsertCost(SoundBus bus, SoundDsp dsp, double& averageTime, double& maxTime)
+		{
+			std::lock_guard<std::mutex> lock(_insertsMutex);
+			auto& inserts = _inserts->Inserts[(int)bus];
+			auto it = std::find(inserts.begin(), inserts.end(), dsp);
+			if (it == inserts.end()) { return false; }
+			const DspCost& cost = *_inserts->Costs[(int)bus][it - inserts.begin()];
+			uint64_t blocks = cost.Blocks;
+			averageTime = blocks > 0 ? (double)cost.TotalTime / (double)blocks : 0.0;
+			maxTime = (double)cost.MaxTime;
+			return true;
+		}
+
+		// log inserts cost
+		void SfxMixer::LogInsertsCost()
+		{
+			std::lock_guard<std::mutex> lock(_insertsMutex);
+			for (int i = 0; i < (int)SoundBus::_Count; ++i)
+			{
+				auto& costs = _inserts->Costs[i];
+				for (size_t j = 0; j < costs.size(); ++j)
+				{
+					const DspCost& cost = *costs[j];
+					uint64_t blocks = cost.Blocks;
+					BON_ILOG("Bus %d insert %d: %llu blocks, average %.2f us, max %u us.", i, (int)j, (unsigned long long)blocks,
+						blocks > 0 ? (double)cost.TotalTime / (double)blocks : 0.0, (unsigned)cost.MaxTime);
+				}
+			}
+		}
+
+		// wait for audio thread to finish current mixing
+		void SfxMixer::WaitForAudioThread() const
+		{
+			// offline mixer renders from the main thread, and if audio thread is not mixing right now it will see stopped voices when it does
+			if (_offline) { return; }
+			uint64_t epoch = _mixEpoch.load();
+			if ((epoch & 1) == 0) { return; }
+			while (_mixEpoch.load() == epoch)
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		// release samples
+		void SfxMixer::ReleaseSamples(const std::vector<const void*>& data)
+		{
+			// stop whatever is still playing, and make sure audio thread is not reading samples
+			for (int i = 0; i < (int)_voices.size(); ++i)
+			{
+				for (auto samples : data)
+				{
+					if (IsPlaying(i, samples)) { StopVoiceNow(i); break; }
+				}
+			}
+			WaitForAudioThread();
+		}
+
+		// mix into device stream
+		void SfxMixer::MixToDevice(void* stream, int bytes)
+		{
+			// offline mixer only renders when asked to
+			if (_offline || _voices.empty()) { return; }
+
+			// mark that we're mixing, so main thread can wait for us before freeing samples
+			_mixEpoch.fetch_add(1);
+
+			// callback came too late? audio device probably ran out of samples
+			int frameBytes = bytesPerFrame(_format, _channels);
+			int framesCount = bytes / frameBytes;
+			uint64_t bufferDuration = (uint64_t)framesCount * 1000000 / (uint64_t)_frequency;
+			uint64_t startTime = nowMicroseconds();
+			bool underrun = _lastCallbackTime != 0 && startTime - _lastCallbackTime > bufferDuration * 2;
+			_lastCallbackTime = startTime;
+
+			// mix in blocks
+			uint8_t* dest = (uint8_t*)stream;
+			while (framesCount > 0)
+			{
+				int frames = std::min(framesCount, _blockFrames);
+				size_t samples = (size_t)frames * _channels;
+				SfxResampler::ToFloat(_format, dest, _buses[(int)SoundBus::Music].Buffer.data(), samples);
+				MixBlock(_outBuffer.data(), frames, true);
+				SfxResampler::FromFloat(_format, _outBuffer.data(), dest, samples);
+				dest += (size_t)frames * frameBytes;
+				framesCount -= frames;
+			}
+
+			// update stats. callback that took longer than buffer duration also means device ran out of samples
+			uint64_t callbackTime = nowMicroseconds() - startTime;
+			uint64_t load = bufferDuration > 0 ? callbackTime * 100 / bufferDuration : 0;
+			underrun = underrun || callbackTime > bufferDuration;
+			_stats.Callbacks.fetch_add(1, std::memory_order_relaxed);
+			if (underrun) { _stats.Underruns.fetch_add(1, std::memory_order_relaxed); }
+			atomicMax(_stats.MaxCallbackTime, callbackTime);
+			atomicMax(_stats.MaxCallbackLoad, load);
+			_stats.Load[std::min<uint64_t>(load / Stats::LoadBucketSize, Stats::LoadBuckets - 1)].fetch_add(1, std::memory_order_relaxed);
+
+			// done mixing
+			_mixEpoch.fetch_add(1);
+		}
+
+		// render to float buffer
+		void SfxMixer::Render(float* out, int frames)
+		{
+			if (_voices.empty()) { return; }
+			while (frames > 0)
+			{
+				int blockFrames = std::min(frames, _blockFrames);
+				MixBlock(out, blockFrames, false);
+				out += (size_t)blockFrames * _channels;
+				frames -= blockFrames;
+			}
+		}
+
+		// mix a single block
+		void SfxMixer::MixBlock(float* out, int frames, bool haveMusic)
+		{
+			size_t samples = (size_t)frames * _channels;
+
+			// clear buses
+			for (int i = 0; i < (int)SoundBus::_Count; ++i)
+			{
+				if (haveMusic && i == (int)SoundBus::Music) { continue; }
+				memset(_buses[i].Buffer.data(), 0, samples * sizeof(float));
+			}
+
+			// render voices
+			ResampleQuality quality = _quality;
+			for (auto& voice : _voices)
+			{
+				// free stopped voices and skip voices that are not playing.
+				// sequentially consistent with mixing epoch, so voices stopped before 'WaitForAudioThread()' saw us idle are never read
+				int state = voice.State.load();
+				if (state == Stopping)
+				{
+					FreeVoice(voice);
+					continue;
+				}
+				if (state != Playing) { continue; }
+
+				// start fading out, if requested
+				float fadeOutRequest = voice.FadeOutRequest.exchange(0.0f);
+				if (fadeOutRequest > 0.0f)
+				{
+					int fadeOutFrames = std::max((int)(fadeOutRequest * (float)_frequency), 1);
+					if (voice.FadeOutTotal == 0 || fadeOutFrames < voice.FadeOutLeft)
+					{
+						voice.FadeOutTotal = voice.FadeOutLeft = fadeOutFrames;
+					}
+				}
+
+				// render voice samples. virtual voices that already ramped down to silence just advance their position
+				int toRender = (voice.FadeOutTotal > 0) ? std::min(frames, voice.FadeOutLeft) : frames;
+				bool isVirtual = voice.Virtual.load(std::memory_order_relaxed);
+				bool skip = isVirtual && voice.LastGainLeft <= 0.0f && voice.LastGainRight <= 0.0f;
+				if (skip) { voice.LastGainLeft = voice.LastGainRight = 0.0f; }
+				int written = skip ? SkipVoice(voice, toRender) : RenderVoice(voice, toRender, quality);
+
+				// calculate fade factor at block start and end
+				float fadeStart = 1.0f;
+				float fadeEnd = 1.0f;
+				if (voice.FadeInDone < voice.FadeInTotal)
+				{
+					fadeStart = (float)voice.FadeInDone / (float)voice.FadeInTotal;
+					voice.FadeInDone = std::min(voice.FadeInDone + written, voice.FadeInTotal);
+					fadeEnd = (float)voice.FadeInDone / (float)voice.FadeInTotal;
+				}
+				if (voice.FadeOutTotal > 0)
+				{
+					fadeStart *= (float)voice.FadeOutLeft / (float)voice.FadeOutTotal;
+					voice.FadeOutLeft -= written;
+					fadeEnd *= (float)voice.FadeOutLeft / (float)voice.FadeOutTotal;
+				}
+
+				// calculate gains and mix into bus
+				if (written > 0 && !skip)
+				{
+					float gain = isVirtual ? 0.0f : voice.Volume * (1.0f - voice.Distance);
+					float left = gain * voice.PanLeft;
+					float right = gain * voice.PanRight;
+					if (voice.LastGainLeft < 0.0f)
+					{
+						voice.LastGainLeft = left * fadeStart;
+						voice.LastGainRight = right * fadeStart;
+					}
+					mixWithGains(_buses[(int)voice.Bus].Buffer.data(), _voiceBuffer.data(), written, _channels, voice.LastGainLeft, voice.LastGainRight, left * fadeEnd, right * fadeEnd);
+					voice.LastGainLeft = left * fadeEnd;
+					voice.LastGainRight = right * fadeEnd;
+				}
+
+				// voice ended or done fading out? free it
+				if (written < frames)
+				{
+					FreeVoice(voice);
+				}
+			}
+
+			// process buses inserts from published snapshot (without locking), and measure processing time
+			{
+				const InsertsSnapshot* inserts = _publishedInserts.load();
+				uint64_t dspStartTime = nowMicroseconds();
+				for (int b = 0; b < (int)SoundBus::_Count; ++b)
+				{
+					auto& bus = _buses[b];
+					for (size_t i = 0; i < inserts->Inserts[b].size(); ++i)
+					{
+						uint64_t startTime = nowMicroseconds();
+						inserts->Inserts[b][i]->Process(bus.Buffer.data(), frames, _channels, _frequency);
+						uint64_t time = nowMicroseconds() - startTime;
+						DspCost& cost = *inserts->Costs[b][i];
+						cost.Blocks.fetch_add(1, std::memory_order_relaxed);
+						cost.TotalTime.fetch_add(time, std::memory_order_relaxed);
+						atomicMax(cost.MaxTime, time);
+					}
+				}
+				atomicMax(_stats.MaxDspTime, nowMicroseconds() - dspStartTime);
+			}
+
+			// apply buses volume and sum them into output
+			memset(out, 0, samples * sizeof(float));
+			for (auto& bus : _buses)
+			{
+				float volume = bus.Volume;
+				applyGain(bus.Buffer.data(), frames, _channels, bus.LastVolume, volume);
+				bus.LastVolume = volume;
+				addSamples(out, bus.Buffer.data(), samples);
+			}
+		}
+
+		// render voice samples
+		int SfxMixer::RenderVoice(Voice& voice, int frames, ResampleQuality quality)
+		{
+			if (voice.Stream) { return RenderStream(voice, frames, quality); }
+			uint64_t step = SfxResampler::PitchToStep(voice.Pitch);
+			uint64_t end = (uint64_t)voice.Frames << SfxResampler::FractionBits;
+			int written = 0;
+			while (written < frames && voice.Frames > 0)
+			{
+				// resample until output is full or source ends
+				int count = SfxResampler::Resample(_format, voice.Data, voice.Frames, _channels, voice.LoopsLeft != 0, voice.Position, step,
+					_voiceBuffer.data() + (size_t)written * _channels, frames - written, quality);
+				written += count;
+
+				// reached source end? loop or stop
+				if (voice.Position < end)
+				{
+					if (count == 0) { break; }
+				}
+				else
+				{
+					if (voice.LoopsLeft == 0) { break; }
+					if (voice.LoopsLeft > 0) { voice.LoopsLeft--; }
+					voice.Position -= end;
+				}
+			}
+			return written;
+		}
+
+		// advance virtual voice position
+		int SfxMixer::SkipVoice(Voice& voice, int frames)
+		{
+			if (voice.Stream) { return SkipStream(voice, frames); }
+			uint64_t step = SfxResampler::PitchToStep(voice.Pitch);
+			uint64_t end = (uint64_t)voice.Frames << SfxResampler::FractionBits;
+			int skipped = 0;
+			while (skipped < frames && voice.Frames > 0)
+			{
+				// frames until source ends
+				uint64_t framesToEnd = (end - voice.Position + step - 1) / step;
+				if ((uint64_t)(frames - skipped) < framesToEnd)
+				{
+					voice.Position += step * (uint64_t)(frames - skipped);
+					return frames;
+				}
+				voice.Position += step * framesToEnd;
+				skipped += (int)framesToEnd;
+
+				// reached source end? loop or stop
+				if (voice.LoopsLeft == 0) { break; }
+				if (voice.LoopsLeft > 0) { voice.LoopsLeft--; }
+				voice.Position -= end;
+			}
+			return skipped;
+		}
+
+		// render voice samples from stream
+		int SfxMixer::RenderStream(Voice& voice, int frames, ResampleQuality quality)
+		{
+			SoundStream& stream = *voice.Stream;
+			const int history = SoundStream::HistoryFrames;
+			const int ahead = SoundStream::HistoryFrames;
+			uint64_t step = SfxResampler::PitchToStep(voice.Pitch);
+
+			// check end of stream before counting available frames, so we know no more frames will arrive after them
+			bool endOfStream = stream.EndOfStream.load(std::memory_order_acquire);
+			int available = stream.Available();
+
+			// copy history and the frames we need into stream buffer, with silence after them
+			uint64_t neededFrames = (voice.Position + step * (uint64_t)frames) >> SfxResampler::FractionBits;
+			int count = std::min((int)std::min<uint64_t>(neededFrames + ahead + 1, SoundStream::RingFrames), available);
+			bool isLast = endOfStream && count == available;
+			float* buffer = _streamBuffer.data();
+			memcpy(buffer, stream.History.data(), stream.History.size() * sizeof(float));
+			stream.Peek(buffer + (size_t)history * _channels, count);
+			memset(buffer + (size_t)(history + count) * _channels, 0, (size_t)ahead * _channels * sizeof(float));
+
+			// resample up to the last frame that has all filter taps available (or up to the end, if stream ended)
+			uint64_t position = voice.Position + ((uint64_t)history << SfxResampler::FractionBits);
+			uint64_t limit = (uint64_t)(history + count - (isLast ? 0 : ahead)) << SfxResampler::FractionBits;
+			int allowed = (limit > position) ? (int)std::min<uint64_t>((uint64_t)frames, (limit - position + step - 1) / step) : 0;
+			int written = (allowed > 0) ? SfxResampler::Resample(buffer, (uint32_t)(history + count + ahead), _channels, false, position, step, _voiceBuffer.data(), allowed, quality) : 0;
+
+			// consume the frames we passed, and keep the frames before new read position as history
+			int consumed = std::min((int)(position >> SfxResampler::FractionBits) - history, count);
+			memcpy(stream.History.data(), buffer + (size_t)consumed * _channels, stream.History.size() * sizeof(float));
+			stream.Pop(consumed);
+			voice.Position = position - ((uint64_t)(history + consumed) << SfxResampler::FractionBits);
+
+			// stream ended? return what we have. otherwise, decoder didn't keep up - fill with silence and keep playing
+			if (isLast || written == frames) { return written; }
+			_stats.StreamUnderruns.fetch_add(1, std::memory_order_relaxed);
+			memset(_voiceBuffer.data() + (size_t)written * _channels, 0, (size_t)(frames - written) * _channels * sizeof(float));
+			return frames;
+		}
+
+		// advance virtual voice stream
+		int SfxMixer::SkipStream(Voice& voice, int frames)
+		{
+			SoundStream& stream = *voice.Stream;
+			uint64_t step = SfxResampler::PitchToStep(voice.Pitch);
+			bool endOfStream = stream.EndOfStream.load(std::memory_order_acquire);
+			int available = stream.Available();
+
+			// history is no longer continuous
+			std::fill(stream.History.begin(), stream.History.end(), 0.0f);
+
+			// stream ends within these frames? skip to its end
+			uint64_t end = (uint64_t)available << SfxResampler::FractionBits;
+			uint64_t position = voice.Position + step * (uint64_t)frames;
+			if (endOfStream && position >= end)
+			{
+				int skipped = (end > voice.Position) ? (int)((end - voice.Position + step - 1) / step) : 0;
+				stream.Pop(available);
+				voice.Position = 0;
+				return skipped;
+			}
+
+			// consume frames we passed (if decoder didn't keep up, we'll consume the rest later)
+			int consumed = (int)std::min<uint64_t>(position >> SfxResampler::FractionBits, (uint64_t)available);
+			stream.Pop(consumed);
+			voice.Position = position - ((uint64_t)consumed << SfxResampler::FractionBits);
+			return frames;
+		}
+
+		// free voice
+		void SfxMixer::FreeVoice(Voice& voice)
+		{
+			if (voice.Stream)
+			{
+				voice.Stream->Released.store(true, std::memory_order_release);
+				voice.Stream = nullptr;
+			}
+			voice.State.store(Free, std::memory_order_release);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,542 @@
+#include <Sfx/SfxResampler.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+#include <cstring>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+// SSE2 is always available on x86 / x64 builds, AVX is detected on runtime
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BON_RESAMPLER_SSE
+#include <immintrin.h>
+#endif
+
+// gcc and clang require enabling AVX per function
+#if defined(BON_RESAMPLER_SSE) && (defined(__GNUC__) || defined(__clang__))
+#define BON_AVX_FUNC __attribute__((target("avx")))
+#else
+#define BON_AVX_FUNC
+#endif
+
+namespace bon
+{
+	namespace sfx
+	{
+		namespace
+		{
+			// fixed point position
+			const int fractionBits = SfxResampler::FractionBits;
+			const float fractionToFloat = 1.0f / 4294967296.0f;
+
+			// windowed sinc settings
+			const int sincTaps = 8;
+			const int sincPhasesBits = 9;
+			const int sincPhases = 1 << sincPhasesBits;
+			const float sincCutoff = 0.9f;
+
+			/**
+			 * Windowed sinc coefficients table, for every phase between two samples.
+			 */
+			struct SincTable
+			{
+				alignas(32) float Coefficients[(sincPhases + 1) * sincTaps];
+
+				SincTable()
+				{
+					const double pi = 3.14159265358979323846;
+					for (int phase = 0; phase <= sincPhases; ++phase)
+					{
+						double t = (double)phase / sincPhases;
+						float* row = Coefficients + phase * sincTaps;
+						double sum = 0.0;
+						for (int k = 0; k < sincTaps; ++k)
+						{
+							// distance from output point to tap, and blackman window over the taps width
+							double x = (double)(k - (sincTaps / 2 - 1)) - t;
+							double sx = x * sincCutoff;
+							double sinc = (sx == 0.0) ? 1.0 : std::sin(pi * sx) / (pi * sx);
+							double w = (std::abs(x) >= sincTaps / 2) ? 0.0 : 0.42 + 0.5 * std::cos(pi * x / (sincTaps / 2)) + 0.08 * std::cos(2.0 * pi * x / (sincTaps / 2));
+							row[k] = (float)(sinc * w);
+							sum += row[k];
+						}
+
+						// normalize to unity gain
+						for (int k = 0; k < sincTaps; ++k) { row[k] = (float)(row[k] / sum); }
+					}
+				}
+			};
+
+			/**
+			 * Get sinc coefficients table.
+			 */
+			const SincTable& sincTable()
+			{
+				static SincTable table;
+				return table;
+			}
+
+			/**
+			 * Convert sample to float in range -1 to 1.
+			 */
+			inline float sampleValue(int16_t v) { return (float)v * (1.0f / 32768.0f); }
+			inline float sampleValue(float v) { return v; }
+			inline float sampleValue(uint8_t v) { return (float)((int)v - 128) * (1.0f / 128.0f); }
+			inline float sampleValue(int8_t v) { return (float)v * (1.0f / 128.0f); }
+			inline float sampleValue(uint16_t v) { return (float)((int)v - 32768) * (1.0f / 32768.0f); }
+			inline float sampleValue(int32_t v) { return (float)((double)v * (1.0 / 2147483648.0)); }
+
+			/**
+			 * Convert float sample to sample type, with clipping.
+			 */
+			template <typename T>
+			inline T fromFloat(float v)
+			{
+				v = (std::min)((std::max)(v, -1.0f), 1.0f);
+				if constexpr (std::is_same<T, float>::value) { return v; }
+				else if constexpr (std::is_same<T, int16_t>::value) { return (int16_t)std::lrint(v * 32767.0f); }
+				else if constexpr (std::is_same<T, uint8_t>::value) { return (uint8_t)(std::lrint(v * 127.0f) + 128); }
+				else if constexpr (std::is_same<T, int8_t>::value) { return (int8_t)std::lrint(v * 127.0f); }
+				else if constexpr (std::is_same<T, uint16_t>::value) { return (uint16_t)(std::lrint(v * 32767.0f) + 32768); }
+				else { return (int32_t)std::llrint((double)v * 2147483647.0); }
+			}
+
+			/**
+			 * Call function with a typed null pointer matching audio format sample type.
+			 * Return false if format is not supported.
+			 */
+			template <typename Func>
+			bool withSampleType(uint16_t format, Func func)
+			{
+				switch (format)
+				{
+				case AUDIO_U8: func((uint8_t*)nullptr); return true;
+				case AUDIO_S8: func((int8_t*)nullptr); return true;
+				case AUDIO_U16SYS: func((uint16_t*)nullptr); return true;
+				case AUDIO_S16SYS: func((int16_t*)nullptr); return true;
+				case AUDIO_S32SYS: func((int32_t*)nullptr); return true;
+				case AUDIO_F32SYS: func((float*)nullptr); return true;
+				default: return false;
+				}
+			}
+
+			/**
+			 * Get interpolation coefficients for fraction.
+			 */
+			template <int Taps>
+			inline const float* coefficients(uint32_t fraction, float* buffer)
+			{
+				if constexpr (Taps == 2)
+				{
+					float t = (float)fraction * fractionToFloat;
+					buffer[0] = 1.0f - t;
+					buffer[1] = t;
+					return buffer;
+				}
+				else if constexpr (Taps == 4)
+				{
+					// catmull-rom spline
+					float t = (float)fraction * fractionToFloat;
+					float t2 = t * t;
+					float t3 = t2 * t;
+					buffer[0] = -0.5f * t3 + t2 - 0.5f * t;
+					buffer[1] = 1.5f * t3 - 2.5f * t2 + 1.0f;
+					buffer[2] = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
+					buffer[3] = 0.5f * t3 - 0.5f * t2;
+					return buffer;
+				}
+				else
+				{
+					// nearest phase (table has one extra phase for fractions that round up)
+					uint32_t phase = (uint32_t)(((uint64_t)fraction + (1u << (31 - sincPhasesBits))) >> (32 - sincPhasesBits));
+					return sincTable().Coefficients + phase * sincTaps;
+				}
+			}
+
+			/**
+			 * Get first tap offset, relative to current frame.
+			 */
+			template <int Taps>
+			constexpr int firstTap()
+			{
+				return -(Taps / 2 - 1);
+			}
+
+			/**
+			 * Interpolate a frame near source edges, where taps may be out of range.
+			 */
+			template <typename T, int Taps>
+			inline void edgeDot(const T* src, uint32_t srcFrames, int channels, bool loop, int64_t start, const float* c, float* out)
+			{
+				for (int ch = 0; ch < channels; ++ch)
+				{
+					float sum = 0.0f;
+					for (int k = 0; k < Taps; ++k)
+					{
+						int64_t frame = start + k;
+						if (frame < 0 || frame >= (int64_t)srcFrames)
+						{
+							if (!loop) { continue; }
+							frame %= (int64_t)srcFrames;
+							if (frame < 0) { frame += srcFrames; }
+						}
+						sum += c[k] * sampleValue(src[frame * channels + ch]);
+					}
+					out[ch] = sum;
+				}
+			}
+
+#ifdef BON_RESAMPLER_SSE
+			/**
+			 * Load 4 samples as floats.
+			 */
+			inline __m128 load4(const float* p) { return _mm_loadu_ps(p); }
+			inline __m128 load4(const int16_t* p)
+			{
+				__m128i v = _mm_loadl_epi64((const __m128i*)p);
+				return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+			}
+
+			/**
+			 * Sum all 4 floats.
+			 */
+			inline float hsum(__m128 v)
+			{
+				v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+				return _mm_cvtss_f32(_mm_add_ss(v, _mm_shuffle_ps(v, v, 1)));
+			}
+
+			/**
+			 * Get scale to normalize samples loaded with 'load4()'.
+			 */
+			inline float simdScale(const float*) { return 1.0f; }
+			inline float simdScale(const int16_t*) { return 1.0f / 32768.0f; }
+#endif
+
+			/**
+			 * Interpolate a frame with all taps in range.
+			 */
+			template <typename T, int Channels, int Taps>
+			inline void dot(const T* p, int channels, const float* c, float* out)
+			{
+#ifdef BON_RESAMPLER_SSE
+				constexpr bool simdType = std::is_same<T, int16_t>::value || std::is_same<T, float>::value;
+				if constexpr (simdType && Taps >= 4 && Channels == 1)
+				{
+					__m128 acc = _mm_mul_ps(load4(p), _mm_loadu_ps(c));
+					if constexpr (Taps == 8) { acc = _mm_add_ps(acc, _mm_mul_ps(load4(p + 4), _mm_loadu_ps(c + 4))); }
+					out[0] = hsum(acc) * simdScale(p);
+					return;
+				}
+				else if constexpr (simdType && Taps >= 4 && Channels == 2)
+				{
+					// samples are interleaved [L R L R], so every coefficient is duplicated for both channels
+					__m128 acc = _mm_setzero_ps();
+					for (int k = 0; k < Taps; k += 4)
+					{
+						__m128 cv = _mm_loadu_ps(c + k);
+						acc = _mm_add_ps(acc, _mm_mul_ps(load4(p + k * 2), _mm_unpacklo_ps(cv, cv)));
+						acc = _mm_add_ps(acc, _mm_mul_ps(load4(p + k * 2 + 4), _mm_unpackhi_ps(cv, cv)));
+					}
+					acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+					out[0] = _mm_cvtss_f32(acc) * simdScale(p);
+					out[1] = _mm_cvtss_f32(_mm_shuffle_ps(acc, acc, 1)) * simdScale(p);
+					return;
+				}
+#endif
+				const int count = Channels ? Channels : channels;
+				for (int ch = 0; ch < count; ++ch)
+				{
+					float sum = 0.0f;
+					for (int k = 0; k < Taps; ++k)
+					{
+						sum += c[k] * sampleValue(p[k * count + ch]);
+					}
+					out[ch] = sum;
+				}
+			}
+
+			/**
+			 * Resample kernel for given sample type, channels count (0 = any) and taps count.
+			 */
+			template <typename T, int Channels, int Taps>
+			int resampleKernel(const T* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames)
+			{
+				const int count = Channels ? Channels : channels;
+				float buffer[4];
+				int i = 0;
+				for (; i < outFrames; ++i, out += count)
+				{
+					uint64_t index = position >> fractionBits;
+					if (index >= srcFrames) { break; }
+					const float* c = coefficients<Taps>((uint32_t)position, buffer);
+					int64_t start = (int64_t)index + firstTap<Taps>();
+					if (start >= 0 && start + Taps <= (int64_t)srcFrames)
+					{
+						dot<T, Channels, Taps>(src + start * count, count, c, out);
+					}
+					else
+					{
+						edgeDot<T, Taps>(src, srcFrames, count, loop, start, c, out);
+					}
+					position += step;
+				}
+				return i;
+			}
+
+#ifdef BON_RESAMPLER_SSE
+			/**
+			 * Load 8 samples as floats (AVX).
+			 */
+			BON_AVX_FUNC inline __m256 load8(const float* p) { return _mm256_loadu_ps(p); }
+			BON_AVX_FUNC inline __m256 load8(const int16_t* p)
+			{
+				__m128i v = _mm_loadu_si128((const __m128i*)p);
+				__m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+				__m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+			}
+
+			/**
+			 * Windowed sinc kernel for mono / stereo, using AVX for the 8 taps dot product.
+			 */
+			template <typename T, int Channels>
+			BON_AVX_FUNC int sincKernelAvx(const T* src, uint32_t srcFrames, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames)
+			{
+				const float scale = simdScale(src);
+				int i = 0;
+				for (; i < outFrames; ++i, out += Channels)
+				{
+					uint64_t index = position >> fractionBits;
+					if (index >= srcFrames) { break; }
+					const float* c = coefficients<sincTaps>((uint32_t)position, nullptr);
+					int64_t start = (int64_t)index + firstTap<sincTaps>();
+					if (start >= 0 && start + sincTaps <= (int64_t)srcFrames)
+					{
+						const T* p = src + start * Channels;
+						if constexpr (Channels == 1)
+						{
+							__m256 acc = _mm256_mul_ps(load8(p), _mm256_loadu_ps(c));
+							__m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+							out[0] = hsum(sum) * scale;
+						}
+						else
+						{
+							// duplicate coefficients for interleaved [L R L R] samples
+							__m128 c0 = _mm_loadu_ps(c);
+							__m128 c1 = _mm_loadu_ps(c + 4);
+							__m256 d0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(c0, c0)), _mm_unpackhi_ps(c0, c0), 1);
+							__m256 d1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(c1, c1)), _mm_unpackhi_ps(c1, c1), 1);
+							__m256 acc = _mm256_add_ps(_mm256_mul_ps(load8(p), d0), _mm256_mul_ps(load8(p + 8), d1));
+							__m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+							sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+							out[0] = _mm_cvtss_f32(sum) * scale;
+							out[1] = _mm_cvtss_f32(_mm_shuffle_ps(sum, sum, 1)) * scale;
+						}
+					}
+					else
+					{
+						edgeDot<T, sincTaps>(src, srcFrames, Channels, loop, start, c, out);
+					}
+					position += step;
+				}
+				_mm256_zeroupper();
+				return i;
+			}
+#endif
+
+			/**
+			 * Convert samples to floats.
+			 */
+			template <typename T>
+			void loadSamples(const T* src, float* out, size_t count)
+			{
+				size_t i = 0;
+				if constexpr (std::is_same<T, float>::value)
+				{
+					memcpy(out, src, count * sizeof(float));
+					return;
+				}
+#ifdef BON_RESAMPLER_SSE
+				if constexpr (std::is_same<T, int16_t>::value)
+				{
+					const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+					for (; i + 4 <= count; i += 4)
+					{
+						_mm_storeu_ps(out + i, _mm_mul_ps(load4(src + i), scale));
+					}
+				}
+#endif
+				for (; i < count; ++i)
+				{
+					out[i] = sampleValue(src[i]);
+				}
+			}
+
+			/**
+			 * Write floats as samples, with clipping. If source is null, will write silence.
+			 */
+			template <typename T>
+			void storeSamples(const float* src, T* dst, size_t count)
+			{
+				size_t i = 0;
+				if constexpr (std::is_same<T, float>::value)
+				{
+					if (!src)
+					{
+						memset(dst, 0, count * sizeof(float));
+						return;
+					}
+#ifdef BON_RESAMPLER_SSE
+					const __m128 minValue = _mm_set1_ps(-1.0f);
+					const __m128 maxValue = _mm_set1_ps(1.0f);
+					for (; i + 4 <= count; i += 4)
+					{
+						_mm_storeu_ps(dst + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), minValue), maxValue));
+					}
+#endif
+				}
+#ifdef BON_RESAMPLER_SSE
+				if constexpr (std::is_same<T, int16_t>::value)
+				{
+					if (src)
+					{
+						// convert with rounding and saturation, 8 samples at a time
+						const __m128 scale = _mm_set1_ps(32767.0f);
+						for (; i + 8 <= count; i += 8)
+						{
+							__m128i lo = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), scale));
+							__m128i hi = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale));
+							_mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(lo, hi));
+						}
+					}
+				}
+#endif
+				for (; i < count; ++i)
+				{
+					dst[i] = fromFloat<T>(src ? src[i] : 0.0f);
+				}
+			}
+
+			/**
+			 * Pick resample kernel by quality and channels count.
+			 */
+			template <typename T>
+			int resampleDispatch(const T* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality, bool useAvx)
+			{
+				// no pitch and position is on a whole frame? just convert samples
+				if (step == ((uint64_t)1 << fractionBits) && (uint32_t)position == 0)
+				{
+					uint64_t index = position >> fractionBits;
+					if (index >= srcFrames) { return 0; }
+					int count = (int)(std::min)((uint64_t)outFrames, srcFrames - index);
+					loadSamples(src + index * channels, out, (size_t)count * channels);
+					position += (uint64_t)count << fractionBits;
+					return count;
+				}
+
+				switch (quality)
+				{
+				case ResampleQuality::Linear:
+					if (channels == 1) { return resampleKernel<T, 1, 2>(src, srcFrames, channels, loop, position, step, out, outFrames); }
+					if (channels == 2) { return resampleKernel<T, 2, 2>(src, srcFrames, channels, loop, position, step, out, outFrames); }
+					return resampleKernel<T, 0, 2>(src, srcFrames, channels, loop, position, step, out, outFrames);
+
+				case ResampleQuality::Cubic:
+					if (channels == 1) { return resampleKernel<T, 1, 4>(src, srcFrames, channels, loop, position, step, out, outFrames); }
+					if (channels == 2) { return resampleKernel<T, 2, 4>(src, srcFrames, channels, loop, position, step, out, outFrames); }
+					return resampleKernel<T, 0, 4>(src, srcFrames, channels, loop, position, step, out, outFrames);
+
+				default:
+#ifdef BON_RESAMPLER_SSE
+					if constexpr (std::is_same<T, int16_t>::value || std::is_same<T, float>::value)
+					{
+						if (useAvx && channels == 1) { return sincKernelAvx<T, 1>(src, srcFrames, loop, position, step, out, outFrames); }
+						if (useAvx && channels == 2) { return sincKernelAvx<T, 2>(src, srcFrames, loop, position, step, out, outFrames); }
+					}
+#endif
+					if (channels == 1) { return resampleKernel<T, 1, sincTaps>(src, srcFrames, channels, loop, position, step, out, outFrames); }
+					if (channels == 2) { return resampleKernel<T, 2, sincTaps>(src, srcFrames, channels, loop, position, step, out, outFrames); }
+					return resampleKernel<T, 0, sincTaps>(src, srcFrames, channels, loop, position, step, out, outFrames);
+				}
+			}
+		}
+
+		// use AVX kernels
+		bool SfxResampler::_useAvx = false;
+
+		// initialize resampler
+		void SfxResampler::Initialize()
+		{
+#ifdef BON_RESAMPLER_SSE
+			_useAvx = SDL_HasAVX() == SDL_TRUE;
+#endif
+			sincTable();
+			BON_DLOG("Initialize resampler: avx=%d.", (int)_useAvx);
+		}
+
+		// check if format is supported
+		bool SfxResampler::IsFormatSupported(uint16_t format)
+		{
+			return withSampleType(format, [](auto) {});
+		}
+
+		// convert pitch to position step
+		uint64_t SfxResampler::PitchToStep(float pitch)
+		{
+			pitch = (std::min)((std::max)(pitch, MinPitch), MaxPitch);
+			return (uint64_t)((double)pitch * 4294967296.0);
+		}
+
+		// resample frames in any supported format
+		int SfxResampler::Resample(uint16_t format, const void* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality)
+		{
+			int written = 0;
+			withSampleType(format, [&](auto tag)
+			{
+				using T = typename std::remove_pointer<decltype(tag)>::type;
+				written = resampleDispatch((const T*)src, srcFrames, channels, loop, position, step, out, outFrames, quality, _useAvx);
+			});
+			return written;
+		}
+
+		// resample int16 frames
+		int SfxResampler::Resample(const int16_t* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality)
+		{
+			return resampleDispatch(src, srcFrames, channels, loop, position, step, out, outFrames, quality, _useAvx);
+		}
+
+		// resample float frames
+		int SfxResampler::Resample(const float* src, uint32_t srcFrames, int channels, bool loop, uint64_t& position, uint64_t step, float* out, int outFrames, ResampleQuality quality)
+		{
+			return resampleDispatch(src, srcFrames, channels, loop, position, step, out, outFrames, quality, _useAvx);
+		}
+
+		// convert samples to floats
+		void SfxResampler::ToFloat(uint16_t format, const void* src, float* out, size_t count)
+		{
+			if (!withSampleType(format, [&](auto tag)
+			{
+				using T = typename std::remove_pointer<decltype(tag)>::type;
+				loadSamples((const T*)src, out, count);
+			}))
+			{
+				memset(out, 0, count * sizeof(float));
+			}
+		}
+
+		// convert floats to samples
+		void SfxResampler::FromFloat(uint16_t format, const float* src, void* out, size_t count)
+		{
+			withSampleType(format, [&](auto tag)
+			{
+				using T = typename std::remove_pointer<decltype(tag)>::type;
+				storeSamples(src, (T*)out, count);
+			});
+		}
+	}
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <Framework/Point.h>
 #include <Framework/Rectangle.h>
 #include <Sfx/Defs.h>
+#include <Sfx/SfxResampler.h>
 #include <BonEngine.h>
 #include <algorithm>
 
@@ -15,8 +16,6 @@
 #include <SDL2_mixer-2.0.4/include/SDL_mixer.h>
 #pragma warning(pop)
 
-#include <../3rdparty_from_src/custom_mix_pitch/custom_mix_pitch.h>
-
 using namespace bon::framework;
 using namespace bon::assets;
 
@@ -28,7 +27,6 @@ namespace bon
 		// useful info on settings: https://moddb.fandom.com/wiki/SDL_mixer:Tutorials:Playing_a_WAV_Sound_File
 		namespace AudioSpec
 		{
-			int allocatedMixChannelsCount = 0;
 			int frequency = MIX_DEFAULT_FREQUENCY;
 			Uint16 format = MIX_DEFAULT_FORMAT;
 			int channelCount = MIX_DEFAULT_CHANNELS;	
@@ -54,6 +52,22 @@ namespace bon
 			return ((frames * 1000) / AudioSpec::frequency);
 		}
 
+		// max time to wait for stopped voices to fade out before freeing their sound track, in milliseconds
+		const uint32_t releaseWaitTime = 100;
+
+		// free a sound track
+		static void freeTrack(void* track, bool compressed)
+		{
+			if (compressed)
+			{
+				delete (CompressedSound*)track;
+			}
+			else
+			{
+				Mix_FreeChunk((Mix_Chunk*)track);
+			}
+		}
+
 		// music handle for SDL
 		class SDL_MusicHandle : public assets::_MusicHandle
 		{
@@ -115,15 +129,32 @@ namespace bon
 			asset->_DestroyHandle<SDL_MusicHandle>();
 		}
 
-		// chunk (sound) handle for SDL
+		// chunk (sound) handle for SDL.
+		// track is either a decoded SDL_mixer chunk, or a compressed sound we decode while playing
 		class SDLChunkHandle : public assets::_SoundHandle
 		{
+		private:
+
+			// sfx wrapper, to check if sound is playing and stop it
+			SfxSdlWrapper* _sfx;
+
+			// is this a compressed sound
+			bool _compressed;
+
 		public:
 
 			/**
 			 * Create SDL chunk handle.
 			 */
-			SDLChunkHandle(Mix_Chunk* track)
+			SDLChunkHandle(Mix_Chunk* track, SfxSdlWrapper* sfx) : _sfx(sfx), _compressed(false)
+			{
+				Track = track;
+			}
+
+			/**
+			 * Create handle for a compressed sound.
+			 */
+			SDLChunkHandle(CompressedSound* track, SfxSdlWrapper* sfx) : _sfx(sfx), _compressed(true)
 			{
 				Track = track;
 			}
@@ -135,10 +166,31 @@ namespace bon
 			{
 				if (Track) 
 				{
-					Mix_FreeChunk((Mix_Chunk*)(Track));
+					// stop voices playing this sound and stop decoding it. track is freed once voices faded out, so we don't wait for them here
+					_sfx->VoiceManager().StopSound(Samples());
+					if (_compressed)
+					{
+						_sfx->StreamDecoder().ReleaseSource(Compressed());
+					}
+					_sfx->ReleaseTrack(Track, Samples(), _compressed);
 				}
 			}
 
+			/**
+			 * Get if sound is kept compressed.
+			 */
+			inline bool IsCompressed() const { return _compressed; }
+
+			/**
+			 * Get compressed sound (only valid if compressed).
+			 */
+			inline CompressedSound* Compressed() const { return (CompressedSound*)Track; }
+
+			/**
+			 * Get pointer that identifies sound samples on mixer voices (chunk samples, or compressed sound).
+			 */
+			inline const void* Samples() const { return _compressed ? Track : ((Mix_Chunk*)Track)->abuf; }
+
 			/**
 			 * Get track length, in seconds.
 			 *
@@ -146,6 +198,7 @@ namespace bon
 			 */
 			virtual float Length() const override
 			{
+				if (_compressed) { return Compressed()->Length(); }
 				return (float)((float)computeChunkLengthMillisec(((Mix_Chunk*)Track)->alen) / 1000.0f);
 			}
 
@@ -154,14 +207,15 @@ namespace bon
 			*/
 			virtual bool IsPlaying() const override
 			{
-				for (int i = 0; i < AudioSpec::allocatedMixChannelsCount; ++i) 
-				{
-					if (Mix_Playing(i) && Mix_GetChunk(i) == Track) 
-					{
-						return true;
-					}
-				}
-				return false;
+				return _sfx->VoiceManager().IsPlaying(Samples());
+			}
+
+			/**
+			 * Get memory used by the sound data, in bytes.
+			 */
+			virtual size_t MemoryUsage() const override
+			{
+				return _compressed ? Compressed()->Data.size() : (size_t)((Mix_Chunk*)Track)->alen;
 			}
 		};
 
@@ -170,6 +224,31 @@ namespace bon
 		{
 			// get asset path
 			const char* path = asset->Path();
+			SfxSdlWrapper* sfx = (SfxSdlWrapper*)context;
+
+			// decide if to keep sound compressed
+			SoundStorage storage = extraData ? *(SoundStorage*)extraData : SoundStorage::Auto;
+			if (storage == SoundStorage::Auto)
+			{
+				size_t minSize = bon::Features().CompressedSoundsMinSize;
+				SDL_RWops* file = (minSize > 0) ? SDL_RWFromFile(path, "rb") : nullptr;
+				Sint64 size = file ? SDL_RWsize(file) : -1;
+				if (file) { SDL_RWclose(file); }
+				storage = (size >= 0 && (size_t)size >= minSize) ? SoundStorage::Compressed : SoundStorage::Decoded;
+			}
+
+			// load compressed sound. if format is not supported, fall back to decoding it
+			if (storage == SoundStorage::Compressed)
+			{
+				BON_DLOG("Load compressed sound effect from file: %s.", path);
+				CompressedSound* compressed = CompressedSound::Load(path);
+				if (compressed)
+				{
+					asset->_SetHandle(new SDLChunkHandle(compressed, sfx));
+					return;
+				}
+				BON_WLOG("Sound format can't be kept compressed, will decode it instead: %s.", path);
+			}
 			BON_DLOG("Load sound effect from file: %s.", path);
 
 			// load chunk
@@ -181,7 +260,7 @@ namespace bon
 			}
 
 			// set handle
-			SDLChunkHandle* handle = new SDLChunkHandle(sound);
+			SDLChunkHandle* handle = new SDLChunkHandle(sound, sfx);
 			asset->_SetHandle(handle);
 		}
 
@@ -226,25 +305,67 @@ namespace bon
 			bon::_GetEngine().Assets()._SetAssetsInitializer(bon::assets::AssetTypes::Sound, SoundLoader, SoundDisposer, this);
 		}
 
+		// mixer callback, called from the audio thread after SDL_mixer mixed music into stream
+		void mixerPostMix(void* udata, Uint8* stream, int len)
+		{
+			((SfxMixer*)udata)->MixToDevice(stream, len);
+		}
+
 		// actually init audio device
 		void SfxSdlWrapper::InitAudio()
 		{
-			// initialize SDL_mixer
+			// make sure mixer supports audio format
+			SfxResampler::Initialize();
+			if (!SfxResampler::IsFormatSupported(AudioSpec::format))
+			{
+				BON_WLOG("Audio format %d is not supported by mixer, will use native 16 bit instead.", AudioSpec::format);
+				AudioSpec::format = AUDIO_S16SYS;
+			}
+
+			// detach mixer from audio thread, in case we re-init
+			FreePendingTracks(true);
+			Mix_SetPostMix(NULL, NULL);
+
+			// when rendering offline, use the dummy audio driver
+			bool offline = bon::Features().OfflineAudio;
+			if (offline)
+			{
+				BON_DLOG("Using offline audio.");
+				SDL_AudioInit("dummy");
+			}
+
+			// initialize SDL_mixer. if audio device fails to open, fallback to offline audio
 			if (Mix_OpenAudio(AudioSpec::frequency, AudioSpec::format, AudioSpec::channelCount, AudioSpec::chunkSize) < 0)
 			{
-				BON_ELOG("SDL_mixer could not initialize! SDL_mixer Error: %s\n", Mix_GetError());
-				throw InitializeError("SDL_mixer could not initialize!");
+				BON_WLOG("Failed to open audio device, will use offline audio instead. SDL_mixer Error: %s\n", Mix_GetError());
+				offline = true;
+				SDL_AudioInit("dummy");
+				if (Mix_OpenAudio(AudioSpec::frequency, AudioSpec::format, AudioSpec::channelCount, AudioSpec::chunkSize) < 0)
+				{
+					BON_ELOG("SDL_mixer could not initialize! SDL_mixer Error: %s\n", Mix_GetError());
+					throw InitializeError("SDL_mixer could not initialize!");
+				}
 			}
 
-			// allocate mix channels
-			AudioSpec::allocatedMixChannelsCount = Mix_AllocateChannels(MIX_CHANNELS);
+			// sounds are played by engine mixer, so we don't need SDL_mixer channels. SDL_mixer only decodes and plays music
+			Mix_AllocateChannels(0);
+
+			// init mixer with actual device specs and attach it to audio thread
+			int frequency = 0;
+			Uint16 format = 0;
+			int channels = 0;
+			Mix_QuerySpec(&frequency, &format, &channels);
+			int bytesPerFrame = (int)(SDL_AUDIO_BITSIZE(format) / 8) * channels;
+			int voicesCount = SfxVoiceManager::MixerVoicesCount(bon::Features().AudioVoices, bon::Features().AudioVirtualVoices);
+			_mixer.Initialize(frequency, format, channels, voicesCount, AudioSpec::chunkSize / bytesPerFrame, offline);
+			_voiceManager.Initialize(&_mixer, bon::Features().AudioVoices, bon::Features().AudioVirtualVoices);
+			_spatial.Initialize(&_mixer);
+			_streamDecoder.Start(frequency, channels);
+			Mix_SetPostMix(mixerPostMix, &_mixer);
 
 			// print spec and mark as initialized
-			BON_DLOG("Initialize sfx: frequency=%d, format=%d, channels=%d, chunks_size=%d, mix_channels: %d.", AudioSpec::frequency, AudioSpec::format, AudioSpec::channelCount, AudioSpec::chunkSize, AudioSpec::allocatedMixChannelsCount);
+			BON_DLOG("Initialize sfx: frequency=%d, format=%d, channels=%d, chunks_size=%d, voices: %d.", frequency, format, channels, AudioSpec::chunkSize, _mixer.VoicesCount());
 			_wasInit = true;
-
-			// update specs
-			Custom_Mix_UpdateSpecs();
 		}
 
 		// play music track
@@ -262,16 +383,32 @@ namespace bon
 			}
 		}
 
+		// call a function for a channel, or for all channels
+		template <typename Func>
+		void forChannels(SfxMixer& mixer, SoundChannelId channel, Func func)
+		{
+			if (channel == AllChannels)
+			{
+				for (int i = 0; i < mixer.VoicesCount(); ++i) { func(i); }
+			}
+			else if (channel >= 0 && channel < mixer.VoicesCount())
+			{
+				func(channel);
+			}
+		}
+
 		// set channel panning
 		void SfxSdlWrapper::SetChannelPanning(SoundChannelId channel, float panLeft, float panRight)
 		{
-			Mix_SetPanning(channel, (Uint8)(std::min(panLeft, 1.0f) * 255), (Uint8)(std::min(panRight, 1.0f) * 255));
+			panLeft = std::min(std::max(panLeft, 0.0f), 1.0f);
+			panRight = std::min(std::max(panRight, 0.0f), 1.0f);
+			forChannels(_mixer, channel, [&](int i) { _mixer.SetPanning(i, panLeft, panRight); });
 		}
 
 		// set channel distance
 		void SfxSdlWrapper::SetChannelDistance(SoundChannelId channel, float distance)
 		{
-			Mix_SetDistance(channel, (Uint8)(std::min(distance, 1.0f) * 255));
+			forChannels(_mixer, channel, [&](int i) { _mixer.SetDistance(i, distance); });
 		}
 
 		// pause / resume music
@@ -293,15 +430,10 @@ namespace bon
 			Mix_VolumeMusic(max(volume, 0));
 		}
 
-		// make a passthru processor function that does nothing...
-		void noEffect(int chan, void* stream, int len, void* udata)
-		{
-		}
-		
 		// stop playing a channel
 		void SfxSdlWrapper::StopChannel(SoundChannelId channel)
 		{
-			Mix_HaltChannel(channel);
+			forChannels(_mixer, channel, [&](int i) { _mixer.StopVoice(i); });
 		}
 
 		// stop playing music
@@ -313,7 +445,7 @@ namespace bon
 		// fade out sound channel
 		void SfxSdlWrapper::FadeOut(SoundChannelId channel, float fadeOutTime)
 		{
-			Mix_FadeOutChannel(channel, (int)(fadeOutTime * 1000.0f));
+			forChannels(_mixer, channel, [&](int i) { _mixer.FadeOutVoice(i, fadeOutTime); });
 		}
 
 		// fade out music.
@@ -322,83 +454,202 @@ namespace bon
 			Mix_FadeOutMusic((int)(fadeOutTime * 1000.0f));
 		}
 
+		// convert volume to mixer gain
+		static inline float volumeToGain(int volume)
+		{
+			return (float)std::min(std::max(volume, 0), MIX_MAX_VOLUME) / (float)MIX_MAX_VOLUME;
+		}
+
 		// start playing sound
 		SoundChannelId SfxSdlWrapper::PlaySound(assets::SoundAsset sound, int volume, int loops, float pitch, float fadeInTime)
 		{
-			// get chunk and start playing
-			Mix_Chunk* sdlchunk = (Mix_Chunk*)(sound->Handle()->Track);
-			SoundChannelId channel;
-
-			// play sound with fade in
-			if (fadeInTime > 0)
+			// play on a voice (we might not get a voice if all are in use by higher priority sounds)
+			SDLChunkHandle* handle = (SDLChunkHandle*)sound->Handle();
+			if (handle->IsCompressed())
 			{
-				channel = Mix_FadeInChannel(-1, sdlchunk, loops, (int)(fadeInTime * 1000.0f));
+				return _voiceManager.Play(*sound, handle->Samples(), 0, volumeToGain(volume), loops, pitch, fadeInTime, &_streamDecoder);
 			}
-			// play sound immediately
-			else
+			Mix_Chunk* sdlchunk = (Mix_Chunk*)(handle->Track);
+			return _voiceManager.Play(*sound, sdlchunk->abuf, sdlchunk->alen, volumeToGain(volume), loops, pitch, fadeInTime);
+		}
+
+		// start playing sound on emitter
+		SoundChannelId SfxSdlWrapper::PlaySoundAt(SoundEmitterId emitter, assets::SoundAsset sound, int volume, int loops, float pitch, float fadeInTime)
+		{
+			// invalid emitter? don't play
+			if (!_spatial.IsValid(emitter))
 			{
-				channel = Mix_PlayChannel(-1, sdlchunk, loops);
+				BON_WLOG("Called 'PlaySoundAt()' with invalid emitter id: %d.", emitter);
+				return -1;
 			}
-			
-			// if got a valid channel to play on (we might not get a channel if all are in use), set volume and pitch
-			if (channel >= 0) {
 
-				// set volume
-				Mix_Volume(channel, volume);
-
-				// set pitch
-				if (pitch != 1.0f) 
-				{
-					Custom_Mix_RegisterPlaybackSpeedEffect(channel, sdlchunk, pitch, loops, AudioSpec::format);
-				}
-				// disable previously set pitch
-				else 
-				{
-					Mix_RegisterEffect(channel, NULL, NULL, NULL);
-				}
+			// play and bind to emitter
+			SoundChannelId channel = PlaySound(sound, volume, loops, pitch, fadeInTime);
+			if (channel >= 0)
+			{
+				_spatial.Bind(channel, emitter, ((SDLChunkHandle*)sound->Handle())->Samples());
 			}
-
-			// return channel id
 			return channel;
 		}
 
 		// set channel's volume
 		void SfxSdlWrapper::SetVolume(SoundChannelId channel, int volume)
 		{
-			if (Mix_Playing(channel))
-			{
-				Mix_Volume(channel, max(volume, 0));
-			}
+			float gain = volumeToGain(volume);
+			forChannels(_mixer, channel, [&](int i) { _mixer.SetVolume(i, gain); });
 		}
 
 		// check if a given sound is playing on a channel
 		bool SfxSdlWrapper::IsPlaying(SoundAsset sound, SoundChannelId channel) const
 		{
-			// get chunk
-			Mix_Chunk* sdlchunk = (Mix_Chunk*)(sound->Handle()->Track);
+			// get chunk samples
+			const void* samples = ((SDLChunkHandle*)sound->Handle())->Samples();
 
 			// check a single channel
 			if (channel >= 0) 
 			{
-				return Mix_Playing(channel) && Mix_GetChunk(channel) == sdlchunk;
+				return channel < _mixer.VoicesCount() && _mixer.IsPlaying(channel, samples);
 			}
 			// check all channels
-			else 
+			return _voiceManager.IsPlaying(samples);
+		}
+
+		// set channel pitch
+		void SfxSdlWrapper::SetChannelPitch(SoundChannelId channel, float pitch)
+		{
+			forChannels(_mixer, channel, [&](int i) { _mixer.SetPitch(i, pitch); });
+		}
+
+		// get channel pitch
+		float SfxSdlWrapper::GetChannelPitch(SoundChannelId channel) const
+		{
+			if (channel < 0 || channel >= _mixer.VoicesCount()) { return 1.0f; }
+			return _mixer.GetPitch(channel);
+		}
+
+		// update voices
+		void SfxSdlWrapper::Update()
+		{
+			// update spatial first, so voice manager will know which voices are inaudible
+			_spatial.Update();
+			_voiceManager.Update();
+			FreePendingTracks(false);
+			CollectStats();
+		}
+
+		// free sound track once its voices are done
+		void SfxSdlWrapper::ReleaseTrack(void* track, const void* samples, bool compressed)
+		{
+			_pendingReleases.push_back(PendingRelease{ track, samples, compressed, SDL_GetTicks(), false });
+
+			// without audio device nothing fades out (offline mixer only advances when rendering), so free right away
+			if (!_wasInit || _mixer.IsOffline())
+			{
+				FreePendingTracks(true);
+			}
+		}
+
+		// free pending sound tracks
+		void SfxSdlWrapper::FreePendingTracks(bool all)
+		{
+			if (_pendingReleases.empty()) { return; }
+
+			// find tracks that are done playing, or waited long enough
+			uint32_t now = SDL_GetTicks();
+			_releasedSamples.clear();
+			for (auto& release : _pendingReleases)
+			{
+				bool playing = false;
+				if (!all && (now - release.Time) < releaseWaitTime)
+				{
+					for (int i = 0; i < _mixer.VoicesCount() && !playing; ++i)
+					{
+						playing = _mixer.IsPlaying(i, release.Samples);
+					}
+				}
+				release.Ready = !playing;
+				if (release.Ready) { _releasedSamples.push_back(release.Samples); }
+			}
+			if (_releasedSamples.empty()) { return; }
+
+			// stop their voices and wait for audio thread once for all of them, then free them
+			_mixer.ReleaseSamples(_releasedSamples);
+			for (size_t i = 0; i < _pendingReleases.size();)
 			{
-				for (int i = 0; i < AudioSpec::allocatedMixChannelsCount; ++i) 
+				if (_pendingReleases[i].Ready)
 				{
-					if (IsPlaying(sound, i)) { return true; }
+					freeTrack(_pendingReleases[i].Track, _pendingReleases[i].Compressed);
+					_pendingReleases[i] = _pendingReleases.back();
+					_pendingReleases.pop_back();
+					continue;
 				}
+				++i;
+			}
+		}
+
+		// set diagnostics counter value
+		static inline void setCounter(bon::diagnostics::IDiagnostics& diagnostics, DiagnosticsCounters counter, uint64_t value)
+		{
+			diagnostics.ResetCounter(counter);
+			diagnostics._IncreaseCounter((int)counter, (long)value);
+		}
+
+		// collect audio thread stats
+		void SfxSdlWrapper::CollectStats()
+		{
+			// counters
+			SfxMixer::Stats& stats = _mixer.GetStats();
+			auto& diagnostics = _GetEngine().Diagnostics();
+			uint64_t underruns = stats.Underruns;
+			uint32_t maxCallbackTime = stats.MaxCallbackTime.exchange(0);
+			uint32_t maxCallbackLoad = stats.MaxCallbackLoad.exchange(0);
+			setCounter(diagnostics, DiagnosticsCounters::AudioCallbacks, stats.Callbacks);
+			setCounter(diagnostics, DiagnosticsCounters::AudioUnderruns, underruns);
+			setCounter(diagnostics, DiagnosticsCounters::AudioStreamUnderruns, stats.StreamUnderruns);
+			setCounter(diagnostics, DiagnosticsCounters::AudioCallbackLoad, maxCallbackLoad);
+			setCounter(diagnostics, DiagnosticsCounters::AudioDspTime, stats.MaxDspTime.exchange(0));
+
+			// callbacks load histogram
+			auto& histogram = diagnostics.GetHistogram(DiagnosticsHistograms::AudioCallbackLoad);
+			for (int i = 0; i < SfxMixer::Stats::LoadBuckets; ++i)
+			{
+				uint32_t count = stats.Load[i].exchange(0);
+				if (count > 0) { histogram.Add((long)i * SfxMixer::Stats::LoadBucketSize, (long)count); }
+			}
+			histogram.Max = std::max(histogram.Max, (long)maxCallbackLoad);
+
+			// log new underruns, up to once per second
+			if (underruns > _loggedUnderruns && SDL_GetTicks() - _lastUnderrunsLogTime >= 1000)
+			{
+				BON_WLOG("Audio underruns: %llu new (%llu total). Longest callback in last frame: %u us (%u%% of buffer duration).",
+					(unsigned long long)(underruns - _loggedUnderruns), (unsigned long long)underruns, maxCallbackTime, maxCallbackLoad);
+				_loggedUnderruns = underruns;
+				_lastUnderrunsLogTime = SDL_GetTicks();
 			}
+		}
 
-			// not playing
-			return false;
+		// log audio stats
+		void SfxSdlWrapper::LogAudioStats()
+		{
+			auto& diagnostics = _GetEngine().Diagnostics();
+			BON_ILOG("Audio stats: %ld callbacks, %ld underruns, %ld stream underruns.", diagnostics.GetCounter(DiagnosticsCounters::AudioCallbacks),
+				diagnostics.GetCounter(DiagnosticsCounters::AudioUnderruns), diagnostics.GetCounter(DiagnosticsCounters::AudioStreamUnderruns));
+			auto& histogram = diagnostics.GetHistogram(DiagnosticsHistograms::AudioCallbackLoad);
+			for (int i = 0; i < DiagnosticsHistogram::BucketsCount; ++i)
+			{
+				if (histogram.Buckets[i] == 0) { continue; }
+				BON_ILOG("Audio callbacks load %ld%%%s: %ld callbacks.", (long)i * histogram.BucketSize, (i == DiagnosticsHistogram::BucketsCount - 1) ? " and above" : "", histogram.Buckets[i]);
+			}
+			_mixer.LogInsertsCost();
 		}
 
 		// dispose sfx imp
 		void SfxSdlWrapper::Dispose()
 		{
-			Mix_HaltChannel(-1);
+			FreePendingTracks(true);
+			_wasInit = false;
+			Mix_SetPostMix(NULL, NULL);
+			_streamDecoder.Stop();
 			Mix_HaltMusic();
 			Mix_CloseAudio();
 			Mix_Quit();
@@ -0,0 +1,489 @@
+#include <Sfx/SfxSoundStream.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <cstring>
+#include <chrono>
+
+#pragma warning(push, 0)
+#include <SDL2-2.0.12/include/SDL.h>
+#pragma warning(pop)
+
+namespace bon
+{
+	namespace sfx
+	{
+		namespace
+		{
+			// vorbis library, loaded on first use. we only declare the parts of its API we use
+			namespace vorbis
+			{
+				// error code for interruption in data, which is recoverable
+				const long HoleError = -3;
+
+				// io callbacks
+				struct Callbacks
+				{
+					size_t (*Read)(void* ptr, size_t size, size_t count, void* datasource);
+					int (*Seek)(void* datasource, int64_t offset, int whence);
+					int (*Close)(void* datasource);
+					long (*Tell)(void* datasource);
+				};
+
+				// stream info
+				struct Info
+				{
+					int Version;
+					int Channels;
+					long Rate;
+					long BitrateUpper;
+					long BitrateNominal;
+					long BitrateLower;
+					long BitrateWindow;
+					void* CodecSetup;
+				};
+
+				// library functions
+				int (*ov_open_callbacks)(void* datasource, void* vf, const char* initial, long ibytes, Callbacks callbacks) = nullptr;
+				int (*ov_clear)(void* vf) = nullptr;
+				Info* (*ov_info)(void* vf, int link) = nullptr;
+				int64_t (*ov_pcm_total)(void* vf, int i) = nullptr;
+				int (*ov_pcm_seek)(void* vf, int64_t pos) = nullptr;
+				long (*ov_read)(void* vf, char* buffer, int length, int bigendianp, int word, int sgned, int* bitstream) = nullptr;
+
+				// load library, return if available
+				bool load()
+				{
+					static std::once_flag loadFlag;
+					static bool loaded = false;
+					std::call_once(loadFlag, []()
+					{
+						void* lib = SDL_LoadObject("libvorbisfile-3.dll");
+						if (lib == nullptr) { lib = SDL_LoadObject("libvorbisfile.so.3"); }
+						if (lib == nullptr)
+						{
+							BON_WLOG("Vorbis library is not available, compressed ogg sounds are not supported.");
+							return;
+						}
+						ov_open_callbacks = (decltype(ov_open_callbacks))SDL_LoadFunction(lib, "ov_open_callbacks");
+						ov_clear = (decltype(ov_clear))SDL_LoadFunction(lib, "ov_clear");
+						ov_info = (decltype(ov_info))SDL_LoadFunction(lib, "ov_info");
+						ov_pcm_total = (decltype(ov_pcm_total))SDL_LoadFunction(lib, "ov_pcm_total");
+						ov_pcm_seek = (decltype(ov_pcm_seek))SDL_LoadFunction(lib, "ov_pcm_seek");
+						ov_read = (decltype(ov_read))SDL_LoadFunction(lib, "ov_read");
+						loaded = ov_open_callbacks && ov_clear && ov_info && ov_pcm_total && ov_pcm_seek && ov_read;
+						if (!loaded) { BON_WLOG("Vorbis library is missing functions, compressed ogg sounds are not supported."); }
+					});
+					return loaded;
+				}
+
+				// read from stream source data
+				size_t readCallback(void* ptr, size_t size, size_t count, void* datasource)
+				{
+					SoundStream* stream = (SoundStream*)datasource;
+					const std::vector<uint8_t>& data = stream->Source->Data;
+					size_t bytes = std::min(size * count, data.size() - stream->SourceOffset);
+					memcpy(ptr, data.data() + stream->SourceOffset, bytes);
+					stream->SourceOffset += bytes;
+					return size > 0 ? bytes / size : 0;
+				}
+
+				// seek in stream source data
+				int seekCallback(void* datasource, int64_t offset, int whence)
+				{
+					SoundStream* stream = (SoundStream*)datasource;
+					int64_t size = (int64_t)stream->Source->Data.size();
+					int64_t position = (whence == SEEK_CUR) ? (int64_t)stream->SourceOffset + offset : (whence == SEEK_END) ? size + offset : offset;
+					if (position < 0 || position > size) { return -1; }
+					stream->SourceOffset = (size_t)position;
+					return 0;
+				}
+
+				// close stream source data (nothing to do, data belongs to sound)
+				int closeCallback(void* /*datasource*/)
+				{
+					return 0;
+				}
+
+				// get position in stream source data
+				long tellCallback(void* datasource)
+				{
+					return (long)((SoundStream*)datasource)->SourceOffset;
+				}
+
+				// open stream for decoding
+				bool open(SoundStream& stream)
+				{
+					static_assert(sizeof(stream.VorbisFile) >= 1024, "Vorbis decoder state storage is too small.");
+					stream.SourceOffset = 0;
+					stream.VorbisOpen = ov_open_callbacks(&stream, stream.VorbisFile, nullptr, 0, { readCallback, seekCallback, closeCallback, tellCallback }) == 0;
+					return stream.VorbisOpen;
+				}
+			}
+
+			// read whole file into memory
+			bool readFile(const char* path, std::vector<uint8_t>& out)
+			{
+				SDL_RWops* file = SDL_RWFromFile(path, "rb");
+				if (file == nullptr) { return false; }
+				Sint64 size = SDL_RWsize(file);
+				bool ret = size >= 0;
+				if (ret)
+				{
+					out.resize((size_t)size);
+					ret = SDL_RWread(file, out.data(), 1, (size_t)size) == (size_t)size;
+				}
+				SDL_RWclose(file);
+				return ret;
+			}
+		}
+
+		// load compressed sound
+		CompressedSound* CompressedSound::Load(const char* path)
+		{
+			std::unique_ptr<CompressedSound> ret(new CompressedSound());
+			if (!readFile(path, ret->Data)) { return nullptr; }
+
+			// ogg vorbis file - keep file as-is and read its info
+			if (ret->Data.size() >= 4 && memcmp(ret->Data.data(), "OggS", 4) == 0)
+			{
+				if (!vorbis::load()) { return nullptr; }
+				SoundStream probe(1);
+				probe.Source = ret.get();
+				if (!vorbis::open(probe)) { return nullptr; }
+				vorbis::Info* info = vorbis::ov_info(probe.VorbisFile, -1);
+				ret->Codec = Vorbis;
+				ret->Format = AUDIO_S16LSB;
+				ret->Channels = info ? info->Channels : 0;
+				ret->Frequency = info ? (int)info->Rate : 0;
+				ret->Frames = (uint64_t)std::max<int64_t>(vorbis::ov_pcm_total(probe.VorbisFile, -1), 0);
+				vorbis::ov_clear(probe.VorbisFile);
+				return (ret->Channels > 0 && ret->Frequency > 0) ? ret.release() : nullptr;
+			}
+
+			// wav file - keep PCM samples in their source format
+			SDL_AudioSpec spec;
+			Uint8* buffer = nullptr;
+			Uint32 length = 0;
+			if (SDL_LoadWAV_RW(SDL_RWFromConstMem(ret->Data.data(), (int)ret->Data.size()), 1, &spec, &buffer, &length) == nullptr)
+			{
+				return nullptr;
+			}
+			ret->Codec = Pcm;
+			ret->Format = spec.format;
+			ret->Channels = spec.channels;
+			ret->Frequency = spec.freq;
+			ret->Data.assign(buffer, buffer + length);
+			ret->Data.shrink_to_fit();
+			ret->Frames = length / (uint32_t)((SDL_AUDIO_BITSIZE(spec.format) / 8) * std::max<int>(spec.channels, 1));
+			SDL_FreeWAV(buffer);
+			return ret.release();
+		}
+
+		// create stream
+		SoundStream::SoundStream(int channels) : Channels(channels)
+		{
+			_ring.assign((size_t)RingFrames * channels, 0.0f);
+			History.assign((size_t)HistoryFrames * channels, 0.0f);
+		}
+
+		// copy frames from ring
+		void SoundStream::Peek(float* out, int frames) const
+		{
+			size_t start = (size_t)(_readPosition.load(std::memory_order_relaxed) & (RingFrames - 1));
+			size_t first = std::min((size_t)frames, RingFrames - start);
+			memcpy(out, _ring.data() + start * Channels, first * Channels * sizeof(float));
+			memcpy(out + first * Channels, _ring.data(), (frames - first) * Channels * sizeof(float));
+		}
+
+		// consume frames from ring
+		void SoundStream::Pop(int frames)
+		{
+			_readPosition.store(_readPosition.load(std::memory_order_relaxed) + frames, std::memory_order_release);
+		}
+
+		// write frames into ring
+		void SoundStream::Push(const float* frames, int count)
+		{
+			uint64_t position = _writePosition.load(std::memory_order_relaxed);
+			size_t start = (size_t)(position & (RingFrames - 1));
+			size_t first = std::min((size_t)count, RingFrames - start);
+			memcpy(_ring.data() + start * Channels, frames, first * Channels * sizeof(float));
+			memcpy(_ring.data(), frames + first * Channels, (count - first) * Channels * sizeof(float));
+			_writePosition.store(position + count, std::memory_order_release);
+		}
+
+		// reset stream before reuse
+		void SoundStream::Reset()
+		{
+			_readPosition = 0;
+			_writePosition = 0;
+			EndOfStream = false;
+			std::fill(History.begin(), History.end(), 0.0f);
+		}
+
+		// stop decoder on destruction
+		SfxStreamDecoder::~SfxStreamDecoder()
+		{
+			Stop();
+		}
+
+		// start decoder thread
+		void SfxStreamDecoder::Start(int frequency, int channels)
+		{
+			Stop();
+			BON_DLOG("Start sounds stream decoder.");
+			_frequency = frequency;
+			_channels = channels;
+			_streams.clear();
+			_running = true;
+			_thread = std::thread(&SfxStreamDecoder::Run, this);
+		}
+
+		// stop decoder thread
+		void SfxStreamDecoder::Stop()
+		{
+			if (!_running) { return; }
+			_running = false;
+			_thread.join();
+
+			// close all streams
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (auto& stream : _streams)
+			{
+				Close(*stream);
+				if (stream->Converter) { SDL_FreeAudioStream(stream->Converter); }
+				stream->Converter = nullptr;
+				stream->InUse = false;
+				stream->Released = true;
+			}
+			_active.clear();
+		}
+
+		// get a stream to play sound on
+		SoundStream* SfxStreamDecoder::Acquire(const CompressedSound* source, int loops)
+		{
+			// find a free stream, or create a new one, and take it
+			SoundStream* ret = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				for (auto& stream : _streams)
+				{
+					if (!stream->InUse) { ret = stream.get(); break; }
+				}
+				if (ret == nullptr)
+				{
+					_streams.push_back(std::make_unique<SoundStream>(_channels));
+					ret = _streams.back().get();
+					ret->SourceBuffer.resize((size_t)DecodeFrames * 8 * sizeof(int32_t));
+					ret->FloatBuffer.resize((size_t)DecodeFrames * _channels);
+				}
+				ret->InUse = true;
+			}
+
+			// open it and decode a short block from sound beginning, so it can start playing right away. decoder thread will fill the rest.
+			// stream is not active yet, so decoder thread won't touch it and we don't need to hold the mutex
+			ret->Reset();
+			ret->Source = source;
+			ret->LoopsLeft = loops;
+			bool opened = Open(*ret);
+			if (opened) { Fill(*ret, PrefillFrames); }
+			else { Close(*ret); }
+
+			// start decoding it on decoder thread, or return it to pool if failed
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!opened)
+			{
+				ret->InUse = false;
+				return nullptr;
+			}
+			ret->Released = false;
+			_active.push_back(ret);
+			return ret;
+		}
+
+		// close streams decoding sound
+		void SfxStreamDecoder::ReleaseSource(const CompressedSound* source)
+		{
+			// streams stay in use until the mixer releases them, we just stop decoding (waiting for decoder thread if its decoding the stream right now)
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (auto stream : _active)
+			{
+				std::lock_guard<std::mutex> decodeLock(stream->DecodeMutex);
+				if (stream->Source == source)
+				{
+					Close(*stream);
+					stream->EndOfStream = true;
+				}
+			}
+		}
+
+		// decoder thread main loop
+		void SfxStreamDecoder::Run()
+		{
+			while (_running)
+			{
+				// return streams released by mixer to pool, and take the list of streams to decode
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					for (size_t i = 0; i < _active.size();)
+					{
+						SoundStream* stream = _active[i];
+						if (stream->Released.load(std::memory_order_acquire))
+						{
+							Close(*stream);
+							stream->InUse = false;
+							_active[i] = _active.back();
+							_active.pop_back();
+							continue;
+						}
+						++i;
+					}
+					_decoding = _active;
+				}
+
+				// decode more, without holding the mutex so starting sounds won't wait for us.
+				// only this thread returns streams to pool, so they stay valid while decoding
+				for (auto stream : _decoding)
+				{
+					std::lock_guard<std::mutex> decodeLock(stream->DecodeMutex);
+					Fill(*stream);
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(SleepTime));
+			}
+		}
+
+		// open stream decoder
+		bool SfxStreamDecoder::Open(SoundStream& stream)
+		{
+			const CompressedSound& source = *stream.Source;
+
+			// create converter to mixer format, or reuse it if source format didn't change
+			if (stream.Converter && stream.ConverterFormat == source.Format && stream.ConverterChannels == source.Channels && stream.ConverterFrequency == source.Frequency)
+			{
+				SDL_AudioStreamClear(stream.Converter);
+			}
+			else
+			{
+				if (stream.Converter) { SDL_FreeAudioStream(stream.Converter); }
+				stream.Converter = SDL_NewAudioStream(source.Format, (Uint8)source.Channels, source.Frequency, AUDIO_F32SYS, (Uint8)_channels, _frequency);
+				stream.ConverterFormat = source.Format;
+				stream.ConverterChannels = source.Channels;
+				stream.ConverterFrequency = source.Frequency;
+				if (stream.Converter == nullptr)
+				{
+					BON_ELOG("Failed to create audio converter for compressed sound! SDL Error: %s\n", SDL_GetError());
+					return false;
+				}
+			}
+			stream.Flushed = false;
+
+			// open source
+			stream.SourceOffset = 0;
+			if (source.Codec == CompressedSound::Vorbis && !vorbis::open(stream))
+			{
+				BON_ELOG("Failed to open compressed ogg sound for decoding.");
+				return false;
+			}
+			return true;
+		}
+
+		// close stream decoder
+		void SfxStreamDecoder::Close(SoundStream& stream)
+		{
+			if (stream.VorbisOpen)
+			{
+				vorbis::ov_clear(stream.VorbisFile);
+				stream.VorbisOpen = false;
+			}
+			stream.Source = nullptr;
+		}
+
+		// decode into stream ring
+		void SfxStreamDecoder::Fill(SoundStream& stream, int maxFrames)
+		{
+			while (stream.Source && !stream.EndOfStream.load(std::memory_order_relaxed))
+			{
+				// ring is full or decoded enough? done for now
+				int frames = std::min(std::min(stream.FreeSpace(), DecodeFrames), maxFrames);
+				if (frames <= 0) { return; }
+
+				// get converted frames
+				int frameBytes = (int)sizeof(float) * _channels;
+				int bytes = SDL_AudioStreamGet(stream.Converter, stream.FloatBuffer.data(), frames * frameBytes);
+				if (bytes > 0)
+				{
+					stream.Push(stream.FloatBuffer.data(), bytes / frameBytes);
+					maxFrames -= bytes / frameBytes;
+					continue;
+				}
+
+				// converter is empty, and we already flushed it (or it failed)? stream ended
+				if (bytes < 0 || stream.Flushed)
+				{
+					stream.EndOfStream.store(true, std::memory_order_release);
+					return;
+				}
+
+				// decode more source samples, or flush converter remains if source ended
+				if (!DecodeChunk(stream))
+				{
+					SDL_AudioStreamFlush(stream.Converter);
+					stream.Flushed = true;
+				}
+			}
+		}
+
+		// decode next chunk of source samples
+		bool SfxStreamDecoder::DecodeChunk(SoundStream& stream)
+		{
+			const CompressedSound& source = *stream.Source;
+			int frameBytes = (int)(SDL_AUDIO_BITSIZE(source.Format) / 8) * source.Channels;
+			int chunkBytes = std::min(DecodeFrames * frameBytes, (int)stream.SourceBuffer.size());
+
+			// try twice - second time after rewinding, if sound loops
+			for (int attempt = 0; attempt < 2; ++attempt)
+			{
+				// raw PCM - feed directly from source data
+				if (source.Codec == CompressedSound::Pcm)
+				{
+					int bytes = (int)std::min((size_t)chunkBytes, source.Data.size() - stream.SourceOffset);
+					if (bytes > 0)
+					{
+						SDL_AudioStreamPut(stream.Converter, source.Data.data() + stream.SourceOffset, bytes);
+						stream.SourceOffset += (size_t)bytes;
+						return true;
+					}
+				}
+				// vorbis - decode into temp buffer
+				else
+				{
+					int bitstream = 0;
+					long bytes = vorbis::HoleError;
+					while (bytes == vorbis::HoleError)
+					{
+						bytes = vorbis::ov_read(stream.VorbisFile, (char*)stream.SourceBuffer.data(), chunkBytes, 0, 2, 1, &bitstream);
+					}
+					if (bytes > 0)
+					{
+						SDL_AudioStreamPut(stream.Converter, stream.SourceBuffer.data(), (int)bytes);
+						return true;
+					}
+				}
+
+				// reached source end - rewind if need to loop
+				if (stream.LoopsLeft == 0) { return false; }
+				if (stream.LoopsLeft > 0) { stream.LoopsLeft--; }
+				if (source.Codec == CompressedSound::Pcm)
+				{
+					stream.SourceOffset = 0;
+				}
+				else if (vorbis::ov_pcm_seek(stream.VorbisFile, 0) != 0)
+				{
+					return false;
+				}
+			}
+			return false;
+		}
+	}
+}
\ No newline at end of file
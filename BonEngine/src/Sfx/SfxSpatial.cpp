@@ -0,0 +1,256 @@
+#include <Sfx/SfxSpatial.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+#include <cmath>
+
+// SSE2 is always available on x86 / x64 builds
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BON_SPATIAL_SSE
+#include <immintrin.h>
+#endif
+
+using namespace bon::framework;
+
+namespace bon
+{
+	namespace sfx
+	{
+		namespace
+		{
+			// degrees to radians
+			const float degreesToRadians = 3.14159265358979f / 180.0f;
+
+			// to avoid division by zero
+			const float minRange = 0.0001f;
+		}
+
+		// init spatial audio
+		void SfxSpatial::Initialize(SfxMixer* mixer)
+		{
+			_mixer = mixer;
+			_bindings.clear();
+		}
+
+		// set listener
+		void SfxSpatial::SetListener(const PointF& position, float rotation)
+		{
+			_listenerPosition = position;
+			_listenerRotation = rotation;
+		}
+
+		// create emitter
+		SoundEmitterId SfxSpatial::CreateEmitter(const PointF& position, float minDistance, float maxDistance, SoundRolloff rolloff)
+		{
+			// no free emitters? grow arrays by 4, so vectorized pass never needs a tail
+			if (_freeEmitters.empty())
+			{
+				size_t prevSize = _positionsX.size();
+				size_t newSize = prevSize + 4;
+				_positionsX.resize(newSize, 0.0f);
+				_positionsY.resize(newSize, 0.0f);
+				_minDistances.resize(newSize, 0.0f);
+				_maxDistances.resize(newSize, -1.0f);
+				_rolloffs.resize(newSize, 0.0f);
+				_gains.resize(newSize, 0.0f);
+				_pansLeft.resize(newSize, 1.0f);
+				_pansRight.resize(newSize, 1.0f);
+				for (size_t i = newSize; i > prevSize; --i)
+				{
+					_freeEmitters.push_back((SoundEmitterId)(i - 1));
+				}
+			}
+
+			// set emitter
+			SoundEmitterId ret = _freeEmitters.back();
+			_freeEmitters.pop_back();
+			SetEmitterPosition(ret, position);
+			SetEmitterRolloff(ret, minDistance, maxDistance, rolloff);
+			return ret;
+		}
+
+		// destroy emitter
+		void SfxSpatial::DestroyEmitter(SoundEmitterId emitter)
+		{
+			if (!IsValid(emitter)) { return; }
+			_maxDistances[emitter] = -1.0f;
+			_freeEmitters.push_back(emitter);
+			_bindings.erase(std::remove_if(_bindings.begin(), _bindings.end(), [emitter](const Binding& binding) { return binding.Emitter == emitter; }), _bindings.end());
+		}
+
+		// check if emitter is valid
+		bool SfxSpatial::IsValid(SoundEmitterId emitter) const
+		{
+			return emitter >= 0 && emitter < (SoundEmitterId)_maxDistances.size() && _maxDistances[emitter] >= 0.0f;
+		}
+
+		// set emitter position
+		void SfxSpatial::SetEmitterPosition(SoundEmitterId emitter, const PointF& position)
+		{
+			_positionsX[emitter] = position.X;
+			_positionsY[emitter] = position.Y;
+		}
+
+		// get emitter position
+		PointF SfxSpatial::GetEmitterPosition(SoundEmitterId emitter) const
+		{
+			return PointF(_positionsX[emitter], _positionsY[emitter]);
+		}
+
+		// set emitter rolloff
+		void SfxSpatial::SetEmitterRolloff(SoundEmitterId emitter, float minDistance, float maxDistance, SoundRolloff rolloff)
+		{
+			_minDistances[emitter] = std::max(minDistance, minRange);
+			_maxDistances[emitter] = std::max(maxDistance, _minDistances[emitter]);
+			_rolloffs[emitter] = (float)rolloff;
+		}
+
+		// bind voice to emitter
+		void SfxSpatial::Bind(int voice, SoundEmitterId emitter, const void* samples)
+		{
+			// replace previous binding, if voice was reused
+			_bindings.erase(std::remove_if(_bindings.begin(), _bindings.end(), [voice](const Binding& binding) { return binding.Voice == voice; }), _bindings.end());
+			_bindings.push_back({ voice, emitter, samples });
+
+			// set initial gain and panning
+			CalculateEmitter(emitter);
+			_mixer->SetPanning(voice, _pansLeft[emitter], _pansRight[emitter]);
+			_mixer->SetDistance(voice, 1.0f - _gains[emitter]);
+		}
+
+		// update emitters and voices
+		void SfxSpatial::Update()
+		{
+			// no bound voices? skip
+			if (_bindings.empty()) { return; }
+
+			// calculate all emitters
+			CalculateEmitters();
+
+			// collect bound voices, and remove voices that are no longer playing
+			_batchVoices.clear();
+			_batchPansLeft.clear();
+			_batchPansRight.clear();
+			_batchDistances.clear();
+			for (size_t i = 0; i < _bindings.size();)
+			{
+				Binding& binding = _bindings[i];
+				if (!_mixer->IsPlaying(binding.Voice, binding.Samples))
+				{
+					binding = _bindings.back();
+					_bindings.pop_back();
+					continue;
+				}
+				_batchVoices.push_back(binding.Voice);
+				_batchPansLeft.push_back(_pansLeft[binding.Emitter]);
+				_batchPansRight.push_back(_pansRight[binding.Emitter]);
+				_batchDistances.push_back(1.0f - _gains[binding.Emitter]);
+				++i;
+			}
+
+			// push to mixer at once
+			_mixer->SetSpatial(_batchVoices.data(), _batchPansLeft.data(), _batchPansRight.data(), _batchDistances.data(), (int)_batchVoices.size());
+		}
+
+		// calculate all emitters
+		void SfxSpatial::CalculateEmitters()
+		{
+			int count = (int)_positionsX.size();
+#ifdef BON_SPATIAL_SSE
+			// listener transform
+			float angle = _listenerRotation * degreesToRadians;
+			__m128 listenerX = _mm_set1_ps(_listenerPosition.X);
+			__m128 listenerY = _mm_set1_ps(_listenerPosition.Y);
+			__m128 cosAngle = _mm_set1_ps(std::cos(angle));
+			__m128 sinAngle = _mm_set1_ps(std::sin(angle));
+			__m128 panScale = _mm_set1_ps(1.0f / _panDistance);
+
+			// constants
+			__m128 zero = _mm_setzero_ps();
+			__m128 one = _mm_set1_ps(1.0f);
+			__m128 minusOne = _mm_set1_ps(-1.0f);
+			__m128 range = _mm_set1_ps(minRange);
+			__m128 linear = _mm_set1_ps((float)SoundRolloff::Linear);
+			__m128 inverse = _mm_set1_ps((float)SoundRolloff::Inverse);
+
+			// 4 emitters at a time
+			for (int i = 0; i < count; i += 4)
+			{
+				// offset from listener, and distance
+				__m128 dx = _mm_sub_ps(_mm_loadu_ps(&_positionsX[i]), listenerX);
+				__m128 dy = _mm_sub_ps(_mm_loadu_ps(&_positionsY[i]), listenerY);
+				__m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+
+				// all rolloff curves
+				__m128 minDistance = _mm_loadu_ps(&_minDistances[i]);
+				__m128 maxDistance = _mm_loadu_ps(&_maxDistances[i]);
+				__m128 linearGain = _mm_sub_ps(one, _mm_div_ps(_mm_sub_ps(distance, minDistance), _mm_max_ps(_mm_sub_ps(maxDistance, minDistance), range)));
+				__m128 inverseGain = _mm_div_ps(minDistance, _mm_max_ps(distance, minDistance));
+				__m128 inverseSquareGain = _mm_mul_ps(inverseGain, inverseGain);
+
+				// select curve per emitter
+				__m128 rolloff = _mm_loadu_ps(&_rolloffs[i]);
+				__m128 isLinear = _mm_cmpeq_ps(rolloff, linear);
+				__m128 isInverse = _mm_cmpeq_ps(rolloff, inverse);
+				__m128 gain = _mm_or_ps(_mm_and_ps(isInverse, inverseGain), _mm_andnot_ps(isInverse, inverseSquareGain));
+				gain = _mm_or_ps(_mm_and_ps(isLinear, linearGain), _mm_andnot_ps(isLinear, gain));
+
+				// clamp gain, and cull emitters beyond max distance (also culls unused emitters, that have negative max distance)
+				gain = _mm_min_ps(_mm_max_ps(gain, zero), one);
+				gain = _mm_andnot_ps(_mm_cmpgt_ps(distance, maxDistance), gain);
+				_mm_storeu_ps(&_gains[i], gain);
+
+				// panning, by offset on listener's x axis
+				__m128 localX = _mm_add_ps(_mm_mul_ps(dx, cosAngle), _mm_mul_ps(dy, sinAngle));
+				__m128 pan = _mm_min_ps(_mm_max_ps(_mm_mul_ps(localX, panScale), minusOne), one);
+				_mm_storeu_ps(&_pansLeft[i], _mm_min_ps(_mm_sub_ps(one, pan), one));
+				_mm_storeu_ps(&_pansRight[i], _mm_min_ps(_mm_add_ps(one, pan), one));
+			}
+#else
+			for (int i = 0; i < count; ++i)
+			{
+				CalculateEmitter(i);
+			}
+#endif
+		}
+
+		// calculate a single emitter
+		void SfxSpatial::CalculateEmitter(int index)
+		{
+			// offset from listener, and distance
+			float angle = _listenerRotation * degreesToRadians;
+			float dx = _positionsX[index] - _listenerPosition.X;
+			float dy = _positionsY[index] - _listenerPosition.Y;
+			float distance = std::sqrt(dx * dx + dy * dy);
+
+			// calculate gain by rolloff curve
+			float minDistance = _minDistances[index];
+			float maxDistance = _maxDistances[index];
+			float gain = 0.0f;
+			if (distance <= maxDistance)
+			{
+				switch ((SoundRolloff)(int)_rolloffs[index])
+				{
+				case SoundRolloff::Linear:
+					gain = 1.0f - (distance - minDistance) / std::max(maxDistance - minDistance, minRange);
+					break;
+				case SoundRolloff::Inverse:
+					gain = minDistance / std::max(distance, minDistance);
+					break;
+				default:
+					gain = minDistance / std::max(distance, minDistance);
+					gain *= gain;
+					break;
+				}
+				gain = std::min(std::max(gain, 0.0f), 1.0f);
+			}
+			_gains[index] = gain;
+
+			// panning, by offset on listener's x axis
+			float localX = dx * std::cos(angle) + dy * std::sin(angle);
+			float pan = std::min(std::max(localX / _panDistance, -1.0f), 1.0f);
+			_pansLeft[index] = std::min(1.0f - pan, 1.0f);
+			_pansRight[index] = std::min(1.0f + pan, 1.0f);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include <Sfx/SfxVoiceManager.h>
+#include <Diagnostics/IDiagnostics.h>
+#include <Log/ILog.h>
+#include <BonEngine.h>
+#include <algorithm>
+
+namespace bon
+{
+	namespace sfx
+	{
+		// init voice manager
+		void SfxVoiceManager::Initialize(SfxMixer* mixer, int realVoices, int virtualVoices)
+		{
+			_mixer = mixer;
+			_maxRealVoices = std::max(realVoices, 1);
+			_maxVoices = std::min(_maxRealVoices + std::max(virtualVoices, 0), mixer->VoicesCount());
+			_infos.assign((size_t)mixer->VoicesCount(), VoiceInfo());
+			_instances.clear();
+			_frameOneShots.clear();
+			_activeVoices = _realVoices = 0;
+		}
+
+		// play a sound
+		int SfxVoiceManager::Play(const assets::_Sound& sound, const void* samples, uint32_t bytes, float volume, int loops, float pitch, float fadeInTime, SfxStreamDecoder* decoder)
+		{
+			// same one-shot sound already played this frame? coalesce them into a single voice
+			if (loops == 0)
+			{
+				for (auto& oneShot : _frameOneShots)
+				{
+					if (oneShot.first == samples && _mixer->IsPlaying(oneShot.second, samples))
+					{
+						_mixer->SetVolume(oneShot.second, std::max(_mixer->GetVolume(oneShot.second), volume));
+						return oneShot.second;
+					}
+				}
+			}
+
+			// check sound max instances
+			int priority = sound.Priority();
+			VoiceStealPolicy policy = sound.StealPolicy();
+			auto& instances = _instances[samples];
+			PurgeInstances(samples, instances);
+			if (sound.MaxInstances() > 0 && (int)instances.size() >= sound.MaxInstances())
+			{
+				int victim = (policy != VoiceStealPolicy::None) ? PickVictim(instances, policy) : -1;
+				if (victim < 0) { return -1; }
+				Steal(victim);
+			}
+
+			// check if all voices are in use (recount, as some voices may have ended since last update)
+			if (_activeVoices >= _maxVoices)
+			{
+				_activeVoices = 0;
+				_sortedVoices.clear();
+				for (int i = 0; i < (int)_infos.size(); ++i)
+				{
+					VoiceInfo& info = _infos[i];
+					if (info.Samples == nullptr) { continue; }
+					if (!_mixer->IsPlaying(i, info.Samples))
+					{
+						info.Samples = nullptr;
+						continue;
+					}
+					_activeVoices++;
+					if (info.Priority <= priority) { _sortedVoices.push_back(i); }
+				}
+
+				// still full? steal from sounds with lower or same priority
+				if (_activeVoices >= _maxVoices)
+				{
+					int victim = (policy != VoiceStealPolicy::None) ? PickVictim(_sortedVoices, policy) : -1;
+					if (victim < 0) { return -1; }
+					Steal(victim);
+				}
+			}
+
+			// compressed sound? get a stream to decode it into (only now, after we know the sound will play)
+			SoundStream* stream = nullptr;
+			if (decoder)
+			{
+				stream = decoder->Acquire((const CompressedSound*)samples, loops);
+				if (stream == nullptr) { return -1; }
+			}
+
+			// start voice. if all real voices are in use, start as virtual and let next update decide
+			bool startVirtual = _realVoices >= _maxRealVoices;
+			int voice = _mixer->StartVoice(samples, bytes, sound.Bus(), volume, loops, pitch, fadeInTime, startVirtual, stream);
+			if (voice < 0)
+			{
+				if (stream) { stream->Released = true; }
+				return -1;
+			}
+
+			// track new voice
+			VoiceInfo& info = _infos[voice];
+			info.Samples = samples;
+			info.Priority = priority;
+			info.StartOrder = ++_startCounter;
+			_instances[samples].push_back(voice);
+			_activeVoices++;
+			if (!startVirtual) { _realVoices++; }
+			if (loops == 0) { _frameOneShots.push_back(std::make_pair(samples, voice)); }
+			return voice;
+		}
+
+		// check if sound samples are playing
+		bool SfxVoiceManager::IsPlaying(const void* samples) const
+		{
+			auto instances = _instances.find(samples);
+			if (instances == _instances.end()) { return false; }
+			for (int voice : instances->second)
+			{
+				if (_mixer->IsPlaying(voice, samples)) { return true; }
+			}
+			return false;
+		}
+
+		// stop all voices of a sound
+		void SfxVoiceManager::StopSound(const void* samples)
+		{
+			// check all mixer voices, to also stop stolen voices that are still fading out
+			for (int voice = 0; voice < (int)_infos.size(); ++voice)
+			{
+				if (!_mixer->IsPlaying(voice, samples)) { continue; }
+				_mixer->StopVoice(voice);
+				if (_infos[voice].Samples == samples) { _infos[voice].Samples = nullptr; }
+			}
+			_instances.erase(samples);
+		}
+
+		// update real and virtual voices
+		void SfxVoiceManager::Update()
+		{
+			// new frame, so no more coalescing with previous one-shots
+			_frameOneShots.clear();
+
+			// get active voices and their gains
+			_sortedVoices.clear();
+			_gains.resize(_infos.size());
+			for (int i = 0; i < (int)_infos.size(); ++i)
+			{
+				VoiceInfo& info = _infos[i];
+				if (info.Samples == nullptr) { continue; }
+				if (!_mixer->IsPlaying(i, info.Samples))
+				{
+					info.Samples = nullptr;
+					continue;
+				}
+				_gains[i] = _mixer->GetAudibleGain(i);
+				_sortedVoices.push_back(i);
+			}
+
+			// remove finished voices from instances
+			for (auto it = _instances.begin(); it != _instances.end();)
+			{
+				PurgeInstances(it->first, it->second);
+				it = it->second.empty() ? _instances.erase(it) : std::next(it);
+			}
+
+			// sort by priority and then by how audible they are
+			std::sort(_sortedVoices.begin(), _sortedVoices.end(), [this](int a, int b)
+			{
+				if (_infos[a].Priority != _infos[b].Priority) { return _infos[a].Priority > _infos[b].Priority; }
+				return _gains[a] > _gains[b];
+			});
+
+			// mix audible voices up to real voices limit, the rest become virtual
+			_realVoices = 0;
+			for (int voice : _sortedVoices)
+			{
+				bool isReal = _realVoices < _maxRealVoices && _gains[voice] > AudibleGainThreshold;
+				_mixer->SetVirtual(voice, !isReal);
+				if (isReal) { _realVoices++; }
+			}
+			_activeVoices = (int)_sortedVoices.size();
+
+			// update diagnostics
+			auto& diagnostics = _GetEngine().Diagnostics();
+			diagnostics.ResetCounter(DiagnosticsCounters::RealVoices);
+			diagnostics.ResetCounter(DiagnosticsCounters::VirtualVoices);
+			diagnostics.IncreaseCounter(DiagnosticsCounters::RealVoices, _realVoices);
+			diagnostics.IncreaseCounter(DiagnosticsCounters::VirtualVoices, _activeVoices - _realVoices);
+		}
+
+		// pick voice to steal
+		int SfxVoiceManager::PickVictim(const std::vector<int>& candidates, VoiceStealPolicy policy) const
+		{
+			int ret = -1;
+			float retGain = 0.0f;
+			for (int voice : candidates)
+			{
+				// first candidate
+				const VoiceInfo& info = _infos[voice];
+				float gain = (policy == VoiceStealPolicy::Quietest) ? _mixer->GetAudibleGain(voice) : 0.0f;
+				if (ret == -1)
+				{
+					ret = voice;
+					retGain = gain;
+					continue;
+				}
+
+				// prefer lower priority, and then by policy
+				const VoiceInfo& current = _infos[ret];
+				bool better = (info.Priority != current.Priority) ? (info.Priority < current.Priority) :
+					(policy == VoiceStealPolicy::Quietest) ? (gain < retGain) : (info.StartOrder < current.StartOrder);
+				if (better)
+				{
+					ret = voice;
+					retGain = gain;
+				}
+			}
+			return ret;
+		}
+
+		// steal a voice
+		void SfxVoiceManager::Steal(int voice)
+		{
+			// fade out quickly to avoid clicks
+			_mixer->FadeOutVoice(voice, StealFadeOutTime);
+			_GetEngine().Diagnostics().IncreaseCounter(DiagnosticsCounters::StolenVoices);
+
+			// stop tracking it
+			VoiceInfo& info = _infos[voice];
+			auto instances = _instances.find(info.Samples);
+			if (instances != _instances.end())
+			{
+				auto& list = instances->second;
+				list.erase(std::remove(list.begin(), list.end(), voice), list.end());
+			}
+			if (!_mixer->IsVirtual(voice)) { _realVoices--; }
+			info.Samples = nullptr;
+			_activeVoices--;
+		}
+
+		// remove finished voices from instances
+		void SfxVoiceManager::PurgeInstances(const void* samples, std::vector<int>& instances)
+		{
+			instances.erase(std::remove_if(instances.begin(), instances.end(), [&](int voice)
+			{
+				return _infos[voice].Samples != samples || !_mixer->IsPlaying(voice, samples);
+			}), instances.end());
+		}
+	}
+}
\ No newline at end of file
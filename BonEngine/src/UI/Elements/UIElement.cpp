@@ -2,6 +2,9 @@
 #include <Framework/Exceptions.h>
 #include <BonEngine.h>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <climits>
 #include <filesystem>
 namespace fs = std::filesystem;
 using namespace bon::framework;
@@ -54,19 +57,20 @@ namespace bon
 			int offsetRight = 0;
 
 			// iterate columns
-			for (auto columnData : _columns)
+			// note: this is called from layout pass after columns dest rects are updated, moved columns will be updated by the layout pass.
+			for (auto& columnData : _columns)
 			{
-				auto column = columnData.Column;
+				auto& column = columnData.Column;
 				if (columnData.Alignment == UIAlignment::Right)
 				{
-					if (column->_offset.X != -offsetRight) { column->SetOffset(bon::PointI(-offsetRight, 0)); }
-					column->CalcDestRect();
+					bon::PointI offset(-offsetRight, 0);
+					if (column->_offset != offset) { column->_offset = offset; column->MarkDirtyByParent(); }
 					offsetRight += column->GetCalculatedDestRect().Width;
 				}
 				else if (columnData.Alignment == UIAlignment::Left)
 				{
-					if (column->_offset.X != offsetLeft) { column->SetOffset(bon::PointI(offsetLeft, 0)); }
-					column->CalcDestRect();
+					bon::PointI offset(offsetLeft, 0);
+					if (column->_offset != offset) { column->_offset = offset; column->MarkDirtyByParent(); }
 					offsetLeft += column->GetCalculatedDestRect().Width;
 				}
 			}
@@ -84,54 +88,56 @@ namespace bon
 			// add child
 			child->_parent = this;
 			_children.push_back(child);
+			_childNodes.push_back(child.get());
 
-			// update dest rect / dirty
-			_parentLastDestCalcId = (unsigned long)-1;
-			_isDestDirty = true;
-			_destCalcId = -1;
+			// need to re-arrange children
+			_isArrangeDirty = true;
+			MarkLayoutDirty();
 
 			// calculate child dest rect so we can start query its properties right away
+			// note: child still needs a full layout pass, to update its children and cached data
 			child->CalcDestRect();
+			child->MarkDirtyByParent();
 		}
 
 		// get filename or path and convert it to a path relative to the folder we loaded stylesheet from.
 		std::string _UIElement::ToRelativePath(const char* path) const
 		{
-			return fs::path(_stylesheetFolder).append(path).u8string();
+			if (!_style) { return path; }
+			return fs::path(_style->Folder()).append(path).u8string();
 		}
 
 		// init style from config
 		void _UIElement::LoadStyleFrom(const assets::ConfigAsset& config)
 		{
-			// store stylesheet folder
-			_stylesheetFolder = fs::path(config->Path()).parent_path().u8string();
-
-			// load origin and anchor
-			Origin = config->GetPointF("style", "origin", bon::PointF::Zero);
-			_anchor = config->GetPointF("style", "anchor", bon::PointF::Zero);
-
-			// load padding and if should ignore padding
-			RectangleF padding = config->GetRectangleF("style", "padding", RectangleF::Zero);
-			_padding.FromRect(padding);
-			_ignoreParentPadding = config->GetBool("style", "ignore_padding", false);
-			
-			// load margin
-			RectangleF margin = config->GetRectangleF("style", "margin", RectangleF(0, 0, 0, 6));
-			Marging.FromRect(margin);
-
-			// load width and height
-			const char* width = config->GetStr("style", "width", "100p");
-			const char* height = config->GetStr("style", "height", "100p");
-			_size.FromStr(width, height);
-
-			// load behavior stuff
-			Interactive = config->GetBool("behavior", "interactive", true);
-			CaptureInput = config->GetBool("behavior", "capture_input", true);
-			CopyParentState = config->GetBool("behavior", "copy_parent_state", false);
-			Draggable = config->GetBool("behavior", "draggable", false);
-			LimitDragToParentArea = config->GetBool("behavior", "limit_drag_to_parent", true);
-			AutoArrangeChildren = config->GetBool("behavior", "auto_arrange_children", false);
-			ExemptFromAutoArrange = config->GetBool("behavior", "exempt_auto_arrange", false);
+			// get compiled style (parsed once per stylesheet and shared between elements)
+			_style = bon::_GetEngine().UI().GetStyle(config);
+			const UIElementStyle& style = _style->Element;
+
+			// apply style
+			Origin = style.Origin;
+			_anchor = style.Anchor;
+			_padding = style.Padding;
+			_ignoreParentPadding = style.IgnoreParentPadding;
+			Marging = style.Marging;
+			_size = style.Size;
+			FlexGrow = style.FlexGrow;
+
+			// apply behavior
+			Interactive = style.Interactive;
+			CaptureInput = style.CaptureInput;
+			CopyParentState = style.CopyParentState;
+			Draggable = style.Draggable;
+			LimitDragToParentArea = style.LimitDragToParentArea;
+			AutoArrangeChildren = style.AutoArrangeChildren;
+			ExemptFromAutoArrange = style.ExemptFromAutoArrange;
+			CacheAsTexture = style.CacheAsTexture;
+			ClipChildren = style.ClipChildren;
+			ArrangeMode = style.ArrangeMode;
+			ArrangeColumns = style.ArrangeColumns;
+
+			// style changed, need to recalculate layout
+			MarkAsDirty();
 		}
 
 		// remove child element.
@@ -148,7 +154,12 @@ namespace bon
 
 			// remove child
 			child->_parent = nullptr;
-			_children.remove(child);
+			_children.erase(std::remove(_children.begin(), _children.end(), child), _children.end());
+			_childNodes.erase(std::remove(_childNodes.begin(), _childNodes.end(), child.get()), _childNodes.end());
+
+			// need to re-arrange children
+			_isArrangeDirty = true;
+			MarkLayoutDirty();
 		}
 
 		// remove self from parent.
@@ -169,8 +180,9 @@ namespace bon
 		// set if to draw as top layer this element and all its children, recursively.
 		void _UIElement::SetDrawAsTopLayerRecursive(bool drawTopLayer)
 		{
+			if (DrawAsTopLayer != drawTopLayer) { MarkLayoutDirty(); }
 			DrawAsTopLayer = drawTopLayer;
-			for (auto const& child : _children) {
+			for (auto child : _childNodes) {
 				child->SetDrawAsTopLayerRecursive(drawTopLayer);
 			}
 		}
@@ -181,6 +193,13 @@ namespace bon
 			// skip draw if not visible
 			if (!Visible) { return; }
 
+			// draw from cached texture
+			if (CacheAsTexture && !topLayer && !_isRenderingCache)
+			{
+				DrawCached();
+				return;
+			}
+
 			// draw self
 			if (DrawAsTopLayer == topLayer) 
 			{ 
@@ -188,18 +207,82 @@ namespace bon
 			}
 
 			// draw children
-			for (auto child : _children)
+			// note: iterate by index, in case children are added while drawing
+			if (!ClipChildren)
+			{
+				for (size_t i = 0; i < _childNodes.size(); ++i)
+				{
+					_childNodes[i]->Draw(topLayer);
+				}
+				return;
+			}
+
+			// draw children clipped to our region, skipping children that are entirely outside of it
+			// note: top layer is drawn over everything, so we only cull it
+			auto& gfx = bon::_GetEngine().Gfx();
+			auto& diag = bon::_GetEngine().Diagnostics();
+			const RectangleI* currClip = gfx.GetClipRect();
+			bool hadClip = currClip != nullptr;
+			RectangleI prevClip = hadClip ? *currClip : RectangleI::Zero;
+			if (!topLayer)
+			{
+				RectangleI clip = hadClip ? IntersectRects(GetCalculatedDestRect(), prevClip) : GetCalculatedDestRect();
+				gfx.SetClipRect(&clip);
+				diag.IncreaseCounter(diagnostics::DiagnosticsCounters::ClippedUIElements);
+			}
+			for (size_t i = 0; i < _childNodes.size(); ++i)
+			{
+				if (IsChildCulled(_childNodes[i]))
+				{
+					if (!topLayer) { diag.IncreaseCounter(diagnostics::DiagnosticsCounters::CulledUIElements); }
+					continue;
+				}
+				_childNodes[i]->Draw(topLayer);
+			}
+			if (!topLayer)
 			{
-				child->Draw(topLayer);
+				gfx.SetClipRect(hadClip ? &prevClip : nullptr);
 			}
 		}
 
+		// get if a child is entirely outside our clipping region
+		bool _UIElement::IsChildCulled(const _UIElement* child) const
+		{
+			if (!ClipChildren) { return false; }
+			RectangleI region = GetCalculatedDestRect();
+			return !region.Overlaps(child->GetCalculatedDestRect());
+		}
+
+		// get intersection of rectangle with clipping rectangle
+		RectangleI _UIElement::IntersectRects(const RectangleI& rect, const RectangleI& clip)
+		{
+			int left = std::max(rect.Left(), clip.Left());
+			int top = std::max(rect.Top(), clip.Top());
+			int right = std::min(rect.Right(), clip.Right());
+			int bottom = std::min(rect.Bottom(), clip.Bottom());
+			return RectangleI(left, top, std::max(right - left, 0), std::max(bottom - top, 0));
+		}
+
 		// update the UI element and children.
 		void _UIElement::Update(double deltaTime)
 		{
 			// skip update if not visible
 			if (!Visible) { return; }
 
+			// element without parent is positioned in renderable region - check if it was resized
+			if (!_parent)
+			{
+				auto renderSize = bon::_GetEngine().Gfx().RenderableSize();
+				if (renderSize.X != _parentInternalDestRect.Width || renderSize.Y != _parentInternalDestRect.Height)
+				{
+					MarkAsDirty();
+				}
+			}
+
+			// do layout pass if anything changed
+			CheckLayoutProperties();
+			if (_isLayoutDirty) { UpdateLayout(); }
+
 			// update self
 			// special case - force-active (we need this here too, in case someone blocks our update loop)
 			if (ForceActiveState)
@@ -216,35 +299,393 @@ namespace bon
 			// do self updates
 			UpdateSelf(deltaTime); 
 
-			// for auto arrange
-			int offsetY = 0;
-
 			// update children
-			for (auto child : _children)
+			// note: iterate by index, in case children are added while updating
+			for (size_t i = 0; i < _childNodes.size(); ++i)
 			{
-				// update child
+				_UIElement* child = _childNodes[i];
+
+				// visibility or layer changed? mark layout dirty, so cached textures and input router will be updated
+				if (child->Visible != child->_lastVisible || child->DrawAsTopLayer != child->_lastDrawAsTopLayer)
+				{
+					child->_lastVisible = child->Visible;
+					child->_lastDrawAsTopLayer = child->DrawAsTopLayer;
+					MarkLayoutDirty();
+				}
+
+				// skip children outside our clipping region
+				// note: still check their layout properties, so changing their position can bring them back into view
+				if (IsChildCulled(child))
+				{
+					child->CheckLayoutProperties();
+					continue;
+				}
 				child->Update(deltaTime);
+			}
+
+			// updates may have changed layout (for example text was changed), update it now so it will be ready for drawing
+			if (_isLayoutDirty) { UpdateLayout(); }
+		}
+
+		// mark dest rect as dirty
+		void _UIElement::MarkAsDirty()
+		{
+			_isDestDirty = true;
+			if (_parent) { _parent->_isArrangeDirty = true; }
+			MarkLayoutDirty();
+		}
 
-				// auto-arrange children
+		// mark cached textures of this element and its parents as outdated
+		void _UIElement::InvalidateCache()
+		{
+			for (_UIElement* curr = this; curr; curr = curr->_parent)
+			{
+				curr->_isCacheDirty = true;
+			}
+		}
+
+		// draw from cached texture
+		void _UIElement::DrawCached()
+		{
+			auto& gfx = bon::_GetEngine().Gfx();
+
+			// render cached texture again
+			if (_isCacheDirty)
+			{
+				// get region to cache, limited to the region we currently render to (screen or parent cached texture)
+				const PointI& drawOffset = gfx.GetDrawOffset();
+				PointI renderSize = gfx.RenderableSize();
+				int left = INT_MAX, top = INT_MAX, right = INT_MIN, bottom = INT_MIN;
+				CalcCachedRegion(left, top, right, bottom);
+				left = std::max(left, -drawOffset.X);
+				top = std::max(top, -drawOffset.Y);
+				right = std::min(right, renderSize.X - drawOffset.X);
+				bottom = std::min(bottom, renderSize.Y - drawOffset.Y);
+				// note: clear dirty flag before drawing, so children that invalidate cache while drawing (like blinking caret) will keep it dirty
+				_isCacheDirty = false;
+
+				// nothing to draw?
+				if (right <= left || bottom <= top)
+				{
+					_cacheTexture = nullptr;
+					_cacheRect = RectangleI::Zero;
+					return;
+				}
+
+				// create texture if needed (or if size changed)
+				_cacheRect.Set(left, top, right - left, bottom - top);
+				if (!_cacheTexture || _cacheTexture->Width() != _cacheRect.Width || _cacheTexture->Height() != _cacheRect.Height)
+				{
+					_cacheTexture = bon::_GetEngine().Assets().CreateEmptyImage(PointI(_cacheRect.Width, _cacheRect.Height), bon::ImageFilterMode::Nearest);
+				}
+
+				// render self and children into texture
+				// note: disable clipping while rendering the cache, it applies when we draw the cached texture
+				assets::ImageAsset prevTarget = gfx.GetRenderTarget();
+				PointI prevOffset = drawOffset;
+				const RectangleI* currClip = gfx.GetClipRect();
+				bool hadClip = currClip != nullptr;
+				RectangleI prevClip = hadClip ? *currClip : RectangleI::Zero;
+				gfx.SetClipRect(nullptr);
+				gfx.SetRenderTarget(_cacheTexture);
+				gfx.SetDrawOffset(PointI::Zero);
+				gfx.DrawRectangle(RectangleI(0, 0, _cacheRect.Width, _cacheRect.Height), bon::Color(0, 0, 0, 0), true, bon::BlendModes::Opaque);
+				gfx.SetDrawOffset(PointI(-_cacheRect.X, -_cacheRect.Y));
+				_isRenderingCache = true;
+				Draw(false);
+				_isRenderingCache = false;
+				gfx.SetRenderTarget(prevTarget);
+				gfx.SetDrawOffset(prevOffset);
+				gfx.SetClipRect(hadClip ? &prevClip : nullptr);
+			}
+
+			// draw cached texture
+			// note: texture color is premultiplied by alpha, since we rendered with alpha blend on a transparent target
+			if (_cacheTexture)
+			{
+				PointI size(_cacheRect.Width, _cacheRect.Height);
+				gfx.DrawImage(_cacheTexture, PointF((float)_cacheRect.X, (float)_cacheRect.Y), &size, bon::BlendModes::Premultiplied);
+			}
+		}
+
+		// add region this element and visible children cover
+		void _UIElement::CalcCachedRegion(int& left, int& top, int& right, int& bottom) const
+		{
+			// not visible? skip
+			if (!Visible) { return; }
+
+			// add self
+			if (!DrawAsTopLayer)
+			{
+				RectangleI rects[] = { GetCalculatedDestRect(), GetActualDestRect() };
+				for (auto& rect : rects)
+				{
+					if (rect.Empty()) { continue; }
+					left = std::min(left, rect.Left());
+					top = std::min(top, rect.Top());
+					right = std::max(right, rect.Right());
+					bottom = std::max(bottom, rect.Bottom());
+				}
+			}
+
+			// add children
+			for (auto child : _childNodes)
+			{
+				child->CalcCachedRegion(left, top, right, bottom);
+			}
+		}
+
+		// mark that this element and its parents need a layout pass
+		void _UIElement::MarkLayoutDirty()
+		{
+			// layout changes require rendering cached textures again
+			InvalidateCache();
+
+			// note: if an element is dirty its parents are dirty too, so we can stop at first dirty element
+			for (_UIElement* curr = this; curr && !curr->_isLayoutDirty; curr = curr->_parent)
+			{
+				curr->_isLayoutDirty = true;
+			}
+		}
+
+		// check if layout related public fields changed
+		void _UIElement::CheckLayoutProperties()
+		{
+			LayoutProperties& props = _layoutProperties;
+
+			// properties that affect our dest rect
+			if (props.Origin != Origin)
+			{
+				props.Origin = Origin;
+				MarkAsDirty();
+			}
+
+			// properties that affect parent arrangement
+			if (props.ExemptFromAutoArrange != ExemptFromAutoArrange || props.FlexGrow != FlexGrow || props.Marging != Marging)
+			{
+				props.ExemptFromAutoArrange = ExemptFromAutoArrange;
+				props.FlexGrow = FlexGrow;
+				props.Marging = Marging;
+				if (_parent)
+				{
+					_parent->_isArrangeDirty = true;
+					_parent->MarkLayoutDirty();
+				}
+			}
+
+			// properties that affect children arrangement
+			if (props.AutoArrangeChildren != AutoArrangeChildren || props.ArrangeMode != ArrangeMode || props.ArrangeColumns != ArrangeColumns)
+			{
+				props.AutoArrangeChildren = AutoArrangeChildren;
+				props.ArrangeMode = ArrangeMode;
+				props.ArrangeColumns = ArrangeColumns;
+				_isArrangeDirty = true;
+				MarkLayoutDirty();
+			}
+
+			// properties that affect which children are culled
+			if (props.ClipChildren != ClipChildren)
+			{
+				props.ClipChildren = ClipChildren;
+				MarkLayoutDirty();
+			}
+		}
+
+		// run layout pass on dirty elements
+		void _UIElement::UpdateLayout()
+		{
+			// nothing changed in this subtree? skip
+			// note: we clear flag before updating, so changes during the pass will mark us dirty again
+			if (!_isLayoutDirty) { return; }
+			_isLayoutDirty = false;
+			if (!_parent) { _layoutVersion++; }
+
+			// recalculate own dest rect
+			bool regionChanged = false;
+			if (_isDestDirty)
+			{
+				RectangleI prevRect = GetCalculatedDestRect();
+				CalcDestRect();
+				CalcLayoutSelf();
+				regionChanged = GetCalculatedDestRect() != prevRect;
+			}
+			if (_layoutPadding != _padding)
+			{
+				_layoutPadding = _padding;
+				regionChanged = true;
+			}
+
+			// region changed? all children need to be recalculated and re-arranged
+			if (regionChanged)
+			{
+				for (auto child : _childNodes)
+				{
+					child->MarkDirtyByParent();
+				}
+				_isArrangeDirty = true;
+			}
+
+			// update dirty children
+			for (auto child : _childNodes)
+			{
+				if (child->_isLayoutDirty) { child->UpdateLayout(); }
+			}
+
+			// arrange children based on their updated rects, and update children that moved
+			if (_isArrangeDirty)
+			{
+				_isArrangeDirty = false;
+				UpdateColumns();
+				ArrangeChildren();
+				for (auto child : _childNodes)
+				{
+					if (child->_isLayoutDirty) { child->UpdateLayout(); }
+				}
+			}
+		}
+
+		// set position from parent auto arrange
+		void _UIElement::SetArrangedPosition(const int* x, const int* y, int extraWidth)
+		{
+			bool changed = false;
+			if (x && (_anchor.X != 0 || _offset.X != *x))
+			{
+				_anchor.X = 0;
+				_offset.X = *x;
+				changed = true;
+			}
+			if (y && (_anchor.Y != 0 || _offset.Y != *y))
+			{
+				_anchor.Y = 0;
+				_offset.Y = *y;
+				changed = true;
+			}
+			if (_arrangedExtraWidth != extraWidth)
+			{
+				_arrangedExtraWidth = extraWidth;
+				changed = true;
+			}
+			if (changed) { MarkDirtyByParent(); }
+		}
+
+		// arrange children based on arrange mode
+		void _UIElement::ArrangeChildren()
+		{
+			// get children to arrange, and reset flex extra width of children we don't arrange
+			std::vector<_UIElement*> arranged;
+			for (auto child : _childNodes)
+			{
 				if (AutoArrangeChildren && !child->ExemptFromAutoArrange)
+				{
+					arranged.push_back(child);
+				}
+				else if (child->_arrangedExtraWidth != 0)
+				{
+					child->SetArrangedPosition(nullptr, nullptr, 0);
+				}
+			}
+			if (arranged.empty()) { return; }
+
+			// get width of region to arrange children in
+			int regionWidth = _destRect.Width - _padding.Left - _padding.Right;
+
+			// arrange children
+			switch (ArrangeMode)
+			{
+			// stack vertically
+			case UIArrangeMode::Stack:
+			{
+				int offsetY = 0;
+				for (auto child : arranged)
 				{
 					offsetY += child->Marging.Top;
-					if (child->_anchor.Y != 0)
+					child->SetArrangedPosition(nullptr, &offsetY, 0);
+					offsetY += child->GetActualDestRect().Height + child->Marging.Bottom;
+				}
+				break;
+			}
+
+			// stack horizontally
+			case UIArrangeMode::HorizontalStack:
+			{
+				int offsetX = 0;
+				for (auto child : arranged)
+				{
+					offsetX += child->Marging.Left;
+					child->SetArrangedPosition(&offsetX, nullptr, 0);
+					offsetX += child->GetActualDestRect().Width + child->Marging.Right;
+				}
+				break;
+			}
+
+			// grid with fixed columns count
+			case UIArrangeMode::Grid:
+			{
+				int columns = std::max(ArrangeColumns, 1);
+				int cellWidth = regionWidth / columns;
+				int rowY = 0;
+				int rowHeight = 0;
+				for (size_t i = 0; i < arranged.size(); ++i)
+				{
+					_UIElement* child = arranged[i];
+					int column = (int)(i % columns);
+					if (column == 0 && i > 0)
 					{
-						child->_anchor.Y = 0;
-						child->_isDestDirty = true;
+						rowY += rowHeight;
+						rowHeight = 0;
 					}
-					if (child->_offset.Y != offsetY)
+					int x = column * cellWidth + child->Marging.Left;
+					int y = rowY + child->Marging.Top;
+					child->SetArrangedPosition(&x, &y, 0);
+					rowHeight = std::max(rowHeight, child->Marging.Top + child->GetActualDestRect().Height + child->Marging.Bottom);
+				}
+				break;
+			}
+
+			// lines that wrap, with free space divided between growing children
+			case UIArrangeMode::Flex:
+			{
+				auto baseWidth = [](_UIElement* child) { return std::max(child->GetActualDestRect().Width - child->_arrangedExtraWidth, 0); };
+				int lineY = 0;
+				size_t start = 0;
+				while (start < arranged.size())
+				{
+					// find line end and width
+					size_t end = start;
+					int lineWidth = 0;
+					float totalGrow = 0.0f;
+					while (end < arranged.size())
 					{
-						child->_offset.Y = offsetY;
-						child->_isDestDirty = true;
+						_UIElement* child = arranged[end];
+						int width = child->Marging.Left + baseWidth(child) + child->Marging.Right;
+						if (end > start && lineWidth + width > regionWidth) { break; }
+						lineWidth += width;
+						totalGrow += std::max(child->FlexGrow, 0.0f);
+						end++;
 					}
-					if (child->_isDestDirty) 
+
+					// place line children
+					int freeSpace = std::max(regionWidth - lineWidth, 0);
+					int x = 0;
+					int lineHeight = 0;
+					for (size_t i = start; i < end; ++i)
 					{
-						child->CalcDestRect();
+						_UIElement* child = arranged[i];
+						int width = baseWidth(child);
+						int extra = (totalGrow > 0.0f && child->FlexGrow > 0.0f) ? (int)((float)freeSpace * child->FlexGrow / totalGrow) : 0;
+						int posX = x + child->Marging.Left;
+						int posY = lineY + child->Marging.Top;
+						child->SetArrangedPosition(&posX, &posY, extra);
+						x = posX + width + extra + child->Marging.Right;
+						lineHeight = std::max(lineHeight, child->Marging.Top + child->GetActualDestRect().Height + child->Marging.Bottom);
 					}
-					offsetY += child->GetActualDestRect().Height + child->Marging.Bottom;
+
+					// next line
+					lineY += lineHeight;
+					start = end;
 				}
+				break;
+			}
 			}
 		}
 
@@ -273,7 +714,7 @@ namespace bon
 			}
 
 			// draw children
-			for (auto child : _children)
+			for (auto child : _childNodes)
 			{
 				child->DebugDraw(recursive);
 			}
@@ -291,11 +732,12 @@ namespace bon
 			// first update children
 			// note: we iterate in reverse to give priority for elements that hide background elements. for example
 			// if a button is drawn over an image, we want to first allow the button to run.
-			for (auto child = _children.end(); child != _children.begin();)
+			for (size_t i = _childNodes.size(); i > 0; --i)
 			{
-				--child; // <-- must come here and not in the for line
-				(*child)->DoInputUpdates(mousePosition, updateState, topLayer);
+				if (IsChildCulled(_childNodes[i - 1])) { continue; }
+				_childNodes[i - 1]->DoInputUpdates(mousePosition, updateState, topLayer);
 				if (updateState.BreakUpdatesLoop) { break; }
+				if (i > _childNodes.size()) { i = _childNodes.size(); }
 			}
 
 			// now update self
@@ -304,13 +746,16 @@ namespace bon
 			}
 
 			// update children with 'CopyParentState' mode
-			for (auto child : _children)
+			for (auto child : _childNodes)
 			{
 				if (child->CopyParentState) {
 					child->_state = _state;
 					child->_prevState = _prevState;
 				}
 			}
+
+			// state changed? need to render cached textures again
+			if (_state != _prevState) { InvalidateCache(); }
 		}
 
 		// implement just the drawing of this element.
@@ -323,14 +768,7 @@ namespace bon
 		// implement just the updating of this element
 		void _UIElement::UpdateSelf(double deltaTime)
 		{
-			// check if need to recalculate dest rect
-			if (_isDestDirty || (_parent && _parentLastDestCalcId != _parent->_destCalcId))
-			{
-				CalcDestRect();
-			}
-
-			// update columns
-			UpdateColumns();
+			// note: dest rect and columns are updated by the layout pass, in UpdateLayout()
 		}
 		
 		// get drawing color based on element state.
@@ -358,12 +796,19 @@ namespace bon
 			if (_parent == nullptr) { return; }
 
 			// already front? skip
-			if (&(*_parent->_children.back()) == this) { return; }
+			if (_parent->_childNodes.back() == this) { return; }
 
 			// move to front
-			UIElement tempPtrThatDoesntDelete = std::shared_ptr<_UIElement>(this, [](_UIElement*) {});
-			auto item = std::find(_parent->_children.begin(), _parent->_children.end(), tempPtrThatDoesntDelete);
-			_parent->_children.splice(_parent->_children.end(), _parent->_children, item);
+			auto& siblings = _parent->_children;
+			auto item = std::find_if(siblings.begin(), siblings.end(), [this](const UIElement& sibling) { return sibling.get() == this; });
+			std::rotate(item, item + 1, siblings.end());
+			auto& nodes = _parent->_childNodes;
+			auto node = std::find(nodes.begin(), nodes.end(), this);
+			std::rotate(node, node + 1, nodes.end());
+
+			// order changed, parent needs to re-arrange
+			_parent->_isArrangeDirty = true;
+			_parent->MarkLayoutDirty();
 		}
 
 		// implement input updates of this element
@@ -417,7 +862,7 @@ namespace bon
 					if (pressedNow)
 					{
 						_startDragOffsetInElement = framework::PointI(mousePosition.X - _destRect.X, mousePosition.Y - _destRect.Y);
-						_anchor = PointF::Zero;
+						SetAnchor(PointF::Zero);
 						SetOffset(framework::PointI(_destRect.X, _destRect.Y));
 						MoveToFront();
 					}
@@ -460,6 +905,7 @@ namespace bon
 		{
 			UISides padding;
 			if (_parent && !_ignoreParentPadding) { padding = _parent->_padding; }
+			PointI prevOffset = _offset;
 			if (_offset.X < padding.Left) {
 				_offset.X = padding.Left;
 			}
@@ -472,6 +918,7 @@ namespace bon
 			if (_offset.Y + _destRect.Height > _parentInternalDestRect.Height) {
 				_offset.Y = _parentInternalDestRect.Height - _destRect.Height;
 			}
+			if (_offset != prevOffset) { MarkAsDirty(); }
 		}
 
 		// calculate and return coords based on parent, return absolute value in pixels.
@@ -542,17 +989,15 @@ namespace bon
 
 			// calc size
 			auto size = CalcUISize(_size, parentRect, false);
-			_destRect.Width = size.X;
+			_destRect.Width = size.X + _arrangedExtraWidth;
 			_destRect.Height = size.Y;
 
 			// apply origin
 			_destRect.X -= (int)((float)_destRect.Width * Origin.X);
 			_destRect.Y -= (int)((float)_destRect.Height * Origin.Y);
 
-			// no longer dirty + update calc id
+			// no longer dirty
 			_isDestDirty = false;
-			_destCalcId++;
-			if (_parent) { _parentLastDestCalcId = _parent->_destCalcId; }
 		}
 	}
 }
\ No newline at end of file
@@ -37,34 +37,19 @@ namespace bon
 			// load basic stylesheet
 			_UIElement::LoadStyleFrom(config);
 
-			// load source image
-			const char* img = config->GetStr("image", "image_path", nullptr);
-			if (img) { Image = bon::_GetEngine().Assets().LoadImage(ToRelativePath(img).c_str()); }
-
-			// load sliced sides
-			RectangleF slicedSides = config->GetRectangleF("image", "sliced_sides", RectangleF::Zero);
-			SlicedImageSides.FromRect(slicedSides);
-
-			// load colors
-			Color = config->GetColor("image", "color", Color::White);
-			ColorHighlight = config->GetColor("image", "color_highlight", Color);
-			ColorPressed = config->GetColor("image", "color_pressed", Color);
-
-			// load source rects
-			SourceRect = config->GetRectangleF("image", "source_rect", RectangleF::Zero);
-			SourceRectHighlight = config->GetRectangleF("image", "source_rect_highlight", SourceRect);
-			SourceRectPressed = config->GetRectangleF("image", "source_rect_pressed", SourceRect);
-
-			// load blend modes
-			static const char* blendOptions[] = { "opaque", "alpha", "mod", "darken", "multiply", "screen", "invert", "difference", "lighten", "additive", "subtract" };
-			BlendMode = (BlendModes)config->GetOption("image", "blend", blendOptions, (int)BlendModes::AlphaBlend);
-			
-			// load drawing modes
-			static const char* drawModeOptions[] = { "stretch", "tiled", "sliced", "single" };
-			ImageType = (UIImageTypes)config->GetOption("image", "type", drawModeOptions, (int)UIImageTypes::Stretch);
-
-			// texture scale and slice sides
-			TextureScale = config->GetFloat("image", "texture_scale", 1.0f);
+			// apply compiled image style
+			const UIImageStyle& style = GetStyle()->Image;
+			if (style.Image) { Image = style.Image; }
+			SlicedImageSides = style.SlicedImageSides;
+			Color = style.Color;
+			ColorHighlight = style.ColorHighlight;
+			ColorPressed = style.ColorPressed;
+			SourceRect = style.SourceRect;
+			SourceRectHighlight = style.SourceRectHighlight;
+			SourceRectPressed = style.SourceRectPressed;
+			BlendMode = style.BlendMode;
+			ImageType = style.ImageType;
+			TextureScale = style.TextureScale;
 		}
 
 		// implement just the drawing of this element.
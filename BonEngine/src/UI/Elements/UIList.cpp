@@ -1,7 +1,8 @@
 #include <UI/Elements/UIList.h>
 #include <BonEngine.h>
 #include <Gfx/Defs.h>
-#include <list>
+#include <Framework/Exceptions.h>
+#include <algorithm>
 
 using namespace bon::framework;
 using namespace bon::gfx;
@@ -63,49 +64,55 @@ namespace bon
 				_scrollbar = bon::_GetEngine().UI().CreateVerticalScrollbar(ToRelativePath(scrollbarSheet).c_str(), Background);
 			}
 
+			// rows should be created again with new style
+			ClearRows();
+
 			// mark as dirty
 			_listDirty = true;
 		}
 
-		// dd item to list.
+		// add item to list.
 		void _UIList::AddItem(const char* item)
 		{
-			// create item background
-			UIImage itemBack = bon::_GetEngine().UI().CreateImage(nullptr, _itemsContainer);
-			if (_itemsBackgroundSheet.get()) { itemBack->LoadStyleFrom(_itemsBackgroundSheet); }
-
-			// create item text
-			UIText itemText = bon::_GetEngine().UI().CreateText(nullptr, itemBack, item);
-			if (_itemsSheet.get()) { itemText->LoadStyleFrom(_itemsSheet); }
-			itemText->Interactive = itemText->CopyParentState = true;
-
-			// add to items list
-			ListItem litem;
-			litem.Text = itemText;
-			litem.Background = itemBack;
-			_items.push_back(litem);
-
-			// mark list as dirty
-			_listDirty = true;
+			InsertItems((int)_items.size(), &item, 1);
+		}
+
+		// add items to list.
+		void _UIList::AddItems(const std::vector<std::string>& items)
+		{
+			_items.insert(_items.end(), items.begin(), items.end());
 		}
 
-		// get list items list.
-		std::vector<std::string> _UIList::Items() const
+		// insert items to list.
+		void _UIList::InsertItems(int index, const char** items, int count)
 		{
-			std::vector<std::string> ret;
-			for (auto curr : _items)
+			// validate index and items
+			if (index < 0 || index > (int)_items.size())
 			{
-				ret.push_back(curr.Text->GetText());
+				throw framework::InvalidValue("List index to insert items at is out of range!");
 			}
-			return ret;
+			if (count < 0 || (items == nullptr && count > 0))
+			{
+				throw framework::InvalidValue("Invalid items to insert to list!");
+			}
+			for (int i = 0; i < count; ++i)
+			{
+				if (items[i] == nullptr) { throw framework::InvalidValue("Can't insert null item to list!"); }
+			}
+
+			// insert items
+			_items.insert(_items.begin() + index, items, items + count);
+
+			// update selected index directly, selected value remains the same
+			if (_selected >= index) { _selected += count; }
 		}
 
 		// get if list contains a given value.
 		bool _UIList::Contains(const char* value) const
 		{
-			for (auto curr : _items)
+			for (auto& curr : _items)
 			{
-				if (strcmp(curr.Text->GetText(), value) == 0)
+				if (curr == value)
 				{
 					return true;
 				}
@@ -113,62 +120,57 @@ namespace bon
 			return false;
 		}
 
+		// update selection after removing items.
+		void _UIList::OnItemsRemoved(int index, int count)
+		{
+			// selected item was removed
+			if (_selected >= index && _selected < index + count)
+			{
+				ClearSelection();
+			}
+			// selected item moved. update index directly, selected value remains the same
+			else if (_selected >= index + count)
+			{
+				_selected -= count;
+			}
+		}
+
 		// remove item from list.
 		void _UIList::RemoveItem(const char* item, bool removeAll)
 		{
 			// iterate items and remove all or first item that match value
-			int prevSelection = _selected;
-			int index = 0;
-			for (auto curr = _items.begin(); curr != _items.end(); ++curr)
+			for (int index = 0; index < (int)_items.size(); )
 			{
-				// check if need to remove
-				bool remove = strcmp(curr->Text->GetText(), item) == 0;
-				if (remove) {
-
-					// remove elements
-					curr->Text->Remove();
-					curr->Background->Remove();
-
-					// update selected
-					if (index == _selected) { _selected = -1; }
-					else if (index < _selected) { _selected--; }
-					index++;
-
-					// erase from list
-					curr = _items.erase(curr);
-
-					// if remove just one, break here
+				if (_items[index] == item)
+				{
+					RemoveItems(index, 1);
 					if (!removeAll) { break; }
 				}
+				else
+				{
+					index++;
+				}
 			}
-
-			// no selected?
-			if (_selected < 0) { ClearSelection(); }
-			if (prevSelection != _selected && OnValueChange)
-			{
-				OnValueChange(*this, nullptr);
-			}
-
-			// mark list as dirty
-			_listDirty = true;
 		}
 
 		// remove item from list by index
 		void _UIList::RemoveItem(int index)
 		{
-			// remove item
-			std::list<ListItem>::iterator it = _items.begin();
-			std::advance(it, index);
-			it->Text->Remove();
-			it->Background->Remove();
-			_items.erase(it);
-
-			// update selected
-			if (index == _selected) { ClearSelection(); }
-			else if (index < _selected) { Select(_selected - 1); }
-
-			// mark list as dirty
-			_listDirty = true;
+			RemoveItems(index, 1);
+		}
+
+		// remove range of items from list
+		void _UIList::RemoveItems(int index, int count)
+		{
+			// validate range
+			if (index < 0 || count < 0 || index + count > (int)_items.size())
+			{
+				throw framework::InvalidValue("List range of items to remove is out of range!");
+			}
+
+			// remove items and update selection
+			_items.erase(_items.begin() + index, _items.begin() + index + count);
+			OnItemsRemoved(index, count);
 		}
 
 		// set selection
@@ -184,26 +186,14 @@ namespace bon
 		// get currently selected item text.
 		const char* _UIList::SelectedItem() const
 		{
-			if (_selected < 0) { return nullptr; }
-			std::list<ListItem>::iterator it = ((_UIList*)(this))->_items.begin();
-			std::advance(it, _selected);
-			return it->Text->GetText();
+			return _selected >= 0 ? _items[_selected].c_str() : nullptr;
 		}
 
 		// clear list.
 		void _UIList::Clear()
 		{
-			// clear list
-			for (auto curr : _items)
-			{
-				curr.Text->Remove();
-				curr.Background->Remove();
-			}
 			_items.clear();
 			ClearSelection();
-
-			// mark list as dirty
-			_listDirty = true;
 		}
 
 		// select by value
@@ -217,56 +207,109 @@ namespace bon
 			}
 
 			// find item to select
-			int index = 0;
-			for (auto curr : _items)
+			for (size_t i = 0; i < _items.size(); ++i)
 			{
-				if (strcmp(curr.Text->GetText(), item) == 0)
+				if (_items[i] == item)
 				{
-					Select(index);
+					Select((int)i);
 					return;
 				}
-				index++;
 			}
 		}
 
-		// update list items
+		// update rows position and size
 		void _UIList::RebuildListItems()
 		{
-			auto extraOffset = Background->_ExtraPixelsOffset;
+			for (size_t i = 0; i < _rows.size(); ++i)
+			{
+				auto& row = _rows[i];
+				row.Background->SetOffset(bon::PointI(0, (int)i * _lineHeight));
+				row.Background->SetSize(UISize(100, UISizeType::PercentOfParent, _lineHeight, UISizeType::Pixels));
+			}
+		}
 
-			// set items offset and height
-			int i = 0;
-			for (auto item : _items)
+		// remove all rows
+		void _UIList::ClearRows()
+		{
+			for (auto& row : _rows)
 			{
-				// set item index and position
-				item.Index = i;
-				item.Background->SetOffset(bon::PointI(0, i * _lineHeight));
-				item.Background->SetSize(UISize(100, UISizeType::PercentOfParent, _lineHeight, UISizeType::Pixels));
+				row.Background->Remove();
+			}
+			_rows.clear();
+		}
 
-				// set callback
-				item.Background->OnMousePressed = [this, item](_UIElement& self, void* data)
+		// bind rows to visible items
+		void _UIList::BindRows()
+		{
+			// create missing rows
+			while ((int)_rows.size() < _maxVisibleEntitiesInList)
+			{
+				// create row background
+				ListRow row;
+				row.Background = bon::_GetEngine().UI().CreateImage(nullptr, _itemsContainer);
+				if (_itemsBackgroundSheet.get()) { row.Background->LoadStyleFrom(_itemsBackgroundSheet); }
+				row.Background->SetDrawAsTopLayerRecursive(DrawAsTopLayer);
+
+				// create row text
+				row.Text = bon::_GetEngine().UI().CreateText(nullptr, row.Background, "");
+				if (_itemsSheet.get()) { row.Text->LoadStyleFrom(_itemsSheet); }
+				row.Text->Interactive = row.Text->CopyParentState = true;
+				row.Text->SetDrawAsTopLayerRecursive(DrawAsTopLayer);
+
+				// set callback to select the item row is bound to
+				size_t rowIndex = _rows.size();
+				row.Background->OnMousePressed = [this, rowIndex](_UIElement& self, void* data)
 				{
-					if (!this->Locked && Background->Visible) {
-						this->Select(item.Index);
+					int index = this->_rows[rowIndex].Index;
+					if (!this->Locked && Background->Visible && index >= 0) {
+						this->Select(index);
 					}
 				};
-				item.Background->CaptureInput = true;
-				item.Text->CaptureInput = false;
+				row.Background->CaptureInput = true;
+				row.Text->CaptureInput = false;
+
+				// add row and set its position
+				_rows.push_back(row);
+				_listDirty = true;
+			}
+
+			// update rows position
+			if (_listDirty)
+			{
+				RebuildListItems();
+				_listDirty = false;
+			}
 
-				// increase index
-				i++;
+			// get scrollbar value (first item to show)
+			int scrollVal = (_scrollbar && _scrollbar->Visible) ? _scrollbar->Value() : 0;
+			scrollVal = std::max(std::min(scrollVal, (int)_items.size() - _maxVisibleEntitiesInList), 0);
+
+			// bind rows to items
+			// note: setting the same text again does nothing, so only rows that show a different item are updated
+			for (size_t i = 0; i < _rows.size(); ++i)
+			{
+				auto& row = _rows[i];
+				int index = scrollVal + (int)i;
+				bool isVisible = ((int)i < _maxVisibleEntitiesInList) && (index < (int)_items.size());
+				row.Background->Visible = isVisible;
+				row.Index = isVisible ? index : -1;
+				if (isVisible)
+				{
+					row.Text->SetText(_items[index].c_str());
+					row.Background->ForceActiveState = (index == _selected);
+				}
 			}
 		}
 
 		// update scrollbar
 		void _UIList::UpdateScrollbarMinMax()
 		{
+			// calc how many items we can hold in list
+			int listRegionHeight = Background->GetCalculatedDestRect().Height - (Background->GetPadding().Top + Background->GetPadding().Bottom);
+			_maxVisibleEntitiesInList = std::max(listRegionHeight / std::max(_lineHeight, 1), 0);
+
 			if (_scrollbar)
 			{
-				// calc how many items we can hold in list
-				int listRegionHeight = Background->GetCalculatedDestRect().Height - (Background->GetPadding().Top + Background->GetPadding().Bottom);
-				_maxVisibleEntitiesInList = listRegionHeight / _lineHeight;
-
 				// calculate how many extra items are outside
 				int extras = (int)(_items.size() - _maxVisibleEntitiesInList);
 
@@ -288,15 +331,8 @@ namespace bon
 		// update list
 		void _UIList::Update(double deltaTime)
 		{
-			// if dirty, rearrange list
-			if (_listDirty)
-			{
-				// update list items
-				RebuildListItems();
-
-				// no longer dirty
-				_listDirty = false;
-			}
+			// bind rows to visible items
+			BindRows();
 
 			// do base updates
 			_UIElement::Update(deltaTime);
@@ -310,28 +346,11 @@ namespace bon
 		{
 			if (DrawAsTopLayer == topLayer)
 			{
-				// calculate bottom limit position
-				int listBottomPosition = Background->GetCalculatedDestRect().Bottom() - Background->GetPadding().Bottom;
-
-				// get scrollbar value
-				int scrollVal = (_scrollbar && _scrollbar->Visible) ? _scrollbar->Value() : 0;
-
-				// set election and visibility of items
-				int index = 0;
-				int positionIndex = 0;
-				for (auto item : _items)
+				// bind rows again, in case list scrolled or changed since update
+				BindRows();
+				for (auto& row : _rows)
 				{
-					// mark active and set visibility
-					item.Background->ForceActiveState = (index == _selected);
-					bool isVisible = (index >= scrollVal) && (positionIndex < _maxVisibleEntitiesInList);
-					item.Background->Visible = isVisible;
-					if (isVisible)
-					{
-						item.Background->SetOffset(bon::PointI(0, positionIndex * _lineHeight));
-						item.Background->Update(0.1);
-					}
-					if (index >= scrollVal) { positionIndex++; }
-					index++;
+					if (row.Background->Visible) { row.Background->Update(0.1); }
 				}
 			}
 
@@ -63,11 +63,39 @@ namespace bon
 			// call base update
 			_UIImage::DoInputUpdatesSelf(mousePosition, updateState);
 
+			// set value
+			auto padding = GetPadding();
+			auto destRect = GetCalculatedDestRect();
+			if (bon::_GetEngine().Input().Down(bon::KeyCodes::MouseLeft) && destRect.Contains(mousePosition))
+			{
+				int startX = (destRect.X + padding.Left);
+				float value = (float)(mousePosition.X - startX) / (destRect.Width - padding.Left - padding.Right - _handle->GetCalculatedDestRect().Width / 2);
+				if (value < 0) { value = 0; }
+				if (value > 1) { value = 1; }
+				SetValue((int)std::floor(value * MaxValue));
+				UpdateHandle();
+			}
+		}
+
+		// do self updates
+		// note: handle is positioned here and not in input updates, since input updates only reach elements under the cursor
+		void _UISlider::UpdateSelf(double deltaTime)
+		{
+			_UIImage::UpdateSelf(deltaTime);
+			UpdateHandle();
+		}
+
+		// update handle position and active part overlay
+		void _UISlider::UpdateHandle()
+		{
 			// update handle position
 			float pos = (float)_value / (float)MaxValue;
 			auto padding = GetPadding();
 			auto destRect = GetCalculatedDestRect();
-			_handle->SetOffset(bon::PointI((int)(pos * (destRect.Width - padding.Left - padding.Right)), 0));
+			if (_handle != nullptr)
+			{
+				_handle->SetOffset(bon::PointI((int)(pos * (destRect.Width - padding.Left - padding.Right)), 0));
+			}
 
 			// update active part percent
 			if (_activePartOverlay != nullptr)
@@ -76,16 +104,6 @@ namespace bon
 				_activePartOverlay->Visible = pos > 0;
 				_activePartOverlay->Update(0.1);
 			}
-
-			// set value
-			if (bon::_GetEngine().Input().Down(bon::KeyCodes::MouseLeft) && destRect.Contains(mousePosition))
-			{
-				int startX = (destRect.X + padding.Left);
-				float value = (float)(mousePosition.X - startX) / (destRect.Width - padding.Left - padding.Right - _handle->GetCalculatedDestRect().Width / 2);
-				if (value < 0) { value = 0; }
-				if (value > 1) { value = 1; }
-				SetValue((int)std::floor(value * MaxValue));
-			}
 		}
 	}
 }
\ No newline at end of file
@@ -25,38 +25,32 @@ namespace bon
 			// load basic stylesheet
 			_UIElement::LoadStyleFrom(config);
 
-			// load font image
-			const char* font = config->GetStr("text", "font_path", nullptr);
-			if (font)
-			{
-				int fontSize = config->GetInt("text", "font_native_size", 24);
-				Font = bon::_GetEngine().Assets().LoadFont(ToRelativePath(font).c_str(), fontSize);
-			}
-
-			// load font size and alignment
-			FontSize = config->GetInt("text", "font_size", 24);
-			static const char* alignments[] = { "left", "right", "center" };
-			Alignment = (UITextAlignment)config->GetOption("text", "alignment", alignments, 0);
-
-			// load colors
-			Color = config->GetColor("text", "color", Color::White);
-			ColorHighlight = config->GetColor("text", "color_highlight", Color);
-			ColorPressed = config->GetColor("text", "color_pressed", Color);
-
-			// load outline colors
-			OutlineColor = config->GetColor("text", "outline_color", Color::White);
-			OutlineColorHighlight = config->GetColor("text", "outline_color_highlight", Color);
-			OutlineColorPressed = config->GetColor("text", "outline_color_pressed", Color);
-
-			// load outline width
-			OutlineWidth = config->GetInt("text", "outline_width", 1);
-			OutlineWidthHighlight = config->GetInt("text", "outline_width_highlight", 1);
-			OutlineWidthPressed = config->GetInt("text", "outline_width_pressed", 1);
+			// apply compiled text style
+			const UITextStyle& style = GetStyle()->Text;
+			if (style.Font) { Font = style.Font; }
+			FontSize = style.FontSize;
+			Alignment = style.Alignment;
+			Color = style.Color;
+			ColorHighlight = style.ColorHighlight;
+			ColorPressed = style.ColorPressed;
+			OutlineColor = style.OutlineColor;
+			OutlineColorHighlight = style.OutlineColorHighlight;
+			OutlineColorPressed = style.OutlineColorPressed;
+			OutlineWidth = style.OutlineWidth;
+			OutlineWidthHighlight = style.OutlineWidthHighlight;
+			OutlineWidthPressed = style.OutlineWidthPressed;
 		}
 
 		// set text to draw.
 		void _UIText::SetText(const char* text)
 		{
+			// skip if didn't change
+			if (text == _text || (text && _text && strcmp(text, _text) == 0)) { return; }
+
+			// text changed, need to measure it again
+			_textDirty = true;
+			MarkAsDirty();
+
 			// special case - delete text
 			if (!text)
 			{
@@ -128,8 +122,40 @@ namespace bon
 		// do updates
 		void _UIText::Update(double deltaTime)
 		{
+			// check if font properties changed and we need to measure text again
+			if (Font.get() != _measuredFont || FontSize != _measuredFontSize || WordWrap != _measuredWordWrap || Alignment != _measuredAlignment)
+			{
+				_textDirty = true;
+				MarkAsDirty();
+			}
+
+			// do base updates
 			_UIElement::Update(deltaTime);
-			DrawOrCalcActualRect(false, true); 
+		}
+
+		// measure text during layout pass
+		void _UIText::CalcLayoutSelf()
+		{
+			// if only position changed, move bounding box instead of measuring again
+			auto destRect = GetCalculatedDestRect();
+			if (!_textDirty && destRect.Width == _measuredDestRect.Width && destRect.Height == _measuredDestRect.Height)
+			{
+				_actualDestRect.X += destRect.X - _measuredDestRect.X;
+				_actualDestRect.Y += destRect.Y - _measuredDestRect.Y;
+			}
+			// measure text
+			else
+			{
+				DrawOrCalcActualRect(false, true);
+			}
+
+			// store properties we measured with
+			_textDirty = false;
+			_measuredDestRect = destRect;
+			_measuredFont = Font.get();
+			_measuredFontSize = FontSize;
+			_measuredWordWrap = WordWrap;
+			_measuredAlignment = Alignment;
 		}
 
 		// implement just the drawing of this element
@@ -228,6 +228,7 @@ namespace bon
 				{
 					_timeForCaretBlink = 0.0f;
 					_showCaret = !_showCaret;
+					InvalidateCache();
 				}
 			}
 		}
@@ -8,6 +8,29 @@ namespace bon
 {
 	namespace ui
 	{
+		// get arena to allocate new elements from
+		std::shared_ptr<UIArena> UI::GetArena(const UIElement& parent)
+		{
+			if (!bon::Features().UIArenaAllocation) { return nullptr; }
+			if (parent && parent->_arena) { return parent->_arena; }
+			if (!_arena) { _arena = std::make_shared<UIArena>(); }
+			return _arena;
+		}
+
+		// allocate a new element from arena
+		template <typename T>
+		std::shared_ptr<T> UI::NewElementInArena(const std::shared_ptr<UIArena>& arena)
+		{
+			// no arena? allocate from heap
+			if (!arena) { return std::make_shared<T>(); }
+
+			// allocate element and its control block from arena
+			// note: allocator keeps the arena alive until element is destroyed
+			std::shared_ptr<T> ret = std::allocate_shared<T>(UIArenaAllocator<T>(arena));
+			static_cast<_UIElement*>(ret.get())->_arena = arena;
+			return ret;
+		}
+
 		// get mouse position, relative to current screen / render target / viewport size.
 		PointI UI::_GetRelativeCursorPos() const
 		{
@@ -41,7 +64,7 @@ namespace bon
 		// set cursor to render from sprite.
 		void UI::SetCursor(const gfx::Sprite& sprite) 		
 		{
-			UIImage cursor = std::make_shared<_UIImage>();
+			UIImage cursor = NewElement<_UIImage>(nullptr);
 			cursor->Image = sprite.Image;
 			cursor->BlendMode = sprite.Blend;
 			cursor->Origin = sprite.Origin;
@@ -73,8 +96,9 @@ namespace bon
 		void UI::Draw(UIElement root, bool drawCursor)
 		{
 			// draw UI
+			// note: top layer is drawn from input router list, to avoid traversing the entire tree again
 			root->Draw(false);
-			root->Draw(true);
+			GetInputRouter(root).DrawTopLayer(root.get());
 
 			// draw cursor
 			if (drawCursor) {
@@ -82,6 +106,16 @@ namespace bon
 			}
 		}
 
+		// get input router of a root element
+		UIInputRouter& UI::GetInputRouter(const UIElement& root)
+		{
+			if (!root->_inputRouter)
+			{
+				root->_inputRouter = std::make_shared<UIInputRouter>();
+			}
+			return *root->_inputRouter;
+		}
+
 		// update UI system and do input interactions
 		void UI::UpdateUI(UIElement root, UIElement* activeElement)
 		{
@@ -91,9 +125,9 @@ namespace bon
 
 			// now do input interactions
 			auto mousePosition = _GetRelativeCursorPos();
+			// note: input router only updates elements under the cursor (and elements that need to leave their state)
 			UIUpdateInputState updateState;
-			root->DoInputUpdates(mousePosition, updateState, true);
-			root->DoInputUpdates(mousePosition, updateState, false);
+			GetInputRouter(root).DoInputUpdates(root.get(), mousePosition, updateState);
 
 			// set active element
 			if (activeElement)
@@ -132,7 +166,8 @@ namespace bon
 		// create and return root element
 		UIElement UI::CreateRoot()
 		{
-			UIElement ret = std::make_shared<_UIElement>();
+			// every root gets its own arena
+			UIElement ret = NewElementInArena<_UIElement>(bon::Features().UIArenaAllocation ? std::make_shared<UIArena>() : nullptr);
 			ret->SetSize(bon::UISize(100, bon::UISizeType::PercentOfParent, 100, bon::UISizeType::PercentOfParent));
 			ret->SetPadding(UISides(0, 0, 0, 0));
 			return ret;
@@ -141,7 +176,7 @@ namespace bon
 		// create and return root element
 		UIElement UI::CreateContainer(const char* stylesheet, UIElement parent)
 		{
-			UIElement ret = std::make_shared<_UIElement>();
+			UIElement ret = NewElement<_UIElement>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
@@ -149,7 +184,7 @@ namespace bon
 		// create and return image element
 		UIImage UI::CreateImage(const char* stylesheet, UIElement parent)
 		{
-			UIImage ret = std::make_shared<_UIImage>();
+			UIImage ret = NewElement<_UIImage>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
@@ -157,7 +192,7 @@ namespace bon
 		// create and return a text element
 		UIText UI::CreateText(const char* stylesheet, UIElement parent, const char* text)
 		{
-			UIText ret = std::make_shared<_UIText>();
+			UIText ret = NewElement<_UIText>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			if (text) { ret->SetText(text); }
 			return ret;
@@ -166,7 +201,7 @@ namespace bon
 		// create and return a window element
 		UIWindow UI::CreateUIWindow(const char* stylesheet, UIElement parent, const char* title)
 		{
-			UIWindow ret = std::make_shared<_UIWindow>();
+			UIWindow ret = NewElement<_UIWindow>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			if (title) { ret->Title->SetText(title); }
 			return ret;
@@ -175,7 +210,7 @@ namespace bon
 		// create and return a button element.
 		UIButton UI::CreateButton(const char* stylesheet, UIElement parent, const char* caption)
 		{
-			UIButton ret = std::make_shared<_UIButton>();
+			UIButton ret = NewElement<_UIButton>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			if (caption) { ret->Caption->SetText(caption); }
 			return ret;
@@ -184,7 +219,7 @@ namespace bon
 		// create and return a text input element
 		UITextInput UI::CreateTextInput(const char* stylesheet, UIElement parent, const char* startingValue, const char* placeholder)
 		{
-			UITextInput ret = std::make_shared<_UITextInput>();
+			UITextInput ret = NewElement<_UITextInput>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			if (startingValue) { ret->SetValue(startingValue); }
 			if (placeholder) { ret->SetPlaceholderText(placeholder); }
@@ -194,7 +229,7 @@ namespace bon
 		// create and return a checkbox element.
 		UICheckBox UI::CreateCheckbox(const char* stylesheet, UIElement parent, const char* caption)
 		{
-			UICheckBox ret = std::make_shared<_UICheckBox>();
+			UICheckBox ret = NewElement<_UICheckBox>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			if (caption) { ret->Caption->SetText(caption); }
 			return ret;
@@ -203,7 +238,7 @@ namespace bon
 		// create and return a slider element.
 		UISlider UI::CreateSlider(const char* stylesheet, UIElement parent)
 		{
-			UISlider ret = std::make_shared<_UISlider>();
+			UISlider ret = NewElement<_UISlider>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
@@ -211,7 +246,7 @@ namespace bon
 		// create and return a radio button element.
 		UIRadioButton UI::CreateRadioButton(const char* stylesheet, UIElement parent, const char* caption)
 		{
-			UIRadioButton ret = std::make_shared<_UIRadioButton>();
+			UIRadioButton ret = NewElement<_UIRadioButton>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			if (caption) { ret->Caption->SetText(caption); }
 			return ret;
@@ -220,7 +255,7 @@ namespace bon
 		// create and return a list element.
 		UIList UI::CreateList(const char* stylesheet, UIElement parent)
 		{
-			UIList ret = std::make_shared<_UIList>();
+			UIList ret = NewElement<_UIList>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
@@ -228,7 +263,7 @@ namespace bon
 		// create and return a dropdown element.
 		UIDropDown UI::CreateDropDown(const char* stylesheet, UIElement parent)
 		{
-			UIDropDown ret = std::make_shared<_UIDropDown>();
+			UIDropDown ret = NewElement<_UIDropDown>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
@@ -236,7 +271,7 @@ namespace bon
 		// create and return a scrollbar element.
 		UIVerticalScrollbar UI::CreateVerticalScrollbar(const char* stylesheet, UIElement parent)
 		{
-			UIVerticalScrollbar ret = std::make_shared<_UIVerticalScrollbar>();
+			UIVerticalScrollbar ret = NewElement<_UIVerticalScrollbar>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
@@ -244,9 +279,114 @@ namespace bon
 		// create and return a rectangle element.
 		UIRectangle UI::CreateRectangle(const char* stylesheet, UIElement parent)
 		{
-			UIRectangle ret = std::make_shared<_UIRectangle>();
+			UIRectangle ret = NewElement<_UIRectangle>(parent);
 			InitNewElement(ret, stylesheet, parent);
 			return ret;
 		}
+
+		// create a new element by type
+		UIElement UI::CreateByType(UIElementType type, const UIElement& parent)
+		{
+			switch (type)
+			{
+			case UIElementType::Element:
+				return NewElement<_UIElement>(parent);
+			case UIElementType::Button:
+				return NewElement<_UIButton>(parent);
+			case UIElementType::Checkbox:
+				return NewElement<_UICheckBox>(parent);
+			case UIElementType::Radio:
+				return NewElement<_UIRadioButton>(parent);
+			case UIElementType::Image:
+				return NewElement<_UIImage>(parent);
+			case UIElementType::List:
+				return NewElement<_UIList>(parent);
+			case UIElementType::Text:
+				return NewElement<_UIText>(parent);
+			case UIElementType::Scrollbar:
+				return NewElement<_UIVerticalScrollbar>(parent);
+			case UIElementType::Slider:
+				return NewElement<_UISlider>(parent);
+			case UIElementType::TextInput:
+				return NewElement<_UITextInput>(parent);
+			case UIElementType::Window:
+				return NewElement<_UIWindow>(parent);
+			case UIElementType::DropDown:
+				return NewElement<_UIDropDown>(parent);
+			case UIElementType::Rectangle:
+				return NewElement<_UIRectangle>(parent);
+			default:
+				throw framework::InvalidValue("Unknown UI element type!");
+			}
+		}
+
+		// create many elements of the same type and stylesheet
+		std::vector<UIElement> UI::CreateElements(UIElementType type, const char* stylesheet, UIElement parent, int count)
+		{
+			// load and compile stylesheet once (holding the style, so it stays cached while creating elements)
+			ConfigAsset conf = nullptr;
+			UIStyle style = nullptr;
+			if (stylesheet) 
+			{ 
+				conf = bon::_GetEngine().Assets().LoadConfig(stylesheet); 
+				style = GetStyle(conf);
+			}
+
+			// create elements
+			std::vector<UIElement> ret;
+			ret.reserve(count > 0 ? count : 0);
+			for (int i = 0; i < count; ++i)
+			{
+				UIElement element = CreateByType(type, parent);
+				InitNewElement(element, conf, parent);
+				ret.push_back(element);
+			}
+			return ret;
+		}
+
+		// get compiled style of a stylesheet
+		UIStyle UI::GetStyle(const assets::ConfigAsset& stylesheet)
+		{
+			if (stylesheet == nullptr) { return nullptr; }
+
+			// still cached? make sure its for the same stylesheet, and not a new one that reused its address
+			auto found = _styles.find(stylesheet.get());
+			if (found != _styles.end() && found->second.Stylesheet.lock() == stylesheet)
+			{
+				UIStyle ret = found->second.Style.lock();
+				if (ret) { return ret; }
+			}
+
+			// drop styles no element uses anymore
+			for (auto it = _styles.begin(); it != _styles.end();)
+			{
+				if (it->second.Style.expired()) { it = _styles.erase(it); }
+				else { ++it; }
+			}
+
+			// compile and cache
+			UIStyle ret = std::make_shared<_UIStyle>(stylesheet);
+			_styles[stylesheet.get()] = CachedStyle{ stylesheet, ret };
+			return ret;
+		}
+
+		// load stylesheet and get its compiled style
+		UIStyle UI::LoadStyle(const char* stylesheetPath)
+		{
+			return GetStyle(bon::_GetEngine().Assets().LoadConfig(stylesheetPath));
+		}
+
+		// clear compiled styles
+		void UI::ClearStylesCache()
+		{
+			_styles.clear();
+		}
+
+		// free compiled styles and shared arena
+		void UI::_Dispose()
+		{
+			_styles.clear();
+			_arena.reset();
+		}
 	}
 }
\ No newline at end of file
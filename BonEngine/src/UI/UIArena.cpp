@@ -0,0 +1,72 @@
+#include <UI/UIArena.h>
+#include <new>
+
+namespace bon
+{
+	namespace ui
+	{
+		// free all chunks
+		UIArena::~UIArena()
+		{
+			for (auto chunk : _chunks)
+			{
+				::operator delete(chunk);
+			}
+			_chunks.clear();
+		}
+
+		// allocate a block
+		void* UIArena::Allocate(size_t bytes)
+		{
+			// big blocks go to heap
+			if (bytes == 0) { bytes = 1; }
+			if (bytes > MaxBlockSize) { return ::operator new(bytes); }
+
+			// round size to alignment
+			size_t sizeClass = (bytes + Alignment - 1) / Alignment - 1;
+			size_t blockSize = (sizeClass + 1) * Alignment;
+			_liveBlocks++;
+
+			// reuse a freed block
+			void* ret = _freeLists[sizeClass];
+			if (ret)
+			{
+				_freeLists[sizeClass] = *(void**)ret;
+				return ret;
+			}
+
+			// need a new chunk?
+			// note: whatever is left in previous chunk is wasted until arena is destroyed (less than MaxBlockSize bytes)
+			if (_currentLeft < blockSize)
+			{
+				_current = (char*)::operator new(ChunkSize);
+				_currentLeft = ChunkSize;
+				_chunks.push_back(_current);
+			}
+
+			// take block from current chunk
+			ret = _current;
+			_current += blockSize;
+			_currentLeft -= blockSize;
+			return ret;
+		}
+
+		// free a block
+		void UIArena::Free(void* ptr, size_t bytes)
+		{
+			// big blocks go to heap
+			if (bytes == 0) { bytes = 1; }
+			if (bytes > MaxBlockSize)
+			{
+				::operator delete(ptr);
+				return;
+			}
+
+			// add to free list
+			size_t sizeClass = (bytes + Alignment - 1) / Alignment - 1;
+			*(void**)ptr = _freeLists[sizeClass];
+			_freeLists[sizeClass] = ptr;
+			_liveBlocks--;
+		}
+	}
+}
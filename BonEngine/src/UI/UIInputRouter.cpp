@@ -0,0 +1,300 @@
+#include <UI/UIInputRouter.h>
+#include <UI/Elements/UIElement.h>
+#include <algorithm>
+using namespace bon::framework;
+
+namespace bon
+{
+	namespace ui
+	{
+		// get if index is up to date with root
+		bool UIInputRouter::IsValidFor(const _UIElement* root) const
+		{
+			// note: any change in tree structure, layout, visibility or layer marks root layout as dirty
+			return root == _root && !root->_isLayoutDirty && root->_layoutVersion == _layoutVersion;
+		}
+
+		// rebuild index from root element
+		void UIInputRouter::Rebuild(_UIElement* root)
+		{
+			// collect entries
+			std::vector<Entry> topLayer;
+			_entries.clear();
+			AddEntries(root, topLayer, _entries, nullptr);
+			_entries.insert(_entries.begin(), topLayer.begin(), topLayer.end());
+
+			// collect top layer draw list
+			_topLayerRoots.clear();
+			AddTopLayerRoots(root);
+
+			// entries to update every frame, and entries that are currently not idle
+			_alwaysUpdate.clear();
+			_active.clear();
+			for (uint32_t i = 0; i < (uint32_t)_entries.size(); ++i)
+			{
+				const Entry& entry = _entries[i];
+				if (entry.Subtree)
+				{
+					_alwaysUpdate.push_back(i);
+				}
+				else if (entry.Element->_prevState != UIElementState::Idle || entry.Element->_isBeingDragged || entry.Element->ForceActiveState)
+				{
+					_active.push_back(i);
+				}
+			}
+
+			// build spatial index
+			BuildGrid();
+
+			// store version
+			_root = root;
+			_layoutVersion = root->_layoutVersion;
+		}
+
+		// add element and subtree entries
+		void UIInputRouter::AddEntries(_UIElement* element, std::vector<Entry>& topLayer, std::vector<Entry>& regular, const RectangleI* clip)
+		{
+			// skip invisible elements
+			if (!element->Visible) { return; }
+
+			// element with custom input routing - update it with its subtree, in both layers
+			if (element->HasCustomInputRouting())
+			{
+				topLayer.push_back({ element, RectangleI::Zero, true, true });
+				regular.push_back({ element, RectangleI::Zero, true, false });
+				return;
+			}
+
+			// get clipping region for children
+			RectangleI childrenClip;
+			const RectangleI* childrenClipPtr = clip;
+			if (element->ClipChildren)
+			{
+				childrenClip = clip ? _UIElement::IntersectRects(element->GetCalculatedDestRect(), *clip) : element->GetCalculatedDestRect();
+				childrenClipPtr = &childrenClip;
+			}
+
+			// add children first, in reverse order (elements drawn last get priority)
+			// note: skip children that are culled by their parent clipping
+			for (auto child = element->_childNodes.rbegin(); child != element->_childNodes.rend(); ++child)
+			{
+				if (element->IsChildCulled(*child)) { continue; }
+				AddEntries(*child, topLayer, regular, childrenClipPtr);
+			}
+
+			// add self
+			// note: some elements test input against calculated dest rect, which includes extra pixels offset
+			RectangleI rect = element->_destRect;
+			RectangleI calculated = element->GetCalculatedDestRect();
+			if (calculated != rect)
+			{
+				int right = std::max(rect.Right(), calculated.Right());
+				int bottom = std::max(rect.Bottom(), calculated.Bottom());
+				rect.X = std::min(rect.X, calculated.X);
+				rect.Y = std::min(rect.Y, calculated.Y);
+				rect.Width = right - rect.X;
+				rect.Height = bottom - rect.Y;
+			}
+			// note: top layer is not clipped, regular elements only get input in their visible part
+			if (element->DrawAsTopLayer)
+			{
+				topLayer.push_back({ element, rect, false, false });
+				return;
+			}
+			if (clip)
+			{
+				rect = _UIElement::IntersectRects(rect, *clip);
+				if (rect.Width == 0 || rect.Height == 0) { return; }
+			}
+			regular.push_back({ element, rect, false, false });
+		}
+
+		// add top layer roots
+		void UIInputRouter::AddTopLayerRoots(_UIElement* element)
+		{
+			if (!element->Visible) { return; }
+			if (element->DrawAsTopLayer)
+			{
+				_topLayerRoots.push_back(element);
+				return;
+			}
+			for (auto child : element->_childNodes)
+			{
+				if (element->IsChildCulled(child)) { continue; }
+				AddTopLayerRoots(child);
+			}
+		}
+
+		// build spatial index
+		void UIInputRouter::BuildGrid()
+		{
+			// get region covered by entries
+			int left = 0, top = 0, right = 0, bottom = 0;
+			bool first = true;
+			for (auto& entry : _entries)
+			{
+				if (entry.Subtree || entry.Rect.Width < 0 || entry.Rect.Height < 0) { continue; }
+				if (first || entry.Rect.Left() < left) { left = entry.Rect.Left(); }
+				if (first || entry.Rect.Top() < top) { top = entry.Rect.Top(); }
+				if (first || entry.Rect.Right() > right) { right = entry.Rect.Right(); }
+				if (first || entry.Rect.Bottom() > bottom) { bottom = entry.Rect.Bottom(); }
+				first = false;
+			}
+
+			// calc grid size
+			// note: +1 because rectangles contain their right and bottom edges
+			_cellSize = CellSize;
+			_gridOrigin.Set(left, top);
+			do
+			{
+				_gridSize.Set((right - left) / _cellSize + 1, (bottom - top) / _cellSize + 1);
+				if (_gridSize.X * _gridSize.Y <= MaxCells) { break; }
+				_cellSize *= 2;
+			} while (true);
+
+			// count entries per cell
+			size_t cellsCount = (size_t)_gridSize.X * _gridSize.Y;
+			_cellStart.assign(cellsCount + 1, 0);
+			auto forEachCell = [this](const RectangleI& rect, auto callback)
+			{
+				int fromX = (rect.Left() - _gridOrigin.X) / _cellSize;
+				int fromY = (rect.Top() - _gridOrigin.Y) / _cellSize;
+				int toX = (rect.Right() - _gridOrigin.X) / _cellSize;
+				int toY = (rect.Bottom() - _gridOrigin.Y) / _cellSize;
+				for (int y = fromY; y <= toY; ++y)
+				{
+					for (int x = fromX; x <= toX; ++x)
+					{
+						callback((size_t)y * _gridSize.X + x);
+					}
+				}
+			};
+			for (auto& entry : _entries)
+			{
+				if (entry.Subtree || entry.Rect.Width < 0 || entry.Rect.Height < 0) { continue; }
+				forEachCell(entry.Rect, [this](size_t cell) { _cellStart[cell + 1]++; });
+			}
+			for (size_t i = 0; i < cellsCount; ++i)
+			{
+				_cellStart[i + 1] += _cellStart[i];
+			}
+
+			// fill cells, in entries order
+			_cellEntries.resize(_cellStart[cellsCount]);
+			std::vector<uint32_t> fill(_cellStart.begin(), _cellStart.end() - 1);
+			for (uint32_t i = 0; i < (uint32_t)_entries.size(); ++i)
+			{
+				const Entry& entry = _entries[i];
+				if (entry.Subtree || entry.Rect.Width < 0 || entry.Rect.Height < 0) { continue; }
+				forEachCell(entry.Rect, [this, &fill, i](size_t cell) { _cellEntries[fill[cell]++] = i; });
+			}
+		}
+
+		// do input updates
+		void UIInputRouter::DoInputUpdates(_UIElement* root, const PointI& mousePosition, UIUpdateInputState& updateState)
+		{
+			// skip update if not visible
+			if (!root->Visible) { return; }
+
+			// rebuild index if tree changed
+			if (!IsValidFor(root)) { Rebuild(root); }
+
+			// collect entries under pointer, in addition to entries we must update anyway
+			_candidates.clear();
+			int cellX = (mousePosition.X - _gridOrigin.X) / _cellSize;
+			int cellY = (mousePosition.Y - _gridOrigin.Y) / _cellSize;
+			if (mousePosition.X >= _gridOrigin.X && mousePosition.Y >= _gridOrigin.Y && cellX < _gridSize.X && cellY < _gridSize.Y)
+			{
+				size_t cell = (size_t)cellY * _gridSize.X + cellX;
+				for (uint32_t i = _cellStart[cell]; i < _cellStart[cell + 1]; ++i)
+				{
+					uint32_t index = _cellEntries[i];
+					if (_entries[index].Rect.Contains(mousePosition)) { _candidates.push_back(index); }
+				}
+			}
+			_candidates.insert(_candidates.end(), _alwaysUpdate.begin(), _alwaysUpdate.end());
+			_candidates.insert(_candidates.end(), _active.begin(), _active.end());
+			std::sort(_candidates.begin(), _candidates.end());
+			_candidates.erase(std::unique(_candidates.begin(), _candidates.end()), _candidates.end());
+
+			// update entries in priority order
+			_active.clear();
+			for (size_t i = 0; i < _candidates.size(); ++i)
+			{
+				// check if needs to break
+				// note: keep entries we skipped as active, so they'll get their update next frame
+				uint32_t index = _candidates[i];
+				if (updateState.BreakUpdatesLoop) 
+				{ 
+					for (; i < _candidates.size(); ++i)
+					{
+						if (!_entries[_candidates[i]].Subtree) { _active.push_back(_candidates[i]); }
+					}
+					break; 
+				}
+
+				// update element with its subtree
+				const Entry& entry = _entries[index];
+				_UIElement* element = entry.Element;
+				if (!element->Visible) { continue; }
+				if (entry.Subtree)
+				{
+					element->DoInputUpdates(mousePosition, updateState, entry.TopLayer);
+					continue;
+				}
+
+				// update self
+				element->DoInputUpdatesSelf(mousePosition, updateState);
+				CopyStateToChildren(element);
+
+				// state changed? need to render cached textures again
+				if (element->_state != element->_prevState) { element->InvalidateCache(); }
+
+				// still not idle? will need updates next frame even if pointer leaves it
+				if (element->_state != UIElementState::Idle || element->_isBeingDragged || element->ForceActiveState)
+				{
+					_active.push_back(index);
+				}
+			}
+		}
+
+		// copy element state to children
+		void UIInputRouter::CopyStateToChildren(_UIElement* element)
+		{
+			for (auto child : element->_childNodes)
+			{
+				if (child->CopyParentState)
+				{
+					bool changed = child->_state != element->_state;
+					child->_state = element->_state;
+					child->_prevState = element->_prevState;
+					if (changed) { child->InvalidateCache(); }
+					CopyStateToChildren(child);
+				}
+			}
+		}
+
+		// draw top layer elements
+		void UIInputRouter::DrawTopLayer(_UIElement* root)
+		{
+			// outdated index? draw the entire tree top layer
+			if (!IsValidFor(root))
+			{
+				root->Draw(true);
+				return;
+			}
+
+			// draw top layer roots
+			for (auto element : _topLayerRoots)
+			{
+				// make sure still visible, in case visibility changed since index was built
+				bool visible = true;
+				for (_UIElement* curr = element; curr && visible; curr = curr->_parent)
+				{
+					visible = curr->Visible;
+				}
+				if (visible) { element->Draw(true); }
+			}
+		}
+	}
+}
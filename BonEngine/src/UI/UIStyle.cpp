@@ -0,0 +1,90 @@
+#include <UI/UIStyle.h>
+#include <BonEngine.h>
+#include <filesystem>
+namespace fs = std::filesystem;
+using namespace bon::framework;
+
+namespace bon
+{
+	namespace ui
+	{
+		// compile style from stylesheet
+		_UIStyle::_UIStyle(const assets::ConfigAsset& config) : _config(config)
+		{
+			// store stylesheet folder
+			_folder = fs::path(config->Path()).parent_path().u8string();
+
+			// compile element style and behavior
+			{
+				UIElementStyle& style = Element;
+				style.Origin = config->GetPointF("style", "origin", bon::PointF::Zero);
+				style.Anchor = config->GetPointF("style", "anchor", bon::PointF::Zero);
+				style.Padding.FromRect(config->GetRectangleF("style", "padding", RectangleF::Zero));
+				style.IgnoreParentPadding = config->GetBool("style", "ignore_padding", false);
+				style.Marging.FromRect(config->GetRectangleF("style", "margin", RectangleF(0, 0, 0, 6)));
+				style.Size.FromStr(config->GetStr("style", "width", "100p"), config->GetStr("style", "height", "100p"));
+				style.FlexGrow = config->GetFloat("style", "flex_grow", 0.0f);
+				style.Interactive = config->GetBool("behavior", "interactive", true);
+				style.CaptureInput = config->GetBool("behavior", "capture_input", true);
+				style.CopyParentState = config->GetBool("behavior", "copy_parent_state", false);
+				style.Draggable = config->GetBool("behavior", "draggable", false);
+				style.LimitDragToParentArea = config->GetBool("behavior", "limit_drag_to_parent", true);
+				style.AutoArrangeChildren = config->GetBool("behavior", "auto_arrange_children", false);
+				style.ExemptFromAutoArrange = config->GetBool("behavior", "exempt_auto_arrange", false);
+				style.CacheAsTexture = config->GetBool("behavior", "cache_as_texture", false);
+				style.ClipChildren = config->GetBool("behavior", "clip_children", false);
+				static const char* arrangeModes[] = { "stack", "horizontal_stack", "grid", "flex" };
+				style.ArrangeMode = (UIArrangeMode)config->GetOption("behavior", "arrange_mode", arrangeModes, 0);
+				style.ArrangeColumns = config->GetInt("behavior", "arrange_columns", 2);
+			}
+
+			// compile image style
+			{
+				UIImageStyle& style = Image;
+				const char* img = config->GetStr("image", "image_path", nullptr);
+				if (img) { style.Image = bon::_GetEngine().Assets().LoadImage(ToRelativePath(img).c_str()); }
+				style.SlicedImageSides.FromRect(config->GetRectangleF("image", "sliced_sides", RectangleF::Zero));
+				style.Color = config->GetColor("image", "color", Color::White);
+				style.ColorHighlight = config->GetColor("image", "color_highlight", style.Color);
+				style.ColorPressed = config->GetColor("image", "color_pressed", style.Color);
+				style.SourceRect = config->GetRectangleF("image", "source_rect", RectangleF::Zero);
+				style.SourceRectHighlight = config->GetRectangleF("image", "source_rect_highlight", style.SourceRect);
+				style.SourceRectPressed = config->GetRectangleF("image", "source_rect_pressed", style.SourceRect);
+				static const char* blendOptions[] = { "opaque", "alpha", "mod", "darken", "multiply", "screen", "invert", "difference", "lighten", "additive", "subtract", "premultiplied" };
+				style.BlendMode = (BlendModes)config->GetOption("image", "blend", blendOptions, (int)BlendModes::AlphaBlend);
+				static const char* drawModeOptions[] = { "stretch", "tiled", "sliced", "single" };
+				style.ImageType = (UIImageTypes)config->GetOption("image", "type", drawModeOptions, (int)UIImageTypes::Stretch);
+				style.TextureScale = config->GetFloat("image", "texture_scale", 1.0f);
+			}
+
+			// compile text style
+			{
+				UITextStyle& style = Text;
+				const char* font = config->GetStr("text", "font_path", nullptr);
+				if (font)
+				{
+					int fontSize = config->GetInt("text", "font_native_size", 24);
+					style.Font = bon::_GetEngine().Assets().LoadFont(ToRelativePath(font).c_str(), fontSize);
+				}
+				style.FontSize = config->GetInt("text", "font_size", 24);
+				static const char* alignments[] = { "left", "right", "center" };
+				style.Alignment = (UITextAlignment)config->GetOption("text", "alignment", alignments, 0);
+				style.Color = config->GetColor("text", "color", Color::White);
+				style.ColorHighlight = config->GetColor("text", "color_highlight", style.Color);
+				style.ColorPressed = config->GetColor("text", "color_pressed", style.Color);
+				style.OutlineColor = config->GetColor("text", "outline_color", Color::White);
+				style.OutlineColorHighlight = config->GetColor("text", "outline_color_highlight", style.Color);
+				style.OutlineColorPressed = config->GetColor("text", "outline_color_pressed", style.Color);
+				style.OutlineWidth = config->GetInt("text", "outline_width", 1);
+				style.OutlineWidthHighlight = config->GetInt("text", "outline_width_highlight", 1);
+				style.OutlineWidthPressed = config->GetInt("text", "outline_width_pressed", 1);
+			}
+		}
+
+		// convert path to be relative to stylesheet folder
+		std::string _UIStyle::ToRelativePath(const char* path) const
+		{
+			return fs::path(_folder).append(path).u8string();
+		}
+	}
+}
@@ -3,69 +3,70 @@
 #include <set>
 
 // Check if an asset is valid.
-bool BON_Asset_IsValid(bon::AssetPtr* asset)
+bool BON_Asset_IsValid(bon::AssetHandle asset)
 {
-	return (*asset)->IsValid();
+	bon::assets::IAsset* ptr = bon::_GetEngine().Assets().ResolveHandle(asset);
+	return ptr != nullptr && ptr->IsValid();
 }
 
 // Get asset's path.
-const char* BON_Asset_Path(bon::AssetPtr* asset)
+const char* BON_Asset_Path(bon::AssetHandle asset)
 {
-	return (*asset)->Path();
+	return bon::_GetEngine().Assets().ResolveHandle(asset)->Path();
 }
 
 // Get image filtering mode.
-BON_ImageFilterMode BON_Image_FilteringMode(bon::ImageAsset* image)
+BON_ImageFilterMode BON_Image_FilteringMode(bon::AssetHandle image)
 {
-	return (BON_ImageFilterMode)(*image)->FilteringMode();
+	return (BON_ImageFilterMode)bon::_GetEngine().Assets().GetImage(image)->FilteringMode();
 }
 
 // Get image width
-int BON_Image_Width(bon::ImageAsset* image)
+int BON_Image_Width(bon::AssetHandle image)
 {
-	return (*image)->Width();
+	return bon::_GetEngine().Assets().GetImage(image)->Width();
 }
 
 // Get image height
-int BON_Image_Height(bon::ImageAsset* image)
+int BON_Image_Height(bon::AssetHandle image)
 {
-	return (*image)->Height();
+	return bon::_GetEngine().Assets().GetImage(image)->Height();
 }
 
 // get if image have alpha channels.
-bool BON_Image_HaveAlphaChannel(bon::ImageAsset* image)
+bool BON_Image_HaveAlphaChannel(bon::AssetHandle image)
 {
-	return (*image)->HaveAlphaChannel();
+	return bon::_GetEngine().Assets().GetImage(image)->HaveAlphaChannel();
 }
 
 // Save image to file.
-void BON_Image_SaveToFile(bon::ImageAsset* image, const char* filename)
+void BON_Image_SaveToFile(bon::AssetHandle image, const char* filename)
 {
-	(*image)->SaveToFile(filename);
+	bon::_GetEngine().Assets().GetImage(image)->SaveToFile(filename);
 }
 
 // Prepare image for reading pixels from it.
-void BON_Image_PrepareReadingBuffer(bon::ImageAsset* image, int x, int y, int w, int h)
+void BON_Image_PrepareReadingBuffer(bon::AssetHandle image, int x, int y, int w, int h)
 {
-	(*image)->PrepareReadingBuffer(bon::framework::RectangleI(x, y, w, h));
+	bon::_GetEngine().Assets().GetImage(image)->PrepareReadingBuffer(bon::framework::RectangleI(x, y, w, h));
 }
 
 // Free reading buffer after PrepareReadingBuffer() was called.
-void BON_Image_FreeReadingBuffer(bon::ImageAsset* image)
+void BON_Image_FreeReadingBuffer(bon::AssetHandle image)
 {
-	(*image)->FreeReadingBuffer();
+	bon::_GetEngine().Assets().GetImage(image)->FreeReadingBuffer();
 }
 
 // Clear image to transparent pixels.
-void BON_Image_Clear(bon::ImageAsset* image)
+void BON_Image_Clear(bon::AssetHandle image)
 {
-	(*image)->Clear();
+	bon::_GetEngine().Assets().GetImage(image)->Clear();
 }
 
 // get pixel from image
-void BON_Image_GetPixel(bon::ImageAsset* image, int x, int y, float* r, float* g, float* b, float* a)
+void BON_Image_GetPixel(bon::AssetHandle image, int x, int y, float* r, float* g, float* b, float* a)
 {
-	bon::Color ret = (*image)->GetPixel(bon::PointI(x, y));
+	bon::Color ret = bon::_GetEngine().Assets().GetImage(image)->GetPixel(bon::PointI(x, y));
 	*r = ret.R;
 	*g = ret.G;
 	*b = ret.B;
@@ -75,41 +76,41 @@ void BON_Image_GetPixel(bon::ImageAsset* image, int x, int y, float* r, float* g
 /**
 * Get string value from config.
 */
-const char* BON_Config_GetStr(bon::ConfigAsset* config, const char* section, const char* name, const char* defaultVal)
+const char* BON_Config_GetStr(bon::AssetHandle config, const char* section, const char* name, const char* defaultVal)
 {
-	return (*config)->GetStr(section, name, defaultVal);
+	return bon::_GetEngine().Assets().GetConfig(config)->GetStr(section, name, defaultVal);
 }
 
 /**
 * Get bool value from config.
 */
-bool BON_Config_GetBool(bon::ConfigAsset* config, const char* section, const char* name, bool defaultVal)
+bool BON_Config_GetBool(bon::AssetHandle config, const char* section, const char* name, bool defaultVal)
 {
-	return (*config)->GetBool(section, name, defaultVal);
+	return bon::_GetEngine().Assets().GetConfig(config)->GetBool(section, name, defaultVal);
 }
 
 /**
 * Get integer value from config.
 */
-long BON_Config_GetInt(bon::ConfigAsset* config, const char* section, const char* name, int defaultVal)
+long BON_Config_GetInt(bon::AssetHandle config, const char* section, const char* name, int defaultVal)
 {
-	return (*config)->GetInt(section, name, defaultVal);
+	return bon::_GetEngine().Assets().GetConfig(config)->GetInt(section, name, defaultVal);
 }
 
 /**
 * Get float value from config.
 */
-float BON_Config_GetFloat(bon::ConfigAsset* config, const char* section, const char* name, float defaultVal)
+float BON_Config_GetFloat(bon::AssetHandle config, const char* section, const char* name, float defaultVal)
 {
-	return (*config)->GetFloat(section, name, defaultVal);
+	return bon::_GetEngine().Assets().GetConfig(config)->GetFloat(section, name, defaultVal);
 }
 
 /**
 * Get PointF value from config.
 */
-void BON_Config_GetPointF(bon::ConfigAsset* config, const char* section, const char* name, float defaultValX, float defaultValY, float* outX, float* outY)
+void BON_Config_GetPointF(bon::AssetHandle config, const char* section, const char* name, float defaultValX, float defaultValY, float* outX, float* outY)
 {
-	bon::PointF ret = (*config)->GetPointF(section, name, bon::PointF(defaultValX, defaultValY));
+	bon::PointF ret = bon::_GetEngine().Assets().GetConfig(config)->GetPointF(section, name, bon::PointF(defaultValX, defaultValY));
 	(*outX) = ret.X;
 	(*outY) = ret.Y;
 }
@@ -117,9 +118,9 @@ void BON_Config_GetPointF(bon::ConfigAsset* config, const char* section, const c
 /**
 * Get RectangleF value from config.
 */
-void BON_Config_GetRectangleF(bon::ConfigAsset* config, const char* section, const char* name, float defaultValX, float defaultValY, float defaultValW, float defaultValH, float* outX, float* outY, float* outW, float* outH)
+void BON_Config_GetRectangleF(bon::AssetHandle config, const char* section, const char* name, float defaultValX, float defaultValY, float defaultValW, float defaultValH, float* outX, float* outY, float* outW, float* outH)
 {
-	bon::RectangleF ret = (*config)->GetRectangleF(section, name, bon::RectangleF(defaultValX, defaultValY, defaultValW, defaultValH));
+	bon::RectangleF ret = bon::_GetEngine().Assets().GetConfig(config)->GetRectangleF(section, name, bon::RectangleF(defaultValX, defaultValY, defaultValW, defaultValH));
 	(*outX) = ret.X;
 	(*outY) = ret.Y;
 	(*outW) = ret.Width;
@@ -129,9 +130,9 @@ void BON_Config_GetRectangleF(bon::ConfigAsset* config, const char* section, con
 /**
 * Get Color value from config.
 */
-void BON_Config_GetColor(bon::ConfigAsset* config, const char* section, const char* name, float defaultR, float defaultG, float defaultB, float defaultA, float* outR, float* outG, float* outB, float* outA)
+void BON_Config_GetColor(bon::AssetHandle config, const char* section, const char* name, float defaultR, float defaultG, float defaultB, float defaultA, float* outR, float* outG, float* outB, float* outA)
 {
-	bon::Color ret = (*config)->GetColor(section, name, bon::Color(defaultR, defaultG, defaultB, defaultA));
+	bon::Color ret = bon::_GetEngine().Assets().GetConfig(config)->GetColor(section, name, bon::Color(defaultR, defaultG, defaultB, defaultA));
 	(*outR) = ret.R;
 	(*outG) = ret.G;
 	(*outB) = ret.B;
@@ -141,211 +142,470 @@ void BON_Config_GetColor(bon::ConfigAsset* config, const char* section, const ch
 /**
 * Get option index from config.
 */
-BON_DLLEXPORT int BON_Config_GetOption(bon::ConfigAsset* config, const char* section, const char* name, const char** options, int optionsCount, int defaultVal)
+BON_DLLEXPORT int BON_Config_GetOption(bon::AssetHandle config, const char* section, const char* name, const char** options, int optionsCount, int defaultVal)
 {
-	return (*config)->GetOption(section, name, options, optionsCount, defaultVal);
+	return bon::_GetEngine().Assets().GetConfig(config)->GetOption(section, name, options, optionsCount, defaultVal);
+}
+
+/**
+* Get handle for config section and key.
+*/
+bon::ConfigKey BON_Config_GetKeyHandle(const char* section, const char* name)
+{
+	return bon::assets::_Config::Key(section, name);
+}
+
+/**
+* Get string value from config by key handle.
+*/
+const char* BON_Config_GetStrByKey(bon::AssetHandle config, bon::ConfigKey key, const char* defaultVal)
+{
+	return bon::_GetEngine().Assets().GetConfig(config)->GetStr(key, defaultVal);
+}
+
+/**
+* Get bool value from config by key handle.
+*/
+bool BON_Config_GetBoolByKey(bon::AssetHandle config, bon::ConfigKey key, bool defaultVal)
+{
+	return bon::_GetEngine().Assets().GetConfig(config)->GetBool(key, defaultVal);
+}
+
+/**
+* Get integer value from config by key handle.
+*/
+long BON_Config_GetIntByKey(bon::AssetHandle config, bon::ConfigKey key, int defaultVal)
+{
+	return bon::_GetEngine().Assets().GetConfig(config)->GetInt(key, defaultVal);
+}
+
+/**
+* Get float value from config by key handle.
+*/
+float BON_Config_GetFloatByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultVal)
+{
+	return bon::_GetEngine().Assets().GetConfig(config)->GetFloat(key, defaultVal);
+}
+
+/**
+* Get PointF value from config by key handle.
+*/
+void BON_Config_GetPointFByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultValX, float defaultValY, float* outX, float* outY)
+{
+	bon::PointF ret = bon::_GetEngine().Assets().GetConfig(config)->GetPointF(key, bon::PointF(defaultValX, defaultValY));
+	(*outX) = ret.X;
+	(*outY) = ret.Y;
+}
+
+/**
+* Get RectangleF value from config by key handle.
+*/
+void BON_Config_GetRectangleFByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultValX, float defaultValY, float defaultValW, float defaultValH, float* outX, float* outY, float* outW, float* outH)
+{
+	bon::RectangleF ret = bon::_GetEngine().Assets().GetConfig(config)->GetRectangleF(key, bon::RectangleF(defaultValX, defaultValY, defaultValW, defaultValH));
+	(*outX) = ret.X;
+	(*outY) = ret.Y;
+	(*outW) = ret.Width;
+	(*outH) = ret.Height;
+}
+
+/**
+* Get Color value from config by key handle.
+*/
+void BON_Config_GetColorByKey(bon::AssetHandle config, bon::ConfigKey key, float defaultR, float defaultG, float defaultB, float defaultA, float* outR, float* outG, float* outB, float* outA)
+{
+	bon::Color ret = bon::_GetEngine().Assets().GetConfig(config)->GetColor(key, bon::Color(defaultR, defaultG, defaultB, defaultA));
+	(*outR) = ret.R;
+	(*outG) = ret.G;
+	(*outB) = ret.B;
+	(*outA) = ret.A;
 }
 
 /**
 * Get section name by index.
 */
-const char* BON_Config_Section(bon::ConfigAsset* config, int index)
+const char* BON_Config_Section(bon::AssetHandle config, int index)
 {
-	const std::set<std::string>& sections = (*config)->Sections();
+	const std::set<std::string>& sections = bon::_GetEngine().Assets().GetConfig(config)->Sections();
 	return std::next(sections.begin(), index)->c_str();
 }
 
 /**
  * Get secions count. 
  */
-int BON_Config_SectionsCount(bon::ConfigAsset* config)
+int BON_Config_SectionsCount(bon::AssetHandle config)
 {
-	return (int)((*config)->Sections().size());
+	return (int)(bon::_GetEngine().Assets().GetConfig(config)->Sections().size());
 }
 
 /**
 * Get set with all keys in section.
 */
-const char* BON_Config_Key(bon::ConfigAsset* config, const char* section, int index)
+const char* BON_Config_Key(bon::AssetHandle config, const char* section, int index)
 {
-	const std::set<std::string>& keys = (*config)->Keys(section);
+	const std::set<std::string>& keys = bon::_GetEngine().Assets().GetConfig(config)->Keys(section);
 	return std::next(keys.begin(), index)->c_str();
 }
 
 /**
  * Get config keys count.
  */
-int BON_Config_KeysCount(bon::ConfigAsset* config, const char* section)
+int BON_Config_KeysCount(bon::AssetHandle config, const char* section)
 {
-	return (int)((*config)->Keys(section).size());
+	return (int)(bon::_GetEngine().Assets().GetConfig(config)->Keys(section).size());
 }
 
 /**
 * Set a value.
 */
-void BON_Config_SetValue(bon::ConfigAsset* config, const char* section, const char* key, const char* value)
+void BON_Config_SetValue(bon::AssetHandle config, const char* section, const char* key, const char* value)
 {
-	(*config)->SetValue(section, key, value);
+	bon::_GetEngine().Assets().GetConfig(config)->SetValue(section, key, value);
 }
 
 /**
 * Removes a key.
 */
-void BON_Config_RemoveKey(bon::ConfigAsset* config, const char* section, const char* key)
+void BON_Config_RemoveKey(bon::AssetHandle config, const char* section, const char* key)
 {
-	(*config)->RemoveKey(section, key);
+	bon::_GetEngine().Assets().GetConfig(config)->RemoveKey(section, key);
 }
 
 /**
 * Checks if a section exists.
 */
-bool BON_Config_SectionExists(bon::ConfigAsset* config, const char* section)
+bool BON_Config_SectionExists(bon::AssetHandle config, const char* section)
 {
-	return (*config)->Exists(section);
+	return bon::_GetEngine().Assets().GetConfig(config)->Exists(section);
 }
 
 /**
 * Checks if a key exists.
 */
-bool BON_Config_KeyExists(bon::ConfigAsset* config, const char* section, const char* key)
+bool BON_Config_KeyExists(bon::AssetHandle config, const char* section, const char* key)
 {
-	return (*config)->Exists(section, key);
+	return bon::_GetEngine().Assets().GetConfig(config)->Exists(section, key);
 }
 
 // Get music track length.
-float BON_Music_Length(bon::MusicAsset* music)
+float BON_Music_Length(bon::AssetHandle music)
 {
-	return (*music)->Length();
+	return bon::_GetEngine().Assets().GetMusic(music)->Length();
 }
 
 // Get sound track length.
-float BON_Sound_Length(bon::SoundAsset* sound)
+float BON_Sound_Length(bon::AssetHandle sound)
 {
-	return (*sound)->Length();
+	return bon::_GetEngine().Assets().GetSound(sound)->Length();
 }
 
 // Get if a sound is playing.
-bool BON_Sound_IsPlaying(bon::SoundAsset* sound)
+bool BON_Sound_IsPlaying(bon::AssetHandle sound)
 {
-	return (*sound)->IsPlaying();
+	return bon::_GetEngine().Assets().GetSound(sound)->IsPlaying();
+}
+
+/**
+ * Set the mix bus to play sound on.
+ */
+void BON_Sound_SetBus(bon::AssetHandle sound, BON_SoundBus bus)
+{
+	bon::_GetEngine().Assets().GetSound(sound)->SetBus((bon::SoundBus)bus);
+}
+
+/**
+ * Get the mix bus sound plays on.
+ */
+BON_SoundBus BON_Sound_GetBus(bon::AssetHandle sound)
+{
+	return (BON_SoundBus)bon::_GetEngine().Assets().GetSound(sound)->Bus();
+}
+
+/**
+ * Set sound priority.
+ */
+void BON_Sound_SetPriority(bon::AssetHandle sound, int priority)
+{
+	bon::_GetEngine().Assets().GetSound(sound)->SetPriority(priority);
+}
+
+/**
+ * Get sound priority.
+ */
+int BON_Sound_GetPriority(bon::AssetHandle sound)
+{
+	return bon::_GetEngine().Assets().GetSound(sound)->Priority();
+}
+
+/**
+ * Set how many instances of sound can play at the same time (0 = no limit).
+ */
+void BON_Sound_SetMaxInstances(bon::AssetHandle sound, int maxInstances)
+{
+	bon::_GetEngine().Assets().GetSound(sound)->SetMaxInstances(maxInstances);
+}
+
+/**
+ * Get how many instances of sound can play at the same time.
+ */
+int BON_Sound_GetMaxInstances(bon::AssetHandle sound)
+{
+	return bon::_GetEngine().Assets().GetSound(sound)->MaxInstances();
+}
+
+/**
+ * Set sound voice stealing policy.
+ */
+void BON_Sound_SetStealPolicy(bon::AssetHandle sound, BON_VoiceStealPolicy policy)
+{
+	bon::_GetEngine().Assets().GetSound(sound)->SetStealPolicy((bon::VoiceStealPolicy)policy);
+}
+
+/**
+ * Get sound voice stealing policy.
+ */
+BON_VoiceStealPolicy BON_Sound_GetStealPolicy(bon::AssetHandle sound)
+{
+	return (BON_VoiceStealPolicy)bon::_GetEngine().Assets().GetSound(sound)->StealPolicy();
 }
 
 /**
 * Get font asset native size.
 */
-int BON_Font_Size(bon::FontAsset* font)
+int BON_Font_Size(bon::AssetHandle font)
 {
-	return (*font)->FontSize();
+	return bon::_GetEngine().Assets().GetFont(font)->FontSize();
 }
 
 /**
  * Get if effect is valid
  */
-bool BON_Effect_IsValid(bon::EffectAsset* effect)
+bool BON_Effect_IsValid(bon::AssetHandle effect)
 {
-	return (*effect)->IsValid();
+	return bon::_GetEngine().Assets().GetEffect(effect)->IsValid();
 }
 
 /**
  * Return if this effect uses textures.
  */
-bool BON_Effect_UseTextures(bon::EffectAsset* effect)
+bool BON_Effect_UseTextures(bon::AssetHandle effect)
 {
-	return (*effect)->UseTextures();
+	return bon::_GetEngine().Assets().GetEffect(effect)->UseTextures();
 }
 
 /**
  * Return if this effect uses vertex color.
  */
-bool BON_Effect_UseVertexColor(bon::EffectAsset* effect)
+bool BON_Effect_UseVertexColor(bon::AssetHandle effect)
 {
-	return (*effect)->UseVertexColor();
+	return bon::_GetEngine().Assets().GetEffect(effect)->UseVertexColor();
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformFloat(bon::EffectAsset* effect, const char* name, float val)
+void BON_Effect_SetUniformFloat(bon::AssetHandle effect, const char* name, float val)
 {
-	(*effect)->SetUniformFloat(name, val);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformFloat(name, val);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformVector2(bon::EffectAsset* effect, const char* name, float x, float y)
+void BON_Effect_SetUniformVector2(bon::AssetHandle effect, const char* name, float x, float y)
 {
-	(*effect)->SetUniformVector2(name, x, y);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector2(name, x, y);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformVector3(bon::EffectAsset* effect, const char* name, float x, float y, float z)
+void BON_Effect_SetUniformVector3(bon::AssetHandle effect, const char* name, float x, float y, float z)
 {
-	(*effect)->SetUniformVector3(name, x, y, z);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector3(name, x, y, z);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformVector4(bon::EffectAsset* effect, const char* name, float x, float y, float z, float w)
+void BON_Effect_SetUniformVector4(bon::AssetHandle effect, const char* name, float x, float y, float z, float w)
 {
-	(*effect)->SetUniformVector4(name, x, y, z, w);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector4(name, x, y, z, w);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformInt(bon::EffectAsset* effect, const char* name, int val)
+void BON_Effect_SetUniformInt(bon::AssetHandle effect, const char* name, int val)
 {
-	(*effect)->SetUniformInt(name, val);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformInt(name, val);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformVector2i(bon::EffectAsset* effect, const char* name, int x, int y)
+void BON_Effect_SetUniformVector2i(bon::AssetHandle effect, const char* name, int x, int y)
 {
-	(*effect)->SetUniformVector2(name, x, y);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector2(name, x, y);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformVector3i(bon::EffectAsset* effect, const char* name, int x, int y, int z)
+void BON_Effect_SetUniformVector3i(bon::AssetHandle effect, const char* name, int x, int y, int z)
 {
-	(*effect)->SetUniformVector3(name, x, y, z);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector3(name, x, y, z);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformVector4i(bon::EffectAsset* effect, const char* name, int x, int y, int z, int w)
+void BON_Effect_SetUniformVector4i(bon::AssetHandle effect, const char* name, int x, int y, int z, int w)
 {
-	(*effect)->SetUniformVector4(name, x, y, z, w);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector4(name, x, y, z, w);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformMatrix2(bon::EffectAsset* effect, const char* name, int count, bool transpose, const float* values)
+void BON_Effect_SetUniformMatrix2(bon::AssetHandle effect, const char* name, int count, bool transpose, const float* values)
 {
-	(*effect)->SetUniformMatrix2(name, count, transpose, values);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformMatrix2(name, count, transpose, values);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformMatrix3(bon::EffectAsset* effect, const char* name, int count, bool transpose, const float* values)
+void BON_Effect_SetUniformMatrix3(bon::AssetHandle effect, const char* name, int count, bool transpose, const float* values)
 {
-	(*effect)->SetUniformMatrix3(name, count, transpose, values);
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformMatrix3(name, count, transpose, values);
 }
 
 /**
  * Set effect uniform.
  */
-void BON_Effect_SetUniformMatrix4(bon::EffectAsset* effect, const char* name, int count, bool transpose, const float* values)
+void BON_Effect_SetUniformMatrix4(bon::AssetHandle effect, const char* name, int count, bool transpose, const float* values)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformMatrix4(name, count, transpose, values);
+}
+
+// convert int to uniform handle
+inline bon::assets::UniformHandle ToUniformHandle(int id)
+{
+	bon::assets::UniformHandle ret;
+	ret.Id = id;
+	return ret;
+}
+
+/**
+ * Get effect uniform handle, to set uniform values without name lookups.
+ */
+int BON_Effect_GetUniformHandle(bon::AssetHandle effect, const char* name)
+{
+	return bon::_GetEngine().Assets().GetEffect(effect)->GetUniformHandle(name).Id;
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformFloatH(bon::AssetHandle effect, int uniform, float val)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformFloat(ToUniformHandle(uniform), val);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformVector2H(bon::AssetHandle effect, int uniform, float x, float y)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector2(ToUniformHandle(uniform), x, y);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformVector3H(bon::AssetHandle effect, int uniform, float x, float y, float z)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector3(ToUniformHandle(uniform), x, y, z);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformVector4H(bon::AssetHandle effect, int uniform, float x, float y, float z, float w)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector4(ToUniformHandle(uniform), x, y, z, w);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformIntH(bon::AssetHandle effect, int uniform, int val)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformInt(ToUniformHandle(uniform), val);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformVector2iH(bon::AssetHandle effect, int uniform, int x, int y)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector2(ToUniformHandle(uniform), x, y);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformVector3iH(bon::AssetHandle effect, int uniform, int x, int y, int z)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector3(ToUniformHandle(uniform), x, y, z);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformVector4iH(bon::AssetHandle effect, int uniform, int x, int y, int z, int w)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformVector4(ToUniformHandle(uniform), x, y, z, w);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformMatrix2H(bon::AssetHandle effect, int uniform, int count, bool transpose, const float* values)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformMatrix2(ToUniformHandle(uniform), count, transpose, values);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformMatrix3H(bon::AssetHandle effect, int uniform, int count, bool transpose, const float* values)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformMatrix3(ToUniformHandle(uniform), count, transpose, values);
+}
+
+/**
+ * Set effect uniform by handle.
+ */
+void BON_Effect_SetUniformMatrix4H(bon::AssetHandle effect, int uniform, int count, bool transpose, const float* values)
+{
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformMatrix4(ToUniformHandle(uniform), count, transpose, values);
+}
+
+/**
+ * Get effect uniform block handle.
+ */
+int BON_Effect_GetUniformBlockHandle(bon::AssetHandle effect, const char* name)
+{
+	return bon::_GetEngine().Assets().GetEffect(effect)->GetUniformBlockHandle(name).Id;
+}
+
+/**
+ * Set effect uniform block data.
+ */
+void BON_Effect_SetUniformBlockData(bon::AssetHandle effect, int block, const void* data, int size)
 {
-	(*effect)->SetUniformMatrix4(name, count, transpose, values);
+	bon::assets::UniformBlockHandle handle; handle.Id = block;
+	bon::_GetEngine().Assets().GetEffect(effect)->SetUniformBlockData(handle, data, (size_t)size);
 }
\ No newline at end of file
@@ -185,4 +185,28 @@ double BON_Engine_GetFixedUpdatesInterval()
 void BON_Engine_SetFixedUpdatesInterval(double value)
 {
 	bon::_GetEngine().FixedUpdatesInterval = value;
+}
+
+// start recording input to file.
+void BON_Engine_StartInputRecording(const char* path)
+{
+	bon::_GetEngine().StartInputRecording(path);
+}
+
+// stop recording input.
+void BON_Engine_StopInputRecording()
+{
+	bon::_GetEngine().StopInputRecording();
+}
+
+// get if currently recording input.
+bool BON_Engine_IsRecordingInput()
+{
+	return bon::_GetEngine().IsRecordingInput();
+}
+
+// get if currently replaying recorded input.
+bool BON_Engine_IsReplayingInput()
+{
+	return bon::_GetEngine().IsReplayingInput();
 }
\ No newline at end of file
@@ -1,81 +1,92 @@
 #include <_CAPI/CAPI_Managers_Assets.h>
 #include <BonEngine.h>
 
-#define return_asset_ptr(_type, _val) \
-	_type* ret = new _type;	\
-	*ret = _val;	\
-	return ret
-
 /**
 * Load and return an Image asset.
 */
-bon::ImageAsset* BON_Assets_LoadImage(const char* filename, BON_ImageFilterMode filter, bool useCache)
+bon::AssetHandle BON_Assets_LoadImage(const char* filename, BON_ImageFilterMode filter, bool useCache)
 {
-	return_asset_ptr(bon::ImageAsset, bon::_GetEngine().Assets().LoadImage(filename, (bon::ImageFilterMode)filter, useCache));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadImage(filename, (bon::ImageFilterMode)filter, useCache));
+}
+
+/**
+* Load and return an Image asset, with streaming mode.
+*/
+bon::AssetHandle BON_Assets_LoadImageEx(const char* filename, BON_ImageFilterMode filter, bool useCache, BON_ImageStreaming streaming)
+{
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadImage(filename, (bon::ImageFilterMode)filter, useCache, (bon::ImageStreaming)streaming));
 }
 
 /**
 * Creates and return an empty image asset.
 */
-bon::ImageAsset* BON_Assets_CreateEmptyImage(int x, int y, BON_ImageFilterMode filter)
+bon::AssetHandle BON_Assets_CreateEmptyImage(int x, int y, BON_ImageFilterMode filter)
 {
-	return_asset_ptr(bon::ImageAsset, bon::_GetEngine().Assets().CreateEmptyImage(bon::PointI(x, y), (bon::ImageFilterMode)filter));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().CreateEmptyImage(bon::PointI(x, y), (bon::ImageFilterMode)filter));
 }
 
 /**
 * Load and return a music asset.
 */
-bon::MusicAsset* BON_Assets_LoadMusic(const char* filename, bool useCache)
+bon::AssetHandle BON_Assets_LoadMusic(const char* filename, bool useCache)
 {
-	return_asset_ptr(bon::MusicAsset,bon::_GetEngine().Assets().LoadMusic(filename, useCache));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadMusic(filename, useCache));
 }
 
 /**
 * Load and return a sound effect asset.
 */
-bon::SoundAsset* BON_Assets_LoadSound(const char* filename, bool useCache)
+bon::AssetHandle BON_Assets_LoadSound(const char* filename, bool useCache)
+{
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadSound(filename, useCache));
+}
+
+/**
+* Load and return a sound effect asset, with storage mode (decode on load or keep compressed).
+*/
+bon::AssetHandle BON_Assets_LoadSoundEx(const char* filename, bool useCache, BON_SoundStorage storage)
 {
-	return_asset_ptr(bon::SoundAsset,bon::_GetEngine().Assets().LoadSound(filename, useCache));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadSound(filename, useCache, (bon::SoundStorage)storage));
 }
 
 /**
 * Load and return a font asset.
 */
-bon::FontAsset* BON_Assets_LoadFont(const char* filename, int fontSize, bool useCache)
+bon::AssetHandle BON_Assets_LoadFont(const char* filename, int fontSize, bool useCache)
 {
-	return_asset_ptr(bon::FontAsset,bon::_GetEngine().Assets().LoadFont(filename, fontSize, useCache));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadFont(filename, fontSize, useCache));
 }
 
 /**
 * Load and return a configuration asset.
 */
-bon::ConfigAsset* BON_Assets_LoadConfig(const char* filename, bool useCache)
+bon::AssetHandle BON_Assets_LoadConfig(const char* filename, bool useCache)
 {
-	return_asset_ptr(bon::ConfigAsset,bon::_GetEngine().Assets().LoadConfig(filename, useCache));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadConfig(filename, useCache));
 }
 
 /**
  * Loadand return an effect asset.
  */
-bon::EffectAsset* BON_Assets_LoadEffect(const char* filename, bool useCache)
+bon::AssetHandle BON_Assets_LoadEffect(const char* filename, bool useCache)
 {
-	return_asset_ptr(bon::EffectAsset, bon::_GetEngine().Assets().LoadEffect(filename, useCache));
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().LoadEffect(filename, useCache));
 }
 
 /**
 * Create and return an empty configuration file.
 */
-bon::ConfigAsset* BON_Assets_CreateEmptyConfig()
+bon::AssetHandle BON_Assets_CreateEmptyConfig()
 {
-	return_asset_ptr(bon::ConfigAsset,bon::_GetEngine().Assets().CreateEmptyConfig());
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Assets().CreateEmptyConfig());
 }
 
 /**
 * Save configuration file.
 */
-bool BON_Assets_SaveConfig(bon::ConfigAsset* config, const char* filename)
+bool BON_Assets_SaveConfig(bon::AssetHandle config, const char* filename)
 {
-	return bon::_GetEngine().Assets().SaveConfig(*config, filename);
+	return bon::_GetEngine().Assets().SaveConfig(bon::_GetEngine().Assets().GetConfig(config), filename);
 }
 
 /**
@@ -87,9 +98,39 @@ void BON_Assets_ClearCache()
 }
 
 /**
-* Delete an asset pointer.
+* Release an asset handle.
+*/
+void BON_Assets_ReleaseHandle(bon::AssetHandle asset, bool deferred)
+{
+	bon::_GetEngine().Assets().ReleaseHandle(asset, deferred);
+}
+
+/**
+* Check if an asset handle is valid.
+*/
+bool BON_Assets_IsHandleValid(bon::AssetHandle asset)
+{
+	return bon::_GetEngine().Assets().IsHandleValid(asset);
+}
+
+
+/**
+* Set memory budgets for cached assets of a given type.
+*/
+void BON_Assets_SetCacheBudget(BON_AssetTypes type, size_t ramBytes, size_t vramBytes)
+{
+	bon::_GetEngine().Assets().SetCacheBudget((bon::AssetTypes)type, ramBytes, vramBytes);
+}
+
+/**
+* Get cache residency stats for a given asset type.
 */
-void BON_Assets_FreeAssetPointer(bon::AssetPtr* asset)
+void BON_Assets_GetCacheStats(BON_AssetTypes type, size_t* outCachedAssets, size_t* outWeakAssets, size_t* outRamBytes, size_t* outVramBytes, size_t* outEvictions)
 {
-	delete asset;
+	bon::AssetsCacheStats stats = bon::_GetEngine().Assets().GetCacheStats((bon::AssetTypes)type);
+	*outCachedAssets = stats.CachedAssets;
+	*outWeakAssets = stats.WeakAssets;
+	*outRamBytes = stats.RamBytes;
+	*outVramBytes = stats.VramBytes;
+	*outEvictions = stats.Evictions;
 }
@@ -23,4 +23,41 @@ void BON_Diagnostics_ResetCounter(int id)
 void BON_Diagnostics_FpsCounter()
 {
 	bon::_GetEngine().Diagnostics().FpsCount();
+}
+
+// Get histogram bucket values count.
+int64_t BON_Diagnostics_GetHistogramBucket(int id, int bucket)
+{
+	if (bucket < 0 || bucket >= bon::DiagnosticsHistogram::BucketsCount) { return 0; }
+	return bon::_GetEngine().Diagnostics()._GetHistogram(id).Buckets[bucket];
+}
+
+// Get histogram buckets count.
+int BON_Diagnostics_GetHistogramBucketsCount()
+{
+	return bon::DiagnosticsHistogram::BucketsCount;
+}
+
+// Get histogram bucket size.
+int64_t BON_Diagnostics_GetHistogramBucketSize(int id)
+{
+	return bon::_GetEngine().Diagnostics()._GetHistogram(id).BucketSize;
+}
+
+// Get histogram total values count.
+int64_t BON_Diagnostics_GetHistogramCount(int id)
+{
+	return bon::_GetEngine().Diagnostics()._GetHistogram(id).Count;
+}
+
+// Get histogram biggest value.
+int64_t BON_Diagnostics_GetHistogramMax(int id)
+{
+	return bon::_GetEngine().Diagnostics()._GetHistogram(id).Max;
+}
+
+// Reset histogram values.
+void BON_Diagnostics_ResetHistogram(int id)
+{
+	bon::_GetEngine().Diagnostics()._GetHistogram(id).Reset();
 }
\ No newline at end of file
@@ -1,41 +1,36 @@
 #include <_CAPI/CAPI_Managers_Gfx.h>
 #include <BonEngine.h>
 
-#define return_asset_ptr(_type, _val) \
-	_type* ret = new _type;	\
-	*ret = _val;	\
-	return ret
-
 /**
 * Draw an image on screen.
 */
-void BON_Gfx_DrawImage(const bon::assets::ImageAsset* image, float x, float y, int width, int height, BON_BlendModes blend)
+void BON_Gfx_DrawImage(bon::AssetHandle image, float x, float y, int width, int height, BON_BlendModes blend)
 {
-	bon::_GetEngine().Gfx().DrawImage(*image, bon::PointF(x, y), &bon::PointI(width, height), (bon::BlendModes)blend);
+	bon::_GetEngine().Gfx().DrawImage(bon::_GetEngine().Assets().GetImage(image), bon::PointF(x, y), &bon::PointI(width, height), (bon::BlendModes)blend);
 }
 
 /**
 * Draw an image on screen.
 */
-void BON_Gfx_DrawImageEx(const bon::assets::ImageAsset* image, float x, float y, int width, int height, BON_BlendModes blend, int sx, int sy, int swidth, int sheight, float originX, float originY, float rotation, float r, float g, float b, float a)
+void BON_Gfx_DrawImageEx(bon::AssetHandle image, float x, float y, int width, int height, BON_BlendModes blend, int sx, int sy, int swidth, int sheight, float originX, float originY, float rotation, float r, float g, float b, float a)
 {
-	bon::_GetEngine().Gfx().DrawImage(*image, bon::PointF(x, y), &bon::PointI(width, height), (bon::BlendModes)blend, &bon::RectangleI(sx, sy, swidth, sheight), &bon::PointF(originX, originY), rotation, &bon::Color(r,g,b,a));
+	bon::_GetEngine().Gfx().DrawImage(bon::_GetEngine().Assets().GetImage(image), bon::PointF(x, y), &bon::PointI(width, height), (bon::BlendModes)blend, &bon::RectangleI(sx, sy, swidth, sheight), &bon::PointF(originX, originY), rotation, &bon::Color(r,g,b,a));
 }
 
 /**
 * Draw text on screen.
 */
-void BON_Gfx_DrawText(const bon::assets::FontAsset* font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation)
+void BON_Gfx_DrawText(bon::AssetHandle font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation)
 {
-	bon::_GetEngine().Gfx().DrawText(*font, text, bon::PointF(x, y), &bon::Color(r, g, b, a), fontSize, maxWidth, (bon::BlendModes)blend, &bon::PointF(originX, originY), rotation);
+	bon::_GetEngine().Gfx().DrawText(bon::_GetEngine().Assets().GetFont(font), text, bon::PointF(x, y), &bon::Color(r, g, b, a), fontSize, maxWidth, (bon::BlendModes)blend, &bon::PointF(originX, originY), rotation);
 }
 
 /**
 * Draw text with outline on screen.
 */
-BON_DLLEXPORT void BON_Gfx_DrawTextWithOutline(const bon::assets::FontAsset* font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation, int outlineWidth, float outlineR, float outlineG, float outlineB, float outlineA)
+BON_DLLEXPORT void BON_Gfx_DrawTextWithOutline(bon::AssetHandle font, const char* text, float x, float y, float r, float g, float b, float a, int fontSize, int maxWidth, BON_BlendModes blend, float originX, float originY, float rotation, int outlineWidth, float outlineR, float outlineG, float outlineB, float outlineA)
 {
-	bon::_GetEngine().Gfx().DrawText(*font, text, bon::PointF(x, y), &bon::Color(r, g, b, a), fontSize, maxWidth, (bon::BlendModes)blend, &bon::PointF(originX, originY), rotation, outlineWidth, &bon::Color(outlineR, outlineG, outlineB, outlineA));
+	bon::_GetEngine().Gfx().DrawText(bon::_GetEngine().Assets().GetFont(font), text, bon::PointF(x, y), &bon::Color(r, g, b, a), fontSize, maxWidth, (bon::BlendModes)blend, &bon::PointF(originX, originY), rotation, outlineWidth, &bon::Color(outlineR, outlineG, outlineB, outlineA));
 }
 
 /**
@@ -108,17 +103,17 @@ int BON_Gfx_WindowSizeY()
 /**
  * Set render target.
  */
-void BON_Gfx_SetRenderTarget(const bon::assets::ImageAsset* target)
+void BON_Gfx_SetRenderTarget(bon::AssetHandle target)
 {
-	bon::_GetEngine().Gfx().SetRenderTarget(target ? *target : nullptr);
+	bon::_GetEngine().Gfx().SetRenderTarget(bon::_GetEngine().Assets().GetImage(target));
 }
 
 /**
  * Get render target.
  */
-bon::assets::ImageAsset* BON_Gfx_GetRenderTarget()
+bon::AssetHandle BON_Gfx_GetRenderTarget()
 {	
-	return (bon::assets::ImageAsset*)(&bon::_GetEngine().Gfx().GetRenderTarget());
+	return bon::_GetEngine().Assets().FindHandle(bon::_GetEngine().Gfx().GetRenderTarget());
 }
 
 /**
@@ -132,17 +127,17 @@ void BON_Gfx_FocusWindow()
 /**
  * Create image asset from screen.
  */
-bon::assets::ImageAsset* BON_Gfx_CreateImageFromScreen()
+bon::AssetHandle BON_Gfx_CreateImageFromScreen()
 {
-	return_asset_ptr(bon::ImageAsset, bon::_GetEngine().Gfx().CreateImageFromScreen());
+	return bon::_GetEngine().Assets().AcquireHandle(bon::_GetEngine().Gfx().CreateImageFromScreen());
 }
 
 /**
  * Set effect to use.
  */
-void BON_Gfx_UseEffect(const bon::assets::EffectAsset* effect)
+void BON_Gfx_UseEffect(bon::AssetHandle effect)
 {
-	bon::_GetEngine().Gfx().UseEffect(effect != nullptr ? *effect : nullptr);
+	bon::_GetEngine().Gfx().UseEffect(bon::_GetEngine().Assets().GetEffect(effect));
 }
 
 /**
@@ -198,14 +193,171 @@ void BON_Gfx_SetViewport(int x, int y, int w, int h)
 	}
 }
 
+/**
+* Set clipping rect, or 0, 0, 0, 0 to disable clipping.
+*/
+void BON_Gfx_SetClipRect(int x, int y, int w, int h)
+{
+	if (w == 0 && h == 0) {
+		bon::_GetEngine().Gfx().SetClipRect(nullptr);
+	}
+	else {
+		bon::framework::RectangleI rect(x, y, w, h);
+		bon::_GetEngine().Gfx().SetClipRect(&rect);
+	}
+}
+
+/**
+* Get clipping rect. Returns false if clipping is disabled.
+*/
+bool BON_Gfx_GetClipRect(int* x, int* y, int* w, int* h)
+{
+	const bon::framework::RectangleI* rect = bon::_GetEngine().Gfx().GetClipRect();
+	if (!rect) { return false; }
+	*x = rect->X;
+	*y = rect->Y;
+	*w = rect->Width;
+	*h = rect->Height;
+	return true;
+}
+
+/**
+* Set offset to add to all drawing positions.
+*/
+void BON_Gfx_SetDrawOffset(int x, int y)
+{
+	bon::_GetEngine().Gfx().SetDrawOffset(bon::PointI(x, y));
+}
+
+/**
+* Get offset we add to all drawing positions.
+*/
+void BON_Gfx_GetDrawOffset(int* x, int* y)
+{
+	const bon::PointI& offset = bon::_GetEngine().Gfx().GetDrawOffset();
+	*x = offset.X;
+	*y = offset.Y;
+}
+
 /**
 * Get text bounding box.
 */
-void BON_Gfx_GetTextBoundingBox(const bon::assets::FontAsset* font, const char* text, float x, float y, int fontSize, int maxWidth, float originX, float originY, float rotation, int* outX, int* outY, int* outWidth, int* outHeight)
+void BON_Gfx_GetTextBoundingBox(bon::AssetHandle font, const char* text, float x, float y, int fontSize, int maxWidth, float originX, float originY, float rotation, int* outX, int* outY, int* outWidth, int* outHeight)
 {
-	auto ret = bon::_GetEngine().Gfx().GetTextBoundingBox(*font, text, bon::framework::PointF(x, y), fontSize, maxWidth, &bon::PointF(originX, originY), rotation);
+	auto ret = bon::_GetEngine().Gfx().GetTextBoundingBox(bon::_GetEngine().Assets().GetFont(font), text, bon::framework::PointF(x, y), fontSize, maxWidth, &bon::PointF(originX, originY), rotation);
 	*outX = ret.X;
 	*outY = ret.Y;
 	*outWidth = ret.Width;
 	*outHeight = ret.Height;
+}
+
+/**
+* Compile effects waiting for lazy compilation.
+*/
+int BON_Gfx_WarmUpEffects(double maxTime)
+{
+	return bon::_GetEngine().Gfx().WarmUpEffects(maxTime);
+}
+
+/**
+* Read pixels from image or screen (if image is null) without waiting for the GPU. Must be freed with BON_PixelsReadback_Free().
+*/
+bon::gfx::PixelsReadback* BON_Gfx_ReadPixelsAsync(bon::AssetHandle image, int x, int y, int w, int h, const char* saveToFile)
+{
+	bon::gfx::PixelsReadback* ret = new bon::gfx::PixelsReadback;
+	*ret = bon::_GetEngine().Gfx().ReadPixelsAsync(bon::_GetEngine().Assets().GetImage(image), bon::framework::RectangleI(x, y, w, h), saveToFile);
+	return ret;
+}
+
+/**
+* Get if async pixels readback is ready.
+*/
+bool BON_PixelsReadback_IsReady(const bon::gfx::PixelsReadback* readback)
+{
+	return (*readback)->IsReady();
+}
+
+/**
+* Get if async pixels readback failed.
+*/
+bool BON_PixelsReadback_Failed(const bon::gfx::PixelsReadback* readback)
+{
+	return (*readback)->Failed();
+}
+
+/**
+* Get async pixels readback raw RGBA data, or null if not ready.
+*/
+const unsigned char* BON_PixelsReadback_Pixels(const bon::gfx::PixelsReadback* readback)
+{
+	return (*readback)->Pixels();
+}
+
+/**
+* Get pixel from async pixels readback.
+*/
+void BON_PixelsReadback_GetPixel(const bon::gfx::PixelsReadback* readback, int x, int y, float* r, float* g, float* b, float* a)
+{
+	bon::Color ret = (*readback)->GetPixel(bon::PointI(x, y));
+	*r = ret.R;
+	*g = ret.G;
+	*b = ret.B;
+	*a = ret.A;
+}
+
+/**
+* Save async pixels readback to file.
+*/
+bool BON_PixelsReadback_SaveToFile(const bon::gfx::PixelsReadback* readback, const char* filename)
+{
+	return (*readback)->SaveToFile(filename);
+}
+
+/**
+* Free async pixels readback pointer.
+*/
+void BON_PixelsReadback_Free(bon::gfx::PixelsReadback* readback)
+{
+	delete readback;
+}
+
+/**
+* Start capturing frames to disk. Format: 0 = png sequence, 1 = y4m. Overflow: 0 = drop frames, 1 = throttle.
+*/
+void BON_Gfx_StartFrameCapture(int format, const char* outputPath, int captureEveryNFrames, int maxQueuedFrames, int workerThreads, int overflow, int frameRate, int maxFrames)
+{
+	bon::gfx::FrameCaptureSettings settings;
+	settings.Format = (bon::gfx::FrameCaptureFormats)format;
+	settings.OutputPath = outputPath;
+	settings.CaptureEveryNFrames = captureEveryNFrames;
+	settings.MaxQueuedFrames = maxQueuedFrames;
+	settings.WorkerThreads = workerThreads;
+	settings.Overflow = (bon::gfx::FrameCaptureOverflow)overflow;
+	settings.FrameRate = frameRate;
+	settings.MaxFrames = maxFrames;
+	bon::_GetEngine().Gfx().StartFrameCapture(settings);
+}
+
+/**
+* Start capturing frames to disk, with settings from config.
+*/
+void BON_Gfx_StartFrameCaptureFromConfig(bon::AssetHandle config)
+{
+	bon::_GetEngine().Gfx().StartFrameCapture(bon::_GetEngine().Assets().GetConfig(config));
+}
+
+/**
+* Stop capturing frames.
+*/
+void BON_Gfx_StopFrameCapture()
+{
+	bon::_GetEngine().Gfx().StopFrameCapture();
+}
+
+/**
+* Get if currently capturing frames.
+*/
+bool BON_Gfx_IsCapturingFrames()
+{
+	return bon::_GetEngine().Gfx().IsCapturingFrames();
 }
\ No newline at end of file
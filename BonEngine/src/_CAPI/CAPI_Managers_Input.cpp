@@ -26,6 +26,38 @@ bool BON_Input_PressedNow(const char* actionId)
 	return bon::_GetEngine().Input().PressedNow(actionId);
 }
 
+/**
+* Register an action id and get its handle.
+*/
+int BON_Input_RegisterAction(const char* actionId)
+{
+	return bon::_GetEngine().Input().RegisterAction(actionId);
+}
+
+/**
+* Get if a given game action handle is down.
+*/
+bool BON_Input_ActionDown(int action)
+{
+	return bon::_GetEngine().Input().Down((bon::ActionHandle)action);
+}
+
+/**
+* Get if a given game action handle was released this frame
+*/
+bool BON_Input_ActionReleasedNow(int action)
+{
+	return bon::_GetEngine().Input().ReleasedNow((bon::ActionHandle)action);
+}
+
+/**
+* Get if a given game action handle was pressed this frame
+*/
+bool BON_Input_ActionPressedNow(int action)
+{
+	return bon::_GetEngine().Input().PressedNow((bon::ActionHandle)action);
+}
+
 /**
 * Get if a key code is down.
 */
@@ -122,6 +154,14 @@ void BON_Input_SetKeyBind(BON_KeyCodes keyCode, const char* actionId)
 	bon::_GetEngine().Input().SetKeyBind((bon::KeyCodes)keyCode, actionId);
 }
 
+/**
+* Bind a key to an additional action id, without removing previous binds.
+*/
+void BON_Input_AddKeyBind(BON_KeyCodes keyCode, const char* actionId)
+{
+	bon::_GetEngine().Input().AddKeyBind((bon::KeyCodes)keyCode, actionId);
+}
+
 /**
 * Get list of key codes assigned to given action id.
 */
@@ -166,7 +206,7 @@ BON_TextInputData BON_Input_GetTextInput(const char* value)
 /**
 * Load key binds from config asset.
 */
-void BON_Input_LoadControlsFromConfig(bon::ConfigAsset* config, bool replaceExisting)
+void BON_Input_LoadControlsFromConfig(bon::AssetHandle config, bool replaceExisting)
 {
-	bon::_GetEngine().Input().LoadControlsFromConfig(*config, replaceExisting);
+	bon::_GetEngine().Input().LoadControlsFromConfig(bon::_GetEngine().Assets().GetConfig(config), replaceExisting);
 }
\ No newline at end of file
@@ -12,9 +12,9 @@ void BON_Sfx_SetAudioProperties(int frequency, BON_AudioFormats format, bool ste
 /**
 * Play a music track.
 */
-void BON_Sfx_PlayMusic(bon::assets::MusicAsset* music, int volume, int loops, float fadeInTime)
+void BON_Sfx_PlayMusic(bon::AssetHandle music, int volume, int loops, float fadeInTime)
 {
-	return bon::_GetEngine().Sfx().PlayMusic(*music, volume, loops, fadeInTime);
+	return bon::_GetEngine().Sfx().PlayMusic(bon::_GetEngine().Assets().GetMusic(music), volume, loops, fadeInTime);
 }
 
 /**
@@ -44,17 +44,17 @@ void BON_Sfx_StopMusic()
 /**
 * Play a sound effect.
 */
-int BON_Sfx_PlaySound(bon::assets::SoundAsset* sound, int volume, int loops, float pitch, float fadeInTime)
+int BON_Sfx_PlaySound(bon::AssetHandle sound, int volume, int loops, float pitch, float fadeInTime)
 {
-	return bon::_GetEngine().Sfx().PlaySound(*sound, volume, loops, pitch, fadeInTime);
+	return bon::_GetEngine().Sfx().PlaySound(bon::_GetEngine().Assets().GetSound(sound), volume, loops, pitch, fadeInTime);
 }
 
 /**
 * Play a sound effect.
 */
-int BON_Sfx_PlaySoundEx(bon::assets::SoundAsset* sound, int volume, int loops, float pitch, float panLeft, float panRight, float distance, float fadeInTime)
+int BON_Sfx_PlaySoundEx(bon::AssetHandle sound, int volume, int loops, float pitch, float panLeft, float panRight, float distance, float fadeInTime)
 {
-	return bon::_GetEngine().Sfx().PlaySound(*sound, volume, loops, pitch, panLeft, panRight, distance, fadeInTime);
+	return bon::_GetEngine().Sfx().PlaySound(bon::_GetEngine().Assets().GetSound(sound), volume, loops, pitch, panLeft, panRight, distance, fadeInTime);
 }
 
 /**
@@ -97,6 +97,154 @@ void BON_Sfx_SetChannelPanning(int channel, float panLeft, float panRight)
 	return bon::_GetEngine().Sfx().SetChannelPanning(channel, panLeft, panRight);
 }
 
+/**
+* Set the pitch of a currently playing sound channel.
+*/
+void BON_Sfx_SetChannelPitch(int channel, float pitch)
+{
+	bon::_GetEngine().Sfx().SetChannelPitch(channel, pitch);
+}
+
+/**
+* Get the pitch of a sound channel.
+*/
+float BON_Sfx_GetChannelPitch(int channel)
+{
+	return bon::_GetEngine().Sfx().GetChannelPitch(channel);
+}
+
+/**
+* Set resampling quality for pitched sounds.
+*/
+void BON_Sfx_SetResampleQuality(BON_ResampleQuality quality)
+{
+	bon::_GetEngine().Sfx().SetResampleQuality((bon::ResampleQuality)quality);
+}
+
+/**
+* Get resampling quality for pitched sounds.
+*/
+BON_ResampleQuality BON_Sfx_GetResampleQuality()
+{
+	return (BON_ResampleQuality)bon::_GetEngine().Sfx().GetResampleQuality();
+}
+
+/**
+* Set the volume of a mix bus.
+*/
+void BON_Sfx_SetBusVolume(BON_SoundBus bus, float volume)
+{
+	bon::_GetEngine().Sfx().SetBusVolume((bon::SoundBus)bus, volume);
+}
+
+/**
+* Get the volume of a mix bus.
+*/
+float BON_Sfx_GetBusVolume(BON_SoundBus bus)
+{
+	return bon::_GetEngine().Sfx().GetBusVolume((bon::SoundBus)bus);
+}
+
+/**
+* Get if audio is rendered offline.
+*/
+bool BON_Sfx_IsOfflineAudio()
+{
+	return bon::_GetEngine().Sfx().IsOfflineAudio();
+}
+
+/**
+* Render mixer output into buffer, when audio is rendered offline.
+*/
+int BON_Sfx_RenderOffline(float* buffer, int frames)
+{
+	return bon::_GetEngine().Sfx().RenderOffline(buffer, frames);
+}
+
+/**
+* Write audio thread stats to log.
+*/
+void BON_Sfx_LogAudioStats()
+{
+	bon::_GetEngine().Sfx().LogAudioStats();
+}
+
+/**
+* Set the listener transform for positional audio.
+*/
+void BON_Sfx_SetListener(float x, float y, float rotation)
+{
+	bon::_GetEngine().Sfx().SetListener(bon::PointF(x, y), rotation);
+}
+
+/**
+* Get the listener position.
+*/
+void BON_Sfx_GetListenerPosition(float* outX, float* outY)
+{
+	const bon::PointF& ret = bon::_GetEngine().Sfx().GetListenerPosition();
+	(*outX) = ret.X;
+	(*outY) = ret.Y;
+}
+
+/**
+* Set the distance from listener at which sounds are panned completely to one side.
+*/
+void BON_Sfx_SetSpatialPanDistance(float distance)
+{
+	bon::_GetEngine().Sfx().SetSpatialPanDistance(distance);
+}
+
+/**
+* Create a sound emitter for positional audio.
+*/
+int BON_Sfx_CreateEmitter(float x, float y, float minDistance, float maxDistance, BON_SoundRolloff rolloff)
+{
+	return bon::_GetEngine().Sfx().CreateEmitter(bon::PointF(x, y), minDistance, maxDistance, (bon::SoundRolloff)rolloff);
+}
+
+/**
+* Destroy a sound emitter.
+*/
+void BON_Sfx_DestroyEmitter(int emitter)
+{
+	bon::_GetEngine().Sfx().DestroyEmitter(emitter);
+}
+
+/**
+* Set sound emitter position.
+*/
+void BON_Sfx_SetEmitterPosition(int emitter, float x, float y)
+{
+	bon::_GetEngine().Sfx().SetEmitterPosition(emitter, bon::PointF(x, y));
+}
+
+/**
+* Get sound emitter position.
+*/
+void BON_Sfx_GetEmitterPosition(int emitter, float* outX, float* outY)
+{
+	bon::PointF ret = bon::_GetEngine().Sfx().GetEmitterPosition(emitter);
+	(*outX) = ret.X;
+	(*outY) = ret.Y;
+}
+
+/**
+* Set sound emitter distances and rolloff curve.
+*/
+void BON_Sfx_SetEmitterRolloff(int emitter, float minDistance, float maxDistance, BON_SoundRolloff rolloff)
+{
+	bon::_GetEngine().Sfx().SetEmitterRolloff(emitter, minDistance, maxDistance, (bon::SoundRolloff)rolloff);
+}
+
+/**
+* Play a sound effect on a sound emitter.
+*/
+int BON_Sfx_PlaySoundAt(int emitter, bon::AssetHandle sound, int volume, int loops, float pitch, float fadeInTime)
+{
+	return bon::_GetEngine().Sfx().PlaySoundAt(emitter, bon::_GetEngine().Assets().GetSound(sound), volume, loops, pitch, fadeInTime);
+}
+
 /**
 * Stop playing a channel.
 */
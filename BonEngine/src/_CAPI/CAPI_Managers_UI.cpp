@@ -12,9 +12,9 @@ void BON_UI_ReleaseElement(bon::UIElement* element)
 /**
 * Set cursor to render.
 */
-void BON_UI_SetCursorEx(const bon::assets::ImageAsset* image, int width, int height, int offsetX, int offsetY)
+void BON_UI_SetCursorEx(bon::AssetHandle image, int width, int height, int offsetX, int offsetY)
 {
-	bon::_GetEngine().UI().SetCursor(*image, bon::framework::PointI(width, height), bon::framework::PointI(offsetX, offsetY));
+	bon::_GetEngine().UI().SetCursor(bon::_GetEngine().Assets().GetImage(image), bon::framework::PointI(width, height), bon::framework::PointI(offsetX, offsetY));
 }
 
 /**
@@ -165,6 +165,26 @@ bon::UIRectangle* BON_UI_CreateRectangle(const char* stylesheet, bon::UIElement*
 	return new bon::UIRectangle(bon::_GetEngine().UI().CreateRectangle(stylesheet, ptrOrNull(parent)));
 }
 
+/**
+* Create many elements of the same type and stylesheet.
+*/
+void BON_UI_CreateElements(BON_UIElementType type, const char* stylesheet, bon::UIElement* parent, int count, bon::UIElement** outElements)
+{
+	auto elements = bon::_GetEngine().UI().CreateElements((bon::UIElementType)type, stylesheet, ptrOrNull(parent), count);
+	for (size_t i = 0; i < elements.size(); ++i)
+	{
+		outElements[i] = new bon::UIElement(elements[i]);
+	}
+}
+
+/**
+* Clear compiled styles cache.
+*/
+void BON_UI_ClearStylesCache()
+{
+	bon::_GetEngine().UI().ClearStylesCache();
+}
+
 /**
 * Override cursor position just for the input manager.
 */
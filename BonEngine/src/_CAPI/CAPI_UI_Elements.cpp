@@ -216,9 +216,9 @@ void BON_UIElement_SetIgnoreParentPadding(bon::UIElement* element, bool val)
 /**
  * Load element stylesheet from config asset.
  */
-void BON_UIElement_LoadStyleFrom(bon::UIElement* element, bon::ConfigAsset* config)
+void BON_UIElement_LoadStyleFrom(bon::UIElement* element, bon::AssetHandle config)
 {  
-	(*element)->LoadStyleFrom(*config);
+	(*element)->LoadStyleFrom(bon::_GetEngine().Assets().GetConfig(config));
 }
 
 /**
@@ -586,6 +586,95 @@ void BON_UIElement_SetAutoArrangeChildren(bon::UIElement* element, bool val)
 	(*element)->AutoArrangeChildren = val;
 }
 
+/**
+ * Get element ArrangeMode.
+ */
+BON_UIArrangeMode BON_UIElement_GetArrangeMode(bon::UIElement* element)
+{
+	return (BON_UIArrangeMode)(*element)->ArrangeMode;
+}
+
+/**
+ * Set element ArrangeMode.
+ */
+void BON_UIElement_SetArrangeMode(bon::UIElement* element, BON_UIArrangeMode val)
+{
+	(*element)->ArrangeMode = (bon::UIArrangeMode)val;
+}
+
+/**
+ * Get element ArrangeColumns.
+ */
+int BON_UIElement_GetArrangeColumns(bon::UIElement* element)
+{
+	return (*element)->ArrangeColumns;
+}
+
+/**
+ * Set element ArrangeColumns.
+ */
+void BON_UIElement_SetArrangeColumns(bon::UIElement* element, int val)
+{
+	(*element)->ArrangeColumns = val;
+}
+
+/**
+ * Get element FlexGrow.
+ */
+float BON_UIElement_GetFlexGrow(bon::UIElement* element)
+{
+	return (*element)->FlexGrow;
+}
+
+/**
+ * Set element FlexGrow.
+ */
+void BON_UIElement_SetFlexGrow(bon::UIElement* element, float val)
+{
+	(*element)->FlexGrow = val;
+}
+
+/**
+ * Get element CacheAsTexture.
+ */
+bool BON_UIElement_GetCacheAsTexture(bon::UIElement* element)
+{
+	return (*element)->CacheAsTexture;
+}
+
+/**
+ * Set element CacheAsTexture.
+ */
+void BON_UIElement_SetCacheAsTexture(bon::UIElement* element, bool val)
+{
+	(*element)->CacheAsTexture = val;
+	(*element)->InvalidateCache();
+}
+
+/**
+ * Mark element cached texture (and its parents cached textures) as outdated.
+ */
+void BON_UIElement_InvalidateCache(bon::UIElement* element)
+{
+	(*element)->InvalidateCache();
+}
+
+/**
+ * Get element ClipChildren.
+ */
+bool BON_UIElement_GetClipChildren(bon::UIElement* element)
+{
+	return (*element)->ClipChildren;
+}
+
+/**
+ * Set element ClipChildren.
+ */
+void BON_UIElement_SetClipChildren(bon::UIElement* element, bool val)
+{
+	(*element)->ClipChildren = val;
+}
+
 /**
  * Get element ExemptFromAutoArrange.
  */
@@ -717,24 +806,17 @@ void BON_UIRadio_Toggle(bon::UIRadioButton* element)
 /**
  * Get ui image image.
  */
-bon::ImageAsset* BON_UIImage_GetImage(bon::UIImage* element)
+bon::AssetHandle BON_UIImage_GetImage(bon::UIImage* element)
 {
-	return &((*element)->Image);
+	return bon::_GetEngine().Assets().FindHandle((*element)->Image);
 }
 
 /**
  * Set ui image image.
  */
-void BON_UIImage_SetImage(bon::UIImage* element, bon::ImageAsset* image)
+void BON_UIImage_SetImage(bon::UIImage* element, bon::AssetHandle image)
 {
-	if (image == nullptr)
-	{
-		(*element)->Image.reset();
-	}
-	else
-	{
-		(*element)->Image = *image;
-	}
+	(*element)->Image = bon::_GetEngine().Assets().GetImage(image);
 }
 
 /**
@@ -967,6 +1049,54 @@ void BON_UIList_RemoveItemByIndex(bon::UIList* element, int index)
 	(*element)->RemoveItem(index);
 }
 
+/**
+ * Add items to list.
+ */
+void BON_UIList_AddItems(bon::UIList* element, const char** items, int count)
+{
+	(*element)->AddItems(items, count);
+}
+
+/**
+ * Insert item to list at index.
+ */
+void BON_UIList_InsertItem(bon::UIList* element, int index, const char* item)
+{
+	(*element)->InsertItem(index, item);
+}
+
+/**
+ * Insert items to list at index.
+ */
+void BON_UIList_InsertItems(bon::UIList* element, int index, const char** items, int count)
+{
+	(*element)->InsertItems(index, items, count);
+}
+
+/**
+ * Remove range of items from list.
+ */
+void BON_UIList_RemoveItems(bon::UIList* element, int index, int count)
+{
+	(*element)->RemoveItems(index, count);
+}
+
+/**
+ * Get list items count.
+ */
+int BON_UIList_ItemsCount(bon::UIList* element)
+{
+	return (*element)->ItemsCount();
+}
+
+/**
+ * Get list item by index.
+ */
+const char* BON_UIList_GetItem(bon::UIList* element, int index)
+{
+	return (*element)->GetItem(index);
+}
+
 /**
  * Remove item from list.
  */
@@ -1050,17 +1180,17 @@ int BON_UISlider_GetValue(bon::UISlider* element)
 /**
  * Get text font.
  */
-bon::FontAsset* BON_UIText_GetFont(bon::UIText* element)
+bon::AssetHandle BON_UIText_GetFont(bon::UIText* element)
 {
-	return &((*element)->Font);
+	return bon::_GetEngine().Assets().FindHandle((*element)->Font);
 }
 
 /**
  * Set text font.
  */
-void BON_UIText_SetFont(bon::UIText* element, bon::FontAsset* font)
+void BON_UIText_SetFont(bon::UIText* element, bon::AssetHandle font)
 {
-	(*element)->Font = *font;
+	(*element)->Font = bon::_GetEngine().Assets().GetFont(font);
 }
 
 /**
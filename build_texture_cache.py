@@ -0,0 +1,109 @@
+"""
+This script pre-builds the textures cache for a folder of images, so shipped games won't need to decode images on first run.
+Output folder should be the same as the 'TextureCacheFolder' feature, and prefix should be the path the game uses to load images from this folder.
+For example, if the game loads images with 'Assets().LoadImage("assets/gfx/player.png")', run:
+    python build_texture_cache.py path/to/assets/gfx texture_cache --prefix assets/gfx
+
+Use --streaming to also build the smaller levels of images loaded with progressive streaming.
+
+Requires Pillow. If the 'lz4' package is installed, cache files will be compressed, otherwise they will be stored raw.
+"""
+import os
+import struct
+import argparse
+from PIL import Image
+try:
+    import lz4.block
+except ImportError:
+    lz4 = None
+
+# cache file constants (must match GfxTextureCache.cpp)
+MAGIC = 0x43585442
+VERSION = 1
+CODEC_RAW = 0
+CODEC_LZ4 = 1
+CHUNK_RAW_SIZE = 256 * 1024
+FLAG_HAVE_ALPHA = 1
+PLACEHOLDER_SIZE = 32
+IMAGE_EXTENSIONS = (".png", ".jpg", ".jpeg", ".bmp", ".tga", ".gif")
+
+# hash data with fnv-1a
+def fnv1a(data, hash = 14695981039346656037):
+    for b in data:
+        hash ^= b
+        hash = (hash * 1099511628211) & 0xffffffffffffffff
+    return hash
+
+# parse args
+parser = argparse.ArgumentParser(description="Pre-build textures cache for BonEngine.")
+parser.add_argument("source", help="Folder with images to cache.")
+parser.add_argument("output", help="Textures cache output folder.")
+parser.add_argument("--prefix", default=None, help="Path the game uses to load images from source folder. Defaults to source folder.")
+parser.add_argument("--streaming", action="store_true", help="Also build levels for progressively streamed images, so they have a preview right away.")
+args = parser.parse_args()
+prefix = args.source if args.prefix is None else args.prefix
+if lz4 is None:
+    print ("Package 'lz4' not found, cache files will not be compressed.")
+
+# create output folder
+if not os.path.exists(args.output):
+    os.makedirs(args.output)
+
+# write a cache file for image pixels (image must be rgba)
+def write_cache_file(key, image, have_alpha, source_size, source_hash):
+
+    # split to chunks and compress
+    pixels = image.tobytes()
+    chunks = []
+    for i in range(0, len(pixels), CHUNK_RAW_SIZE):
+        chunk = pixels[i:i + CHUNK_RAW_SIZE]
+        chunks.append(lz4.block.compress(chunk, store_size=False) if lz4 else chunk)
+
+    # write cache file. source modification time is set to 0, so the engine will validate it by content hash on first load
+    header = struct.pack("<IIIIIIQqQII", MAGIC, VERSION, image.width, image.height, FLAG_HAVE_ALPHA if have_alpha else 0,
+        CODEC_LZ4 if lz4 else CODEC_RAW, source_size, 0, source_hash, CHUNK_RAW_SIZE, len(chunks))
+    out_path = os.path.join(args.output, "%016x.btc" % fnv1a(key.encode('utf-8')))
+    with open(out_path, 'wb') as out:
+        out.write(header)
+        for chunk in chunks:
+            out.write(struct.pack("<I", len(chunk)))
+        for chunk in chunks:
+            out.write(chunk)
+    print ("Cached " + key + " -> " + out_path)
+
+# shrink rgba image to half size with a box filter, like the engine does (odd row / column is dropped, sizes don't go below 1)
+def downsample(image):
+    width, height = image.width, image.height
+    image = image.crop((0, 0, (width // 2) * 2 if width > 1 else 1, (height // 2) * 2 if height > 1 else 1))
+    return image.reduce((2 if width > 1 else 1, 2 if height > 1 else 1))
+
+# iterate images
+count = 0
+for root, dirs, files in os.walk(args.source):
+    for filename in files:
+        if not filename.lower().endswith(IMAGE_EXTENSIONS):
+            continue
+
+        # get source path and the key path, as the game will load it
+        source_path = os.path.join(root, filename)
+        key_path = os.path.join(prefix, os.path.relpath(source_path, args.source)).replace("\\", "/")
+        source_data = open(source_path, 'rb').read()
+        source_hash = fnv1a(source_data)
+
+        # decode image to rgba
+        image = Image.open(source_path)
+        # same rule as the engine: alpha channel, or a transparent color key (tRNS / GIF transparency)
+        have_alpha = image.mode in ("RGBA", "LA", "PA") or "transparency" in image.info
+        image = image.convert("RGBA")
+        write_cache_file(key_path, image, have_alpha, len(source_data), source_hash)
+
+        # write streaming levels, down to placeholder level. levels after the first are keyed by 'path#level'
+        if args.streaming:
+            level = 0
+            while image.width > PLACEHOLDER_SIZE or image.height > PLACEHOLDER_SIZE:
+                image = downsample(image)
+                level += 1
+                write_cache_file("%s#%d" % (key_path, level), image, have_alpha, len(source_data), source_hash)
+        count += 1
+
+print ("Done! Cached %d images." % count)